@@ -0,0 +1,79 @@
+#include "realpaver/EventLog.hpp"
+#include "realpaver/configure.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+using namespace realpaver;
+using namespace std;
+
+// prints the usage of this program
+void usage()
+{
+   cerr << "Usage: rp_log_decoder [-t] [-p prec] [-o output] file.rpl" << endl
+        << "  -t         prints the time and the thread of every line" << endl
+        << "  -p prec    number of digits of the bounds (default 8)" << endl
+        << "  -o output  writes in a file instead of the standard output" << endl;
+}
+
+int main(int argc, char **argv)
+{
+   string filename = "", ofilename = "";
+   streamsize prec = 8;
+   bool stamps = false;
+
+   for (int i = 1; i < argc; ++i)
+   {
+      string arg(argv[i]);
+
+      if (arg == "-t")
+         stamps = true;
+
+      else if (arg == "-p" && i + 1 < argc)
+         prec = atoi(argv[++i]);
+
+      else if (arg == "-o" && i + 1 < argc)
+         ofilename = argv[++i];
+
+      else if (filename == "" && arg[0] != '-')
+         filename = arg;
+
+      else
+      {
+         usage();
+         return 1;
+      }
+   }
+
+   if (filename == "" || prec <= 0)
+   {
+      usage();
+      return 1;
+   }
+
+   try
+   {
+      EventLogReader reader;
+      reader.read(filename);
+
+      if (ofilename == "")
+         reader.render(cout, prec, stamps);
+
+      else
+      {
+         ofstream of(ofilename, std::ofstream::out);
+         if (!of.is_open())
+            THROW("Open error of output file " << ofilename);
+
+         of << "Log file " << REALPAVER_STRING << " decoded from " << filename << endl;
+         reader.render(of, prec, stamps);
+      }
+   }
+   catch (Exception e)
+   {
+      cerr << e.what() << endl;
+      return 1;
+   }
+
+   return 0;
+}
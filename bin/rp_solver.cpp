@@ -1,9 +1,13 @@
+#include "realpaver/BinaryModel.hpp"
 #include "realpaver/BoxReporter.hpp"
 #include "realpaver/CSPSolver.hpp"
 #include "realpaver/DomainBox.hpp"
+#include "realpaver/EventLog.hpp"
 #include "realpaver/Logger.hpp"
 #include "realpaver/Param.hpp"
 #include "realpaver/Parser.hpp"
+#include "realpaver/SolutionFile.hpp"
+#include "realpaver/Timer.hpp"
 #include "realpaver/configure.hpp"
 #include <chrono>
 #include <fstream>
@@ -27,20 +31,28 @@ void parseFilename(const std::string &filename, std::string &path, std::string &
                    std::string &ext);
 
 // processes the argulments on the command line
-bool processArgs(int argc, char **argv, string &filename, string &pfilename);
+bool processArgs(int argc, char **argv, string &filename, string &pfilename,
+                 string &bfilename);
+
+// preprocesses a problem and writes the resulting problem in a binary model
+void writeBinaryModel(const Problem &problem, const Params &params,
+                      const string &bfilename);
 
 // inserts points at the end of a string
 string WP(const string &s, int n);
 
+// writes the proof certificate of a solution
+void writeProof(ostream &os, Proof proof);
+
 // main function
 int main(int argc, char **argv)
 {
    try
    {
-      string filename = "", pfilename = "", sfilename = "";
+      string filename = "", pfilename = "", sfilename = "", bfilename = "";
 
       // processes the arguments
-      bool ok = processArgs(argc, argv, filename, pfilename);
+      bool ok = processArgs(argc, argv, filename, pfilename, bfilename);
       if (!ok)
          THROW("Bad arguments on the command line");
 
@@ -66,24 +78,63 @@ int main(int argc, char **argv)
       string flog = "";
       if (loglevel != LogLevel::none)
       {
-         flog = baseFilename + ".log";
-         Logger::init(loglevel, flog);
+         if (params.getStrParam("LOG_FORMAT") == "BINARY")
+         {
+            EventLog::open(loglevel, baseFilename + ".rpl");
+
+            // the messages of the main level are written in the text file
+            // since they have no binary events
+            Logger::init(LogLevel::main, baseFilename + ".log");
+            flog = baseFilename + ".rpl, " + baseFilename + ".log";
+         }
+         else
+         {
+            flog = baseFilename + ".log";
+            Logger::init(loglevel, flog);
+         }
       }
 #endif
 
       LOG_MAIN("CSP solving");
       LOG_MAIN("Input file: " << filename);
-      LOG_MAIN("Parsing...");
-
       // parsing
       Parser parser(params);
       Problem problem;
+      double ptime = 0.0, pthroughput = 0.0;
+      bool binary = BinaryModel::hasExtension(filename);
+      Scope fixed;
 
-      ok = parser.parseFile(filename, problem);
-      if (!ok)
-         THROW("Parse error: " << parser.getParseError());
+      if (binary)
+      {
+         LOG_MAIN("Reading of binary model...");
+         Timer btimer;
+         btimer.start();
+         BinaryModel::read(filename, problem, fixed);
+         btimer.stop();
+         ptime = btimer.elapsedTime();
+
+         LOG_MAIN("End of reading: " << ptime << "s (" << fixed.size()
+                                     << " fixed variables)");
+      }
+      else
+      {
+         LOG_MAIN("Parsing...");
+         ok = parser.parseFile(filename, problem);
+         if (!ok)
+            THROW("Parse error: " << parser.getParseError());
+
+         ptime = parser.getParseTime();
+         pthroughput = parser.getThroughput();
+         LOG_MAIN("End of parsing: " << parser.getInputSize() << " bytes in " << ptime
+                                     << "s (" << pthroughput << " MB/s)");
+      }
+
+      if (bfilename != "")
+      {
+         writeBinaryModel(problem, params, bfilename);
+         return 0;
+      }
 
-      LOG_MAIN("End of parsing");
       if (!problem.isCSP())
          THROW("Not a CSP");
 
@@ -91,11 +142,57 @@ int main(int argc, char **argv)
       CSPSolver solver(problem);
       solver.getEnv()->setParams(params);
 
+      // a binary model has been preprocessed before being written, hence it
+      // is not preprocessed again; the fixed variables occur in no constraint
+      // and they are restored in the solutions
+      if (binary)
+         solver.setPreprocessed(fixed);
+
+      string tracefilename = "";
+      if (params.getStrParam("SEARCH_TRACE") == "YES")
+      {
+         tracefilename = baseFilename + ".rpt";
+         solver.setSearchTrace(tracefilename);
+      }
+
       std::string sep = "########################################";
       sep += sep;
       std::string indent = "   ";
       int wpl = 36;
 
+      // solutions written one by one in a binary or CSV file
+      string solformat = params.getStrParam("SOLUTION_FORMAT");
+      string boxfilename = "";
+      if (solformat == "BINARY")
+         boxfilename = baseFilename + ".rps";
+      else if (solformat == "CSV")
+         boxfilename = baseFilename + ".csv";
+
+      std::unique_ptr<BoxReporter> boxreporter;
+      ofstream fbox;
+      if (boxfilename != "")
+      {
+         fbox.open(boxfilename, std::ios::out | std::ios::binary);
+         if (!fbox.is_open())
+            THROW("Open error of solution file " << boxfilename);
+
+         if (solformat == "BINARY")
+            boxreporter.reset(new BinaryReporter(problem, fbox));
+         else
+            boxreporter.reset(new CsvReporter(problem, fbox));
+
+         boxreporter->start();
+
+         // the solutions are written as soon as they are found if they are
+         // final, hence they are kept if the solving is interrupted
+         solver.setSolutionCallback(
+             [&](const DomainBox &box, Proof proof)
+             {
+                boxreporter->report(box, proof);
+                fbox.flush();
+             });
+      }
+
       cout << GRAY(sep) << endl;
       cout << BLUE(REALPAVER_STRING) << BLUE(" CSP solver") << endl;
 
@@ -104,6 +201,7 @@ int main(int argc, char **argv)
       ////////////////////
 
       string solfilename = baseFilename + ".sol";
+
       ofstream fsol;
       fsol.open(solfilename, std::ofstream::out);
       if (fsol.bad())
@@ -123,6 +221,12 @@ int main(int argc, char **argv)
 
       cout << indent << WP("Output file", wpl) << BLACK(solfilename) << endl;
 
+      if (tracefilename != "")
+         cout << indent << WP("Trace file", wpl) << BLACK(tracefilename) << endl;
+
+      if (boxfilename != "")
+         cout << indent << WP("Solution file", wpl) << BLACK(boxfilename) << endl;
+
       // preprocessing
       cout << GRAY(sep) << endl;
       string prepro = solver.getEnv()->getParams()->getStrParam("PREPROCESSING");
@@ -137,7 +241,35 @@ int main(int argc, char **argv)
       fsol << WP("Input file", wpl) << filename << endl;
       fsol << WP("Current date and time", wpl) << ctime(&end_time) << endl;
 
-      if (prepro == "YES")
+      // startup: time elapsed before the first node of the search tree, the
+      // preprocessing time being reported in the preprocessing section
+      fsol << "--- STARTUP ---" << endl
+           << endl
+           << std::fixed << std::setprecision(3) << WP("Parsing time", wpl)
+           << ptime << " (seconds)" << endl
+           << WP("Parsing throughput", wpl) << pthroughput << " (MB/s)" << endl
+           << WP("Model construction time", wpl) << solver.getModelTime()
+           << " (seconds)" << endl
+           << WP("Solver setup time", wpl) << solver.getSetupTime() << " (seconds)"
+           << endl
+           << WP("Time to first node", wpl) << solver.getFirstNodeTime() << " (seconds)"
+           << endl
+           << endl;
+
+      cout << BLUE("Startup") << endl;
+      cout << std::fixed << std::setprecision(3) << indent << WP("Parsing time", wpl)
+           << GREEN(ptime << " (seconds)") << endl
+           << indent << WP("Parsing throughput", wpl)
+           << GREEN(pthroughput << " (MB/s)") << endl
+           << indent << WP("Model construction time", wpl)
+           << GREEN(solver.getModelTime() << " (seconds)") << endl
+           << indent << WP("Solver setup time", wpl)
+           << GREEN(solver.getSetupTime() << " (seconds)") << endl
+           << indent << WP("Time to first node", wpl)
+           << GREEN(solver.getFirstNodeTime() << " (seconds)") << endl;
+      cout << GRAY(sep) << endl;
+
+      if (prepro == "YES" && !binary)
       {
          fsol << "--- PREPROCESSING ---" << endl
               << endl
@@ -211,8 +343,6 @@ int main(int argc, char **argv)
       // solving
       if (!(prepro == "YES" && preproc->isSolved()))
       {
-         CSPSpace *space = solver.getSpace();
-
          fsol << "--- SOLVING ---" << endl << endl;
          cout << GRAY(sep) << endl;
          cout << BLUE("Solving") << endl;
@@ -226,7 +356,18 @@ int main(int argc, char **argv)
               << indent << WP("Number of nodes", wpl) << GREEN(solver.getTotalNodes())
               << endl;
 
-         bool complete = env->usedNoLimit() && space->nbPendingNodes() == 0;
+         if (solver.nbFastEvals() > 0)
+         {
+            double ratio = (100.0 * solver.nbFastProofs()) / solver.nbFastEvals();
+            fsol << WP("Fast evaluations", wpl) << solver.nbFastEvals() << " ("
+                 << std::setprecision(1) << ratio << "% conclusive)" << std::setprecision(3)
+                 << endl;
+            cout << indent << WP("Fast evaluations", wpl) << GREEN(solver.nbFastEvals())
+                 << " (" << std::setprecision(1) << GREEN(ratio << "% conclusive") << ")"
+                 << std::setprecision(3) << endl;
+         }
+
+         bool complete = env->usedNoLimit() && solver.nbPendingNodes() == 0;
 
          fsol << WP("Search status", wpl);
          cout << indent << WP("Search status", wpl);
@@ -258,7 +399,7 @@ int main(int argc, char **argv)
          }
          else
          {
-            if (space->hasFeasibleSolNode())
+            if (solver.hasFeasibleSolution())
             {
                fsol << "proved feasible" << endl;
                cout << GREEN("feasible") << endl;
@@ -315,11 +456,19 @@ int main(int argc, char **argv)
             fsol << WP("Depth limit enabled", wpl) << endl;
          }
 
-         if (space->nbPendingNodes() > 0)
+         if (solver.nbPendingNodes() > 0)
          {
-            fsol << WP("Number of pending nodes", wpl) << space->nbPendingNodes() << endl;
+            fsol << WP("Number of pending nodes", wpl) << solver.nbPendingNodes() << endl;
             cout << indent << WP("Number of pending nodes", wpl)
-                 << RED(space->nbPendingNodes()) << endl;
+                 << RED(solver.nbPendingNodes()) << endl;
+         }
+
+         const CSPDecomposition *decomp = solver.getDecomposition();
+         if (decomp != nullptr)
+         {
+            fsol << WP("Number of sub-problems", wpl) << decomp->nbComponents() << endl;
+            cout << indent << WP("Number of sub-problems", wpl)
+                 << GREEN(decomp->nbComponents()) << endl;
          }
 
          // writes the solutions
@@ -342,37 +491,91 @@ int main(int argc, char **argv)
          int prec = params.getIntParam("FLOAT_PRECISION");
          fsol << std::defaultfloat;
 
-         for (size_t i = 0; i < solver.nbSolutions(); ++i)
+         // product representation: the solutions of every sub-problem are
+         // written in the solution file, a binary or CSV file being only
+         // filled with the elements of the product
+         std::string dm = params.getStrParam("BP_DECOMPOSITION");
+         bool product = decomp != nullptr && dm == "PRODUCT" && boxreporter == nullptr;
+
+         for (size_t k = 0; product && k < decomp->nbComponents(); ++k)
+         {
+            fsol << std::endl
+                 << "SUB-PROBLEM " << (k + 1) << " (" << decomp->nbComponentSolutions(k)
+                 << " solutions)" << endl;
+
+            // the variables of the other components and the aliases that
+            // depend on them are not reported
+            Scope cs = solver.getComponentScope(k), rs = cs | preproc->fixedScope();
+
+            StreamReporter creporter(reporter);
+            for (size_t j = 0; j < problem.nbVars(); ++j)
+               if (!rs.contains(problem.varAt(j)))
+                  creporter.remove(problem.varAt(j).getName());
+
+            for (size_t j = 0; j < problem.nbAliases(); ++j)
+               if (!rs.contains(problem.aliasAt(j).scope()))
+                  creporter.remove(problem.aliasAt(j).name());
+
+            for (size_t i = 0; i < decomp->nbComponentSolutions(k); ++i)
+            {
+               std::pair<DomainBox, Proof> sol = solver.getComponentSolution(k, i);
+
+               DomainBox csol(cs);
+               csol.setOnScope(sol.first, cs);
+               IntervalBox hull(csol);
+
+               fsol << std::setprecision(4);
+               fsol << std::endl
+                    << "SOLUTION " << (k + 1) << "." << (i + 1) << " [" << hull.width()
+                    << "]";
+               writeProof(fsol, sol.second);
+               fsol << std::setprecision(prec) << endl;
+               creporter.report(sol.first);
+            }
+         }
+
+         // solutions generated one by one, unless they have been written
+         // during the search; the elements of a product are generated on
+         // demand and at most SOLUTION_LIMIT of them are written
+         bool streamed = solver.hasStreamedSolutions();
+         size_t nbsol = (product || streamed) ? 0 : solver.nbSolutions();
+
+         if (decomp != nullptr)
          {
+            size_t sollim = params.getIntParam("SOLUTION_LIMIT");
+            if (nbsol > sollim)
+            {
+               nbsol = sollim;
+               fsol << std::endl
+                    << "PRODUCT TRUNCATED (first " << sollim << " elements)" << endl;
+            }
+         }
+
+         for (size_t i = 0; i < nbsol; ++i)
+         {
+            std::pair<DomainBox, Proof> sol = solver.getSolution(i);
+
+            if (boxreporter != nullptr)
+            {
+               boxreporter->report(sol.first, sol.second);
+               continue;
+            }
+
             if (i > 0)
                fsol << std::endl;
 
-            std::pair<DomainBox, Proof> sol = solver.getSolution(i);
             IntervalBox hull(sol.first);
 
             fsol << std::setprecision(4);
             fsol << std::endl << "SOLUTION " << (i + 1) << " [" << hull.width() << "]";
-
-            switch (sol.second)
-            {
-            case Proof::Inner:
-               fsol << " [exact]";
-               break;
-            case Proof::Feasible:
-               fsol << " [feasible]";
-               break;
-            case Proof::Maybe:
-               fsol << " [unvalidated]";
-               break;
-            default:
-               fsol << " (bug!!!)";
-               break;
-            }
-
+            writeProof(fsol, sol.second);
             fsol << std::setprecision(prec) << endl;
             reporter.report(sol.first);
          }
 
+         if (boxreporter != nullptr)
+            fsol << std::endl << "SOLUTIONS written in " << boxfilename << endl;
+
          // writes the hull of the pending nodes
          if (solver.nbPendingNodes() > 0)
          {
@@ -411,6 +614,9 @@ int main(int argc, char **argv)
 
       // closes the solution file
       fsol.close();
+
+      // drains the binary log if any
+      EventLog::close();
    }
    catch (Exception e)
    {
@@ -420,7 +626,8 @@ int main(int argc, char **argv)
    return 0;
 }
 
-bool processArgs(int argc, char **argv, string &filename, string &pfilename)
+bool processArgs(int argc, char **argv, string &filename, string &pfilename,
+                 string &bfilename)
 {
    bool hasfile = false;
    int i = 1;
@@ -445,6 +652,17 @@ bool processArgs(int argc, char **argv, string &filename, string &pfilename)
             i = i + 1;
          }
       }
+      else if (text == "-b")
+      {
+         i = i + 1;
+         if (i == argc)
+            return false;
+         else
+         {
+            bfilename = std::string(argv[i]);
+            i = i + 1;
+         }
+      }
       else
          return false;
    }
@@ -452,6 +670,32 @@ bool processArgs(int argc, char **argv, string &filename, string &pfilename)
    return hasfile;
 }
 
+void writeBinaryModel(const Problem &problem, const Params &params,
+                      const string &bfilename)
+{
+   if (params.getStrParam("PREPROCESSING") != "YES")
+   {
+      BinaryModel::write(problem, bfilename);
+      cout << "Binary model written in " << bfilename << endl;
+      return;
+   }
+
+   Preprocessor preproc;
+   preproc.setNbThreads(params.getIntParam("NB_THREADS"));
+
+   Problem dest;
+   preproc.apply(problem, dest);
+
+   THROW_IF(preproc.isUnfeasible(), "Problem proved unfeasible at preprocessing time");
+
+   // the fixed variables are stored with their fixed domains and flagged
+   // as fixed, the constraints are the simplified ones
+   BinaryModel::write(problem, preproc, dest, bfilename);
+   cout << "Binary model written in " << bfilename << " ("
+        << preproc.nbFixedVars() << " fixed variables, " << dest.nbCtrs()
+        << " constraints)" << endl;
+}
+
 void parseFilename(const std::string &filename, std::string &path, std::string &base,
                    std::string &ext)
 {
@@ -497,6 +741,25 @@ void parseFilename(const std::string &filename, std::string &path, std::string &
    }
 }
 
+void writeProof(ostream &os, Proof proof)
+{
+   switch (proof)
+   {
+   case Proof::Inner:
+      os << " [exact]";
+      break;
+   case Proof::Feasible:
+      os << " [feasible]";
+      break;
+   case Proof::Maybe:
+      os << " [unvalidated]";
+      break;
+   default:
+      os << " (bug!!!)";
+      break;
+   }
+}
+
 string WP(const string &s, int n)
 {
    string str = s;
@@ -0,0 +1,80 @@
+#include "realpaver/CSPTrace.hpp"
+#include "realpaver/configure.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+using namespace realpaver;
+using namespace std;
+
+// prints the usage of this program
+void usage()
+{
+   cerr << "Usage: rp_trace_summary [-d depth] [-k count] [-o output] file.rpt" << endl
+        << "  -d depth   depth of the roots of the hot subtrees (default 4)" << endl
+        << "  -k count   number of hot subtrees (default 10)" << endl
+        << "  -o output  writes in a file instead of the standard output" << endl;
+}
+
+int main(int argc, char **argv)
+{
+   string filename = "", ofilename = "";
+   int depth = 4, count = 10;
+
+   for (int i = 1; i < argc; ++i)
+   {
+      string arg(argv[i]);
+
+      if (arg == "-d" && i + 1 < argc)
+         depth = atoi(argv[++i]);
+
+      else if (arg == "-k" && i + 1 < argc)
+         count = atoi(argv[++i]);
+
+      else if (arg == "-o" && i + 1 < argc)
+         ofilename = argv[++i];
+
+      else if (filename == "" && arg[0] != '-')
+         filename = arg;
+
+      else
+      {
+         usage();
+         return 1;
+      }
+   }
+
+   if (filename == "" || depth < 0 || count <= 0)
+   {
+      usage();
+      return 1;
+   }
+
+   try
+   {
+      CSPTraceReader reader;
+      reader.read(filename);
+
+      if (ofilename == "")
+         reader.summarize(cout, depth, count);
+
+      else
+      {
+         ofstream of(ofilename, std::ofstream::out);
+         if (!of.is_open())
+            THROW("Open error of output file " << ofilename);
+
+         of << "Search trace " << REALPAVER_STRING << " summarized from " << filename
+            << endl
+            << endl;
+         reader.summarize(of, depth, count);
+      }
+   }
+   catch (Exception e)
+   {
+      cerr << e.what() << endl;
+      return 1;
+   }
+
+   return 0;
+}
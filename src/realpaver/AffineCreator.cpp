@@ -20,41 +20,100 @@
 
 #include "realpaver/AffineCreator.hpp"
 #include "realpaver/AssertDebug.hpp"
+#include <algorithm>
 
 namespace realpaver {
 
 AffineCreator::AffineCreator(SharedDag dag, bool minrange)
     : dag_(dag)
     , minrange_(minrange)
-    , v_(dag_->nbNodes())
+    , v_()
     , lfun_(dag->nbFuns())
+    , nodes_()
+    , incremental_(false)
+    , dom_()
+    , modif_()
+    , ncall_(0)
+    , nbnodes_(0)
 {
    ASSERT(dag != nullptr, "Null pointer");
 
    for (size_t i = 0; i < dag->nbFuns(); ++i)
       lfun_[i] = i;
+
+   makeWorkspace();
 }
 
 AffineCreator::AffineCreator(SharedDag dag, const IndexList &lfun, bool minrange)
     : dag_(dag)
     , minrange_(minrange)
-    , v_(dag_->nbNodes())
+    , v_()
     , lfun_(lfun)
+    , nodes_()
+    , incremental_(false)
+    , dom_()
+    , modif_()
+    , ncall_(0)
+    , nbnodes_(0)
 {
    ASSERT(dag != nullptr, "Null pointer");
    ASSERT(!lfun.empty(), "Empty list of indexes");
+
+   makeWorkspace();
 }
 
 AffineCreator::AffineCreator(SharedDag dag, size_t i, bool minrange)
     : dag_(dag)
     , minrange_(minrange)
-    , v_(dag_->nbNodes())
+    , v_()
     , lfun_(1)
+    , nodes_()
+    , incremental_(false)
+    , dom_()
+    , modif_()
+    , ncall_(0)
+    , nbnodes_(0)
 {
    ASSERT(dag != nullptr, "Null pointer");
    ASSERT(i < dag->nbFuns(), "Bad function index in a DAG @ " << i);
 
    lfun_[0] = i;
+   makeWorkspace();
+}
+
+void AffineCreator::makeWorkspace()
+{
+   size_t n = dag_->nbNodes();
+
+   if (lfun_.size() != dag_->nbFuns())
+   {
+      // nodes of the sub-DAG sorted by increasing indexes, hence every node
+      // comes after its sub-nodes
+      for (size_t i : lfun_)
+      {
+         DagFun *fun = dag_->fun(i);
+         for (size_t j = 0; j < fun->nbNodes(); ++j)
+            nodes_.push_back(fun->node(j)->index());
+      }
+      std::sort(nodes_.begin(), nodes_.end());
+      nodes_.erase(std::unique(nodes_.begin(), nodes_.end()), nodes_.end());
+      n = nodes_.size();
+   }
+
+   v_.resize(n);
+   dom_.resize(n);
+   modif_.resize(n, 0);
+}
+
+size_t AffineCreator::slot(size_t i) const
+{
+   if (nodes_.empty())
+      return i;
+
+   auto it = std::lower_bound(nodes_.begin(), nodes_.end(), i);
+   ASSERT(it != nodes_.end() && *it == i, "Node not in the sub-DAG @ " << i);
+
+   return it - nodes_.begin();
 }
 
 size_t AffineCreator::nbFuns() const
@@ -64,54 +123,95 @@ size_t AffineCreator::nbFuns() const
 
 const AffineForm &AffineCreator::fun(size_t i) const
 {
-   return *v_[dag_->fun(lfun_[i])->rootNode()->index()];
+   return *v_[slot(dag_->fun(lfun_[i])->rootNode()->index())];
 }
 
 std::unique_ptr<AffineForm> AffineCreator::moveFun(size_t i)
 {
-   return std::move(v_[dag_->fun(lfun_[i])->rootNode()->index()]);
+   return std::move(v_[slot(dag_->fun(lfun_[i])->rootNode()->index())]);
 }
 
 const AffineForm &AffineCreator::fun(const Variable &v) const
 {
-   return *v_[dag_->findVarNode(v.id())->index()];
+   return *v_[slot(dag_->findVarNode(v.id())->index())];
 }
 
 void AffineCreator::useMinrange(bool minrange)
 {
+   if (minrange != minrange_)
+   {
+      // the affine forms kept in the incremental mode are no more valid
+      for (auto &f : v_)
+         f.reset();
+   }
    minrange_ = minrange;
 }
 
+bool AffineCreator::isMinrange() const
+{
+   return minrange_;
+}
+
+void AffineCreator::useIncremental(bool incremental)
+{
+   incremental_ = incremental;
+}
+
+bool AffineCreator::isIncremental() const
+{
+   return incremental_;
+}
+
+size_t AffineCreator::nbCreatedNodes() const
+{
+   return nbnodes_;
+}
+
 void AffineCreator::create(const IntervalBox &B)
 {
    ASSERT(B.scope().contains(dag_->scope()), "Bad scopes");
 
    AffineForm::useMinrange(minrange_);
+   ++ncall_;
 
-   if (lfun_.size() == dag_->nbFuns())
-   {
-      for (int i = 0; i < dag_->nbNodes(); ++i)
-         makeNode(i, B);
-   }
-   else
+   // the sub-nodes are handled before their parents
+   for (size_t k = 0; k < v_.size(); ++k)
+      updateNode(k, B);
+}
+
+void AffineCreator::updateNode(size_t k, const IntervalBox &B)
+{
+   DagNode *node = dag_->node(nodes_.empty() ? k : nodes_[k]);
+   bool make = !incremental_ || (v_[k] == nullptr);
+
+   if (!make)
    {
-      for (int i = 0; i < lfun_.size(); ++i)
+      if (node->symbol() == DagSymbol::Var)
       {
-         DagFun *fun = dag_->fun(lfun_[i]);
-         for (size_t j = 0; j < fun->nbNodes(); ++j)
-         {
-            DagNode *node = fun->node(j);
-            size_t k = node->index();
-            if (v_[k] == nullptr)
-               makeNode(k, B);
-         }
+         const Variable &v = static_cast<DagVar *>(node)->getVar();
+         make = !B.get(v).isSetEq(dom_[k]);
       }
+      else
+      {
+         for (size_t j = 0; j < node->subArity() && !make; ++j)
+            make = (modif_[slot(node->subIndex(j))] == ncall_);
+      }
+   }
+
+   if (make)
+   {
+      if (node->symbol() == DagSymbol::Var)
+         dom_[k] = B.get(static_cast<DagVar *>(node)->getVar());
+
+      makeNode(k, B);
+      modif_[k] = ncall_;
+      ++nbnodes_;
    }
 }
 
-void AffineCreator::makeNode(int i, const IntervalBox &B)
+void AffineCreator::makeNode(size_t k, const IntervalBox &B)
 {
-   DagNode *node = dag_->node(i);
+   DagNode *node = dag_->node(nodes_.empty() ? k : nodes_[k]);
    std::unique_ptr<AffineForm> f = nullptr;
 
    switch (node->symbol())
@@ -127,122 +227,122 @@ void AffineCreator::makeNode(int i, const IntervalBox &B)
    }
    case DagSymbol::Add: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t l = aux->left()->index(), r = aux->right()->index();
+      size_t l = slot(aux->left()->index()), r = slot(aux->right()->index());
       f = std::make_unique<AffineForm>(*v_[l] + *v_[r]);
       break;
    }
    case DagSymbol::Sub: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t l = aux->left()->index(), r = aux->right()->index();
+      size_t l = slot(aux->left()->index()), r = slot(aux->right()->index());
       f = std::make_unique<AffineForm>(*v_[l] - *v_[r]);
       break;
    }
    case DagSymbol::Mul: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t l = aux->left()->index(), r = aux->right()->index();
+      size_t l = slot(aux->left()->index()), r = slot(aux->right()->index());
       f = std::make_unique<AffineForm>(*v_[l] * *v_[r]);
       break;
    }
    case DagSymbol::Div: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t l = aux->left()->index(), r = aux->right()->index();
+      size_t l = slot(aux->left()->index()), r = slot(aux->right()->index());
       f = std::make_unique<AffineForm>(*v_[l] / *v_[r]);
       break;
    }
    case DagSymbol::Min: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t l = aux->left()->index(), r = aux->right()->index();
+      size_t l = slot(aux->left()->index()), r = slot(aux->right()->index());
       f = std::make_unique<AffineForm>(min(*v_[l], *v_[r]));
       break;
    }
    case DagSymbol::Max: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t l = aux->left()->index(), r = aux->right()->index();
+      size_t l = slot(aux->left()->index()), r = slot(aux->right()->index());
       f = std::make_unique<AffineForm>(max(*v_[l], *v_[r]));
       break;
    }
    case DagSymbol::Usb: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t c = aux->child()->index();
+      size_t c = slot(aux->child()->index());
       f = std::make_unique<AffineForm>(-(*v_[c]));
       break;
    }
    case DagSymbol::Abs: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t c = aux->child()->index();
+      size_t c = slot(aux->child()->index());
       f = std::make_unique<AffineForm>(abs(*v_[c]));
       break;
    }
    case DagSymbol::Sgn: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t c = aux->child()->index();
+      size_t c = slot(aux->child()->index());
       f = std::make_unique<AffineForm>(sgn(*v_[c]));
       break;
    }
    case DagSymbol::Sqr: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t c = aux->child()->index();
+      size_t c = slot(aux->child()->index());
       f = std::make_unique<AffineForm>(sqr(*v_[c]));
       break;
    }
    case DagSymbol::Sqrt: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t c = aux->child()->index();
+      size_t c = slot(aux->child()->index());
       f = std::make_unique<AffineForm>(sqrt(*v_[c]));
       break;
    }
    case DagSymbol::Pow: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t c = aux->child()->index();
+      size_t c = slot(aux->child()->index());
       int e = static_cast<DagPow *>(node)->exponent();
       f = std::make_unique<AffineForm>(pow(*v_[c], e));
       break;
    }
    case DagSymbol::Exp: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t c = aux->child()->index();
+      size_t c = slot(aux->child()->index());
       f = std::make_unique<AffineForm>(exp(*v_[c]));
       break;
    }
    case DagSymbol::Log: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t c = aux->child()->index();
+      size_t c = slot(aux->child()->index());
       f = std::make_unique<AffineForm>(log(*v_[c]));
       break;
    }
    case DagSymbol::Cos: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t c = aux->child()->index();
+      size_t c = slot(aux->child()->index());
       f = std::make_unique<AffineForm>(cos(*v_[c]));
       break;
    }
    case DagSymbol::Sin: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t c = aux->child()->index();
+      size_t c = slot(aux->child()->index());
       f = std::make_unique<AffineForm>(sin(*v_[c]));
       break;
    }
    case DagSymbol::Tan: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t c = aux->child()->index();
+      size_t c = slot(aux->child()->index());
       f = std::make_unique<AffineForm>(tan(*v_[c]));
       break;
    }
    case DagSymbol::Cosh: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t c = aux->child()->index();
+      size_t c = slot(aux->child()->index());
       f = std::make_unique<AffineForm>(cosh(*v_[c]));
       break;
    }
    case DagSymbol::Sinh: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t c = aux->child()->index();
+      size_t c = slot(aux->child()->index());
       f = std::make_unique<AffineForm>(sinh(*v_[c]));
       break;
    }
    case DagSymbol::Tanh: {
       DagAdd *aux = static_cast<DagAdd *>(node);
-      size_t c = aux->child()->index();
+      size_t c = slot(aux->child()->index());
       f = std::make_unique<AffineForm>(tanh(*v_[c]));
       break;
    }
@@ -254,7 +354,7 @@ void AffineCreator::makeNode(int i, const IntervalBox &B)
       for (int j = 0; j < aux->nbTerms(); ++j)
       {
          // affine form of the variable in this term
-         const AffineForm &g = *v_[aux->varNode(j)->index()];
+         const AffineForm &g = *v_[slot(aux->varNode(j)->index())];
 
          // adds the affine form of this term in f
          f->push(AffineForm(aux->coef(j)) * g);
@@ -262,7 +362,7 @@ void AffineCreator::makeNode(int i, const IntervalBox &B)
       break;
    }
    }
-   v_[i] = std::move(f);
+   v_[k] = std::move(f);
 }
 
 } // namespace realpaver
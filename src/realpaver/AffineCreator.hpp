@@ -41,6 +41,17 @@ namespace realpaver {
  * The variables in affine forms are represented by integers. Variable i corresponds
  * to the i-th variable of the scope of the DAG. Given this scope S, the original
  * variable is S.var(i).
+ *
+ * In the incremental mode, the affine forms are kept from one call of create
+ * to the next one. The affine form of a node only depends on the domains of
+ * the variables occurring in its sub-DAG, hence a node is recreated only if
+ * one of these domains has been modified. After a bisection, only the nodes
+ * depending on the split variable are recreated. Scaling the affine forms of
+ * the nonlinear nodes is not sound since their linearizations depend on the
+ * ranges of their sub-terms, hence the forms of these nodes are recreated.
+ *
+ * The workspace of a creator on a subset of a DAG is proportional to the
+ * number of nodes of the functions considered, not to the size of the DAG.
  */
 class AffineCreator {
 public:
@@ -91,6 +102,18 @@ public:
    /// Selects the Minrange or the Chebyshev approximation
    void useMinrange(bool minrange = true);
 
+   /// Returns true if the Minrange approximation is selected
+   bool isMinrange() const;
+
+   /// Enables or disables the incremental mode
+   void useIncremental(bool incremental = true);
+
+   /// Returns true if the incremental mode is enabled
+   bool isIncremental() const;
+
+   /// Returns the number of nodes whose affine forms have been created
+   size_t nbCreatedNodes() const;
+
    /// Returns the number of affine forms created
    size_t nbFuns() const;
 
@@ -116,9 +139,27 @@ private:
    bool minrange_;                              // true: Minrange, false:Chebyshev
    std::vector<std::unique_ptr<AffineForm>> v_; // affine forms
    IndexList lfun_;                             // list of indexes of functions
+   IndexList nodes_;                            // nodes of the sub-DAG
+   bool incremental_;                           // true for the incremental mode
+   std::vector<Interval> dom_;                  // domains of the variable nodes
+   std::vector<size_t> modif_;                  // last call creating a node
+   size_t ncall_;                               // number of calls of create
+   size_t nbnodes_;                             // number of nodes created
+
+   // The nodes are handled in slots. If nodes_ is empty then the k-th slot
+   // is assigned to the k-th node of the DAG, otherwise to the node nodes_[k].
+
+   // Allocates the slots
+   void makeWorkspace();
+
+   // Returns the slot of the i-th node of the DAG
+   size_t slot(size_t i) const;
+
+   // Creates the affine form of the k-th slot if necessary
+   void updateNode(size_t k, const IntervalBox &B);
 
-   // Creates the affine form of the i-th node of the DAG
-   void makeNode(int i, const IntervalBox &B);
+   // Creates the affine form of the k-th slot
+   void makeNode(size_t k, const IntervalBox &B);
 };
 
 } // namespace realpaver
@@ -0,0 +1,877 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   BinaryModel.cpp
+ * @brief  Binary serialization of problems
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#include "realpaver/AssertDebug.hpp"
+#include "realpaver/BinaryModel.hpp"
+#include "realpaver/Exception.hpp"
+#include <cstring>
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define REALPAVER_BINARY_MODEL_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace realpaver {
+
+// magic string and size of the header: magic, version, size, checksum
+static const char BINARY_MODEL_MAGIC[4] = {'R', 'P', 'B', 'M'};
+static const size_t BINARY_MODEL_HEADER = 4 + sizeof(uint32_t) + 2 * sizeof(uint64_t);
+
+const uint32_t BinaryModel::VERSION = 2;
+
+void BinaryModel::write(const Problem &problem, const std::string &filename)
+{
+   BinaryModelWriter writer;
+   writeBuffer(writer.encode(problem), filename);
+}
+
+void BinaryModel::write(const Problem &src, const Preprocessor &preproc,
+                        const Problem &dest, const std::string &filename)
+{
+   BinaryModelWriter writer;
+   writeBuffer(writer.encode(src, preproc, dest), filename);
+}
+
+void BinaryModel::writeBuffer(const std::vector<char> &buf, const std::string &filename)
+{
+   std::ofstream os(filename, std::ios::out | std::ios::binary);
+   THROW_IF(!os.is_open(), "Unable to open the binary model file " << filename);
+
+   os.write(buf.data(), buf.size());
+   THROW_IF(!os.good(), "Write error of the binary model file " << filename);
+}
+
+void BinaryModel::read(const std::string &filename, Problem &problem)
+{
+   Scope fixed;
+   read(filename, problem, fixed);
+}
+
+void BinaryModel::read(const std::string &filename, Problem &problem, Scope &fixed)
+{
+   BinaryModelReader reader;
+
+#ifdef REALPAVER_BINARY_MODEL_MMAP
+   int fd = open(filename.c_str(), O_RDONLY);
+   THROW_IF(fd < 0, "Unable to open the binary model file " << filename);
+
+   struct stat st;
+   if (fstat(fd, &st) != 0 || st.st_size == 0)
+   {
+      close(fd);
+      THROW("Bad binary model file " << filename);
+   }
+
+   size_t n = static_cast<size_t>(st.st_size);
+   void *base = mmap(nullptr, n, PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+   THROW_IF(base == MAP_FAILED, "Unable to map the binary model file " << filename);
+
+   try
+   {
+      reader.decode(static_cast<const char *>(base), n, problem);
+   }
+   catch (...)
+   {
+      munmap(base, n);
+      throw;
+   }
+   munmap(base, n);
+#else
+   std::ifstream is(filename, std::ios::in | std::ios::binary | std::ios::ate);
+   THROW_IF(!is.is_open(), "Unable to open the binary model file " << filename);
+
+   std::vector<char> buf(static_cast<size_t>(is.tellg()));
+   is.seekg(0);
+   is.read(buf.data(), buf.size());
+   THROW_IF(!is.good(), "Read error of the binary model file " << filename);
+
+   reader.decode(buf.data(), buf.size(), problem);
+#endif
+
+   fixed = reader.fixedScope();
+}
+
+bool BinaryModel::hasExtension(const std::string &filename)
+{
+   size_t n = filename.size();
+   return n > 4 && filename.compare(n - 4, 4, ".rpb") == 0;
+}
+
+uint64_t BinaryModel::checksum(const char *buf, size_t n)
+{
+   uint64_t h = 14695981039346656037ULL;
+   for (size_t i = 0; i < n; ++i)
+   {
+      h ^= static_cast<uint8_t>(buf[i]);
+      h *= 1099511628211ULL;
+   }
+   return h;
+}
+
+/*----------------------------------------------------------------------------*/
+
+BinaryModelWriter::BinaryModelWriter()
+    : buf_()
+    , vmap_()
+    , tmap_()
+{
+}
+
+const std::vector<char> &BinaryModelWriter::encode(const Problem &problem)
+{
+   encodeAux(problem, nullptr, problem);
+   return buf_;
+}
+
+const std::vector<char> &BinaryModelWriter::encode(const Problem &src,
+                                                   const Preprocessor &preproc,
+                                                   const Problem &dest)
+{
+   encodeAux(src, &preproc, dest);
+   return buf_;
+}
+
+void BinaryModelWriter::encodeAux(const Problem &src, const Preprocessor *preproc,
+                                  const Problem &dest)
+{
+   buf_.clear();
+   vmap_.clear();
+   tmap_.clear();
+
+   // header, the size and the checksum are assigned at the end
+   buf_.insert(buf_.end(), BINARY_MODEL_MAGIC, BINARY_MODEL_MAGIC + 4);
+   uint32_t version = BinaryModel::VERSION;
+   const char *p = reinterpret_cast<const char *>(&version);
+   buf_.insert(buf_.end(), p, p + sizeof(version));
+   putSize(0);
+   putSize(0);
+
+   putStr(src.getName());
+
+   // variables of src in order, the unfixed ones having the domains of their
+   // counterparts in dest
+   putSize(src.nbVars());
+   for (size_t i = 0; i < src.nbVars(); ++i)
+   {
+      Variable v = src.varAt(i);
+      vmap_.insert(std::make_pair(v.id(), i));
+
+      bool fixed = (preproc != nullptr) && preproc->hasFixedDomain(v);
+      putStr(v.getName());
+
+      if (fixed)
+      {
+         std::unique_ptr<Domain> dom(v.getDomain()->clone());
+         dom->contract(preproc->getFixedDomain(v));
+         putDomain(dom.get());
+      }
+      else if (preproc != nullptr)
+         putDomain(preproc->srcToDestVar(v).getDomain());
+      else
+         putDomain(v.getDomain());
+
+      putDbl(v.getTolerance().getRelTol());
+      putDbl(v.getTolerance().getAbsTol());
+      putByte(src.isVarReported(v) ? 1 : 0);
+      putByte(fixed ? 1 : 0);
+   }
+
+   // aliases of src
+   putSize(src.nbAliases());
+   for (size_t i = 0; i < src.nbAliases(); ++i)
+   {
+      Alias a = src.aliasAt(i);
+      putStr(a.name());
+      putTerm(a.term());
+      putByte(src.isAliasReported(a) ? 1 : 0);
+   }
+
+   // the variables of dest are encoded as their counterparts in src
+   if (preproc != nullptr)
+   {
+      vmap_.clear();
+      for (size_t i = 0; i < src.nbVars(); ++i)
+      {
+         Variable v = src.varAt(i);
+         if (!preproc->hasFixedDomain(v))
+            vmap_.insert(std::make_pair(preproc->srcToDestVar(v).id(), i));
+      }
+   }
+
+   // constraints of dest
+   putSize(dest.nbCtrs());
+   for (size_t i = 0; i < dest.nbCtrs(); ++i)
+      putCtr(dest.ctrAt(i));
+
+   // objective of dest
+   if (dest.hasObjective())
+   {
+      Objective obj = dest.getObjective();
+      putByte(obj.isMinimization() ? 1 : 2);
+      putTerm(obj.getTerm());
+   }
+   else
+      putByte(0);
+
+   // completes the header
+   uint64_t size = buf_.size() - BINARY_MODEL_HEADER;
+   uint64_t sum = BinaryModel::checksum(buf_.data() + BINARY_MODEL_HEADER, size);
+   size_t pos = 4 + sizeof(uint32_t);
+   std::memcpy(buf_.data() + pos, &size, sizeof(size));
+   std::memcpy(buf_.data() + pos + sizeof(size), &sum, sizeof(sum));
+}
+
+void BinaryModelWriter::putByte(uint8_t b)
+{
+   buf_.push_back(static_cast<char>(b));
+}
+
+void BinaryModelWriter::putInt(int64_t n)
+{
+   const char *p = reinterpret_cast<const char *>(&n);
+   buf_.insert(buf_.end(), p, p + sizeof(n));
+}
+
+void BinaryModelWriter::putSize(uint64_t n)
+{
+   const char *p = reinterpret_cast<const char *>(&n);
+   buf_.insert(buf_.end(), p, p + sizeof(n));
+}
+
+void BinaryModelWriter::putDbl(double a)
+{
+   const char *p = reinterpret_cast<const char *>(&a);
+   buf_.insert(buf_.end(), p, p + sizeof(a));
+}
+
+void BinaryModelWriter::putStr(const std::string &s)
+{
+   putSize(s.size());
+   buf_.insert(buf_.end(), s.begin(), s.end());
+}
+
+void BinaryModelWriter::putInterval(const Interval &x)
+{
+   putByte(x.isEmpty() ? 1 : 0);
+   putDbl(x.isEmpty() ? 0.0 : x.left());
+   putDbl(x.isEmpty() ? 0.0 : x.right());
+}
+
+void BinaryModelWriter::putVar(const Variable &v)
+{
+   auto it = vmap_.find(v.id());
+   THROW_IF(it == vmap_.end(),
+            "Variable " << v.getName() << " not in the problem's scope");
+   putSize(it->second);
+}
+
+void BinaryModelWriter::putDomain(const Domain *dom)
+{
+   DomainType type = dom->type();
+   putByte(static_cast<uint8_t>(type));
+
+   switch (type)
+   {
+   case DomainType::Binary:
+   {
+      ZeroOne zo = static_cast<const BinaryDomain *>(dom)->getVal();
+      putByte((zo.isZero() || zo.isUniverse()) ? 1 : 0);
+      putByte((zo.isOne() || zo.isUniverse()) ? 1 : 0);
+      break;
+   }
+   case DomainType::Interval:
+      putInterval(static_cast<const IntervalDomain *>(dom)->getVal());
+      break;
+
+   case DomainType::IntervalUnion:
+   {
+      const IntervalUnion &u = static_cast<const IntervalUnionDomain *>(dom)->getVal();
+      putSize(u.size());
+      for (size_t i = 0; i < u.size(); ++i)
+         putInterval(u[i]);
+      break;
+   }
+   case DomainType::Range:
+   {
+      const Range &r = static_cast<const RangeDomain *>(dom)->getVal();
+      putInt(r.left().get());
+      putInt(r.right().get());
+      break;
+   }
+   case DomainType::RangeUnion:
+   {
+      const RangeUnion &u = static_cast<const RangeUnionDomain *>(dom)->getVal();
+      putSize(u.size());
+      for (size_t i = 0; i < u.size(); ++i)
+      {
+         putInt(u[i].left().get());
+         putInt(u[i].right().get());
+      }
+      break;
+   }
+   }
+}
+
+void BinaryModelWriter::putNodes(const TermRep *t, std::vector<const TermRep *> &nodes)
+{
+   if (tmap_.find(t) != tmap_.end())
+      return;
+
+   if (t->symbol() != TermSymbol::Cst && t->symbol() != TermSymbol::Var)
+   {
+      const TermOp *op = static_cast<const TermOp *>(t);
+      for (size_t i = 0; i < op->arity(); ++i)
+         putNodes(op->subTerm(i).get(), nodes);
+   }
+
+   tmap_.insert(std::make_pair(t, tmap_.size()));
+   nodes.push_back(t);
+}
+
+void BinaryModelWriter::putTerm(const Term &t)
+{
+   std::vector<const TermRep *> nodes;
+   putNodes(t.rep().get(), nodes);
+
+   // the new nodes, each one refers to sub-terms already encoded
+   putSize(nodes.size());
+   for (const TermRep *node : nodes)
+   {
+      TermSymbol symb = node->symbol();
+      putByte(static_cast<uint8_t>(symb));
+
+      if (symb == TermSymbol::Cst)
+      {
+         putInterval(static_cast<const TermCst *>(node)->getVal());
+      }
+      else if (symb == TermSymbol::Var)
+      {
+         putVar(static_cast<const TermVar *>(node)->var());
+      }
+      else
+      {
+         const TermOp *op = static_cast<const TermOp *>(node);
+         putSize(op->arity());
+         for (size_t i = 0; i < op->arity(); ++i)
+            putSize(tmap_[op->subTerm(i).get()]);
+
+         if (symb == TermSymbol::Pow)
+            putInt(static_cast<const TermPow *>(node)->exponent());
+      }
+   }
+
+   // the root
+   putSize(tmap_[t.rep().get()]);
+}
+
+void BinaryModelWriter::putCtr(const Constraint &c)
+{
+   RelSymbol rel = c.relSymbol();
+   putByte(static_cast<uint8_t>(rel));
+
+   switch (rel)
+   {
+   case RelSymbol::Eq:
+   case RelSymbol::Le:
+   case RelSymbol::Lt:
+   case RelSymbol::Ge:
+   case RelSymbol::Gt:
+   {
+      ArithCtrBinary *rep = static_cast<ArithCtrBinary *>(c.rep().get());
+      putTerm(rep->left());
+      putTerm(rep->right());
+      break;
+   }
+   case RelSymbol::In:
+   {
+      ArithCtrIn *rep = static_cast<ArithCtrIn *>(c.rep().get());
+      putTerm(rep->term());
+      putInterval(rep->image());
+      break;
+   }
+   case RelSymbol::Table:
+   {
+      TableCtr *rep = static_cast<TableCtr *>(c.rep().get());
+      putSize(rep->nbCols());
+      putSize(rep->nbRows());
+      for (size_t j = 0; j < rep->nbCols(); ++j)
+      {
+         putVar(rep->getVar(j));
+         for (size_t i = 0; i < rep->nbRows(); ++i)
+            putInterval(rep->getVal(i, j));
+      }
+      break;
+   }
+   case RelSymbol::Cond:
+   {
+      CondCtr *rep = static_cast<CondCtr *>(c.rep().get());
+      putCtr(rep->guard());
+      putCtr(rep->body());
+      break;
+   }
+   case RelSymbol::Piecewise:
+   {
+      PiecewiseCtr *rep = static_cast<PiecewiseCtr *>(c.rep().get());
+      putVar(rep->variable());
+      putSize(rep->nb_pieces());
+      for (size_t i = 0; i < rep->nb_pieces(); ++i)
+      {
+         putVar(rep->binary(i));
+         putInterval(rep->interval(i));
+         putCtr(rep->constraint(i));
+      }
+      break;
+   }
+   }
+}
+
+/*----------------------------------------------------------------------------*/
+
+BinaryModelReader::BinaryModelReader()
+    : cur_(nullptr)
+    , end_(nullptr)
+    , vars_()
+    , nodes_()
+    , fixed_()
+{
+}
+
+void BinaryModelReader::decode(const char *buf, size_t n, Problem &problem)
+{
+   vars_.clear();
+   nodes_.clear();
+   fixed_ = Scope();
+
+   // header
+   THROW_IF(n < BINARY_MODEL_HEADER || std::memcmp(buf, BINARY_MODEL_MAGIC, 4) != 0,
+            "Not a binary model");
+
+   uint32_t version;
+   uint64_t size, sum;
+   size_t pos = 4;
+   std::memcpy(&version, buf + pos, sizeof(version));
+   pos += sizeof(version);
+   std::memcpy(&size, buf + pos, sizeof(size));
+   pos += sizeof(size);
+   std::memcpy(&sum, buf + pos, sizeof(sum));
+
+   THROW_IF(version != BinaryModel::VERSION,
+            "Bad version of binary model: " << version << " (expected "
+                                            << BinaryModel::VERSION << ")");
+
+   THROW_IF(size != n - BINARY_MODEL_HEADER, "Truncated binary model");
+
+   cur_ = buf + BINARY_MODEL_HEADER;
+   end_ = cur_ + size;
+   THROW_IF(BinaryModel::checksum(cur_, size) != sum, "Bad checksum of binary model");
+
+   problem.setName(getStr());
+
+   // variables
+   size_t nv = getSize();
+   std::vector<bool> reported;
+   for (size_t i = 0; i < nv; ++i)
+   {
+      std::string name = getStr();
+      std::unique_ptr<Domain> dom = getDomain();
+      double rtol = getDbl();
+      double atol = getDbl();
+
+      Variable v = problem.addVar(name);
+      v.setDomain(std::move(dom)).setTolerance(Tolerance(rtol, atol));
+      vars_.push_back(v);
+      reported.push_back(getByte() == 1);
+
+      if (getByte() == 1)
+         fixed_.insert(v);
+   }
+
+   // aliases
+   size_t na = getSize();
+   std::vector<std::pair<Alias, bool>> aliases;
+   for (size_t i = 0; i < na; ++i)
+   {
+      std::string name = getStr();
+      Term t = getTerm();
+      Alias a(name, t);
+      problem.addAlias(a);
+      aliases.push_back(std::make_pair(a, getByte() == 1));
+   }
+
+   // reporting flags once all the entities are created
+   for (size_t i = 0; i < nv; ++i)
+      problem.reportVariable(vars_[i], reported[i]);
+
+   for (auto &p : aliases)
+      problem.reportAlias(p.first, p.second);
+
+   // constraints
+   size_t nc = getSize();
+   for (size_t i = 0; i < nc; ++i)
+      problem.addCtr(getCtr());
+
+   // objective
+   uint8_t kind = getByte();
+   if (kind != 0)
+   {
+      Term f = getTerm();
+      problem.addObjective(kind == 1 ? MIN(f) : MAX(f));
+   }
+
+   THROW_IF(cur_ != end_, "Bad binary model: trailing bytes");
+}
+
+Scope BinaryModelReader::fixedScope() const
+{
+   return fixed_;
+}
+
+void BinaryModelReader::check(size_t n) const
+{
+   THROW_IF(static_cast<size_t>(end_ - cur_) < n, "Bad binary model: unexpected end");
+}
+
+uint8_t BinaryModelReader::getByte()
+{
+   check(1);
+   return static_cast<uint8_t>(*cur_++);
+}
+
+int64_t BinaryModelReader::getInt()
+{
+   int64_t n;
+   check(sizeof(n));
+   std::memcpy(&n, cur_, sizeof(n));
+   cur_ += sizeof(n);
+   return n;
+}
+
+uint64_t BinaryModelReader::getSize()
+{
+   uint64_t n;
+   check(sizeof(n));
+   std::memcpy(&n, cur_, sizeof(n));
+   cur_ += sizeof(n);
+   return n;
+}
+
+double BinaryModelReader::getDbl()
+{
+   double a;
+   check(sizeof(a));
+   std::memcpy(&a, cur_, sizeof(a));
+   cur_ += sizeof(a);
+   return a;
+}
+
+std::string BinaryModelReader::getStr()
+{
+   size_t n = getSize();
+   check(n);
+   std::string s(cur_, n);
+   cur_ += n;
+   return s;
+}
+
+Interval BinaryModelReader::getInterval()
+{
+   bool empty = getByte() == 1;
+   double l = getDbl();
+   double r = getDbl();
+   return empty ? Interval::emptyset() : Interval(l, r);
+}
+
+Variable BinaryModelReader::getVar()
+{
+   size_t i = getSize();
+   THROW_IF(i >= vars_.size(), "Bad binary model: variable index " << i);
+   return vars_[i];
+}
+
+std::unique_ptr<Domain> BinaryModelReader::getDomain()
+{
+   uint8_t type = getByte();
+
+   switch (static_cast<DomainType>(type))
+   {
+   case DomainType::Binary:
+   {
+      bool zro = getByte() == 1;
+      bool one = getByte() == 1;
+      return std::make_unique<BinaryDomain>(ZeroOne(zro, one));
+   }
+   case DomainType::Interval:
+      return std::make_unique<IntervalDomain>(getInterval());
+
+   case DomainType::IntervalUnion:
+   {
+      IntervalUnion u;
+      size_t n = getSize();
+      for (size_t i = 0; i < n; ++i)
+         u.insert(getInterval());
+      return std::make_unique<IntervalUnionDomain>(u);
+   }
+   case DomainType::Range:
+   {
+      Integer::ValueType a = getInt();
+      Integer::ValueType b = getInt();
+      return std::make_unique<RangeDomain>(Range(Integer(a), Integer(b)));
+   }
+   case DomainType::RangeUnion:
+   {
+      RangeUnion u;
+      size_t n = getSize();
+      for (size_t i = 0; i < n; ++i)
+      {
+         Integer::ValueType a = getInt();
+         Integer::ValueType b = getInt();
+         u.insert(Range(Integer(a), Integer(b)));
+      }
+      return std::make_unique<RangeUnionDomain>(u);
+   }
+   }
+
+   THROW("Bad binary model: domain type " << static_cast<int>(type));
+}
+
+// returns the number of sub-terms of an operation symbol, 0 if the symbol is
+// not an operation symbol
+static size_t binaryModelArity(TermSymbol symb)
+{
+   switch (symb)
+   {
+   case TermSymbol::Add:
+   case TermSymbol::Sub:
+   case TermSymbol::Mul:
+   case TermSymbol::Div:
+   case TermSymbol::Min:
+   case TermSymbol::Max:
+      return 2;
+   case TermSymbol::Usb:
+   case TermSymbol::Abs:
+   case TermSymbol::Sgn:
+   case TermSymbol::Sqr:
+   case TermSymbol::Sqrt:
+   case TermSymbol::Pow:
+   case TermSymbol::Exp:
+   case TermSymbol::Log:
+   case TermSymbol::Cos:
+   case TermSymbol::Sin:
+   case TermSymbol::Tan:
+   case TermSymbol::Cosh:
+   case TermSymbol::Sinh:
+   case TermSymbol::Tanh:
+      return 1;
+   default:
+      return 0;
+   }
+}
+
+Term BinaryModelReader::getTerm()
+{
+   size_t n = getSize();
+   for (size_t k = 0; k < n; ++k)
+   {
+      TermSymbol symb = static_cast<TermSymbol>(getByte());
+      Term::SharedRep rep;
+
+      if (symb == TermSymbol::Cst)
+      {
+         rep = std::make_shared<TermCst>(getInterval());
+      }
+      else if (symb == TermSymbol::Var)
+      {
+         rep = std::make_shared<TermVar>(getVar());
+      }
+      else
+      {
+         size_t expected = binaryModelArity(symb);
+         THROW_IF(expected == 0, "Bad binary model: term symbol " << static_cast<int>(symb));
+
+         size_t arity = getSize();
+         THROW_IF(arity != expected,
+                  "Bad binary model: arity " << arity << " instead of " << expected);
+
+         Term::SharedRep sub[2];
+         for (size_t i = 0; i < arity; ++i)
+         {
+            size_t j = getSize();
+            THROW_IF(j >= nodes_.size(), "Bad binary model: node index " << j);
+            sub[i] = nodes_[j];
+         }
+
+         switch (symb)
+         {
+         case TermSymbol::Add:
+            rep = std::make_shared<TermAdd>(sub[0], sub[1]);
+            break;
+         case TermSymbol::Sub:
+            rep = std::make_shared<TermSub>(sub[0], sub[1]);
+            break;
+         case TermSymbol::Mul:
+            rep = std::make_shared<TermMul>(sub[0], sub[1]);
+            break;
+         case TermSymbol::Div:
+            rep = std::make_shared<TermDiv>(sub[0], sub[1]);
+            break;
+         case TermSymbol::Min:
+            rep = std::make_shared<TermMin>(sub[0], sub[1]);
+            break;
+         case TermSymbol::Max:
+            rep = std::make_shared<TermMax>(sub[0], sub[1]);
+            break;
+         case TermSymbol::Usb:
+            rep = std::make_shared<TermUsb>(sub[0]);
+            break;
+         case TermSymbol::Abs:
+            rep = std::make_shared<TermAbs>(sub[0]);
+            break;
+         case TermSymbol::Sgn:
+            rep = std::make_shared<TermSgn>(sub[0]);
+            break;
+         case TermSymbol::Sqr:
+            rep = std::make_shared<TermSqr>(sub[0]);
+            break;
+         case TermSymbol::Sqrt:
+            rep = std::make_shared<TermSqrt>(sub[0]);
+            break;
+         case TermSymbol::Pow:
+            rep = std::make_shared<TermPow>(sub[0], static_cast<int>(getInt()));
+            break;
+         case TermSymbol::Exp:
+            rep = std::make_shared<TermExp>(sub[0]);
+            break;
+         case TermSymbol::Log:
+            rep = std::make_shared<TermLog>(sub[0]);
+            break;
+         case TermSymbol::Cos:
+            rep = std::make_shared<TermCos>(sub[0]);
+            break;
+         case TermSymbol::Sin:
+            rep = std::make_shared<TermSin>(sub[0]);
+            break;
+         case TermSymbol::Tan:
+            rep = std::make_shared<TermTan>(sub[0]);
+            break;
+         case TermSymbol::Cosh:
+            rep = std::make_shared<TermCosh>(sub[0]);
+            break;
+         case TermSymbol::Sinh:
+            rep = std::make_shared<TermSinh>(sub[0]);
+            break;
+         case TermSymbol::Tanh:
+            rep = std::make_shared<TermTanh>(sub[0]);
+            break;
+         default:
+            THROW("Bad binary model: term symbol " << static_cast<int>(symb));
+         }
+      }
+
+      nodes_.push_back(rep);
+   }
+
+   size_t root = getSize();
+   THROW_IF(root >= nodes_.size(), "Bad binary model: node index " << root);
+   return Term(nodes_[root]);
+}
+
+Constraint BinaryModelReader::getCtr()
+{
+   RelSymbol rel = static_cast<RelSymbol>(getByte());
+
+   switch (rel)
+   {
+   case RelSymbol::Eq:
+   {
+      Term l = getTerm(), r = getTerm();
+      return Constraint(std::make_shared<ArithCtrEq>(l, r));
+   }
+   case RelSymbol::Le:
+   {
+      Term l = getTerm(), r = getTerm();
+      return Constraint(std::make_shared<ArithCtrLe>(l, r));
+   }
+   case RelSymbol::Lt:
+   {
+      Term l = getTerm(), r = getTerm();
+      return Constraint(std::make_shared<ArithCtrLt>(l, r));
+   }
+   case RelSymbol::Ge:
+   {
+      Term l = getTerm(), r = getTerm();
+      return Constraint(std::make_shared<ArithCtrGe>(l, r));
+   }
+   case RelSymbol::Gt:
+   {
+      Term l = getTerm(), r = getTerm();
+      return Constraint(std::make_shared<ArithCtrGt>(l, r));
+   }
+   case RelSymbol::In:
+   {
+      Term t = getTerm();
+      Interval x = getInterval();
+      return Constraint(std::make_shared<ArithCtrIn>(t, x));
+   }
+   case RelSymbol::Table:
+   {
+      std::shared_ptr<TableCtr> rep = std::make_shared<TableCtr>();
+      size_t ncols = getSize();
+      size_t nrows = getSize();
+      for (size_t j = 0; j < ncols; ++j)
+      {
+         TableCtrCol col(getVar());
+         for (size_t i = 0; i < nrows; ++i)
+            col.addValue(getInterval());
+         rep->addCol(col);
+      }
+      return Constraint(rep);
+   }
+   case RelSymbol::Cond:
+   {
+      Constraint guard = getCtr();
+      Constraint body = getCtr();
+      return Constraint(std::make_shared<CondCtr>(guard, body));
+   }
+   case RelSymbol::Piecewise:
+   {
+      Variable v = getVar();
+      size_t n = getSize();
+      std::vector<Variable> bins;
+      std::vector<Interval> ivs;
+      std::vector<Constraint> ctrs;
+      for (size_t i = 0; i < n; ++i)
+      {
+         bins.push_back(getVar());
+         ivs.push_back(getInterval());
+         ctrs.push_back(getCtr());
+      }
+      return piecewise(v, bins, ivs, ctrs);
+   }
+   }
+
+   THROW("Bad binary model: relation symbol " << static_cast<int>(rel));
+}
+
+} // namespace realpaver
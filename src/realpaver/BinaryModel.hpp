@@ -0,0 +1,184 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   BinaryModel.hpp
+ * @brief  Binary serialization of problems
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#ifndef REALPAVER_BINARY_MODEL_HPP
+#define REALPAVER_BINARY_MODEL_HPP
+
+#include "realpaver/Preprocessor.hpp"
+#include "realpaver/Problem.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace realpaver {
+
+/**
+ * @brief Binary format of problems.
+ *
+ * A binary model is a header followed by a payload. The header contains the
+ * magic string "RPBM", the version of the format, the size of the payload in
+ * bytes and a FNV-1a checksum of the payload. Numbers are stored in the byte
+ * order of the host.
+ *
+ * The payload contains the name of the problem, the variables with their
+ * domains, tolerances, reporting flags and fixing flags, the aliases, the
+ * constraints and the objective function. The nodes of the terms are stored
+ * once in a global table in post-order, hence the sub-terms shared in memory
+ * are shared in the file and restored as shared sub-terms.
+ *
+ * A binary model can be written after preprocessing and read back in order
+ * to bypass the parser. The variables of the input problem are all stored in
+ * their order. The ones fixed by the preprocessor are flagged as fixed and
+ * stored with their fixed domains, and they do not occur in the constraints,
+ * which are the simplified constraints resulting from the preprocessing.
+ *
+ * The format is a cache at the level of terms. Reading a binary model saves
+ * the parsing of the problem and its preprocessing, i.e. the propagation, the
+ * detection of the fixed variables and of the inactive constraints and the
+ * rewriting of the constraints. The DAG, the functions and the flat functions
+ * are not stored: they are built from the constraints when the problem is
+ * solved, as for a problem read from a text file.
+ */
+class BinaryModel {
+public:
+   /// Version of the format
+   static const uint32_t VERSION;
+
+   /// Writes a problem in a file
+   static void write(const Problem &problem, const std::string &filename);
+
+   /**
+    * @brief Writes a preprocessed problem in a file.
+    *
+    * @param src input problem of the preprocessor
+    * @param preproc preprocessor applied to src
+    * @param dest simplified problem resulting from the preprocessing
+    * @param filename output file
+    */
+   static void write(const Problem &src, const Preprocessor &preproc,
+                     const Problem &dest, const std::string &filename);
+
+   /// Reads a problem from a file, throws an exception in case of failure
+   static void read(const std::string &filename, Problem &problem);
+
+   /**
+    * @brief Reads a problem from a file.
+    *
+    * Assigns fixed to the set of variables fixed by the preprocessor before
+    * writing the problem. Throws an exception in case of failure.
+    */
+   static void read(const std::string &filename, Problem &problem, Scope &fixed);
+
+   /// Returns true if filename has the extension of binary models (.rpb)
+   static bool hasExtension(const std::string &filename);
+
+   /// Returns the FNV-1a 64-bit hash code of n bytes
+   static uint64_t checksum(const char *buf, size_t n);
+
+private:
+   // writes a buffer in a file
+   static void writeBuffer(const std::vector<char> &buf, const std::string &filename);
+};
+
+/*----------------------------------------------------------------------------*/
+
+/// Encoder of a problem in a memory buffer
+class BinaryModelWriter {
+public:
+   /// Constructor
+   BinaryModelWriter();
+
+   /// Encodes a problem and returns the buffer including the header
+   const std::vector<char> &encode(const Problem &problem);
+
+   /// Encodes a preprocessed problem and returns the buffer including the header
+   const std::vector<char> &encode(const Problem &src, const Preprocessor &preproc,
+                                   const Problem &dest);
+
+private:
+   std::vector<char> buf_;                            // output buffer
+   std::unordered_map<size_t, size_t> vmap_;          // variable id -> index
+   std::unordered_map<const TermRep *, size_t> tmap_; // node -> index
+
+   void putByte(uint8_t b);
+   void putInt(int64_t n);
+   void putSize(uint64_t n);
+   void putDbl(double a);
+   void putStr(const std::string &s);
+   void putInterval(const Interval &x);
+   void putVar(const Variable &v);
+   void putDomain(const Domain *dom);
+   void putTerm(const Term &t);
+   void putCtr(const Constraint &c);
+
+   // appends the nodes of t not yet encoded in post-order
+   void putNodes(const TermRep *t, std::vector<const TermRep *> &nodes);
+
+   // encodes the variables and the aliases of src and the constraints and
+   // the objective of dest, preproc being null if src and dest are equal
+   void encodeAux(const Problem &src, const Preprocessor *preproc, const Problem &dest);
+};
+
+/*----------------------------------------------------------------------------*/
+
+/// Decoder of a problem from a memory buffer
+class BinaryModelReader {
+public:
+   /// Constructor
+   BinaryModelReader();
+
+   /**
+    * @brief Decodes a problem.
+    *
+    * @param buf input buffer including the header
+    * @param n size of the buffer in bytes
+    * @param problem output problem
+    *
+    * Throws an exception if the buffer is not a valid binary model.
+    */
+   void decode(const char *buf, size_t n, Problem &problem);
+
+   /// Returns the set of fixed variables of the last decoded problem
+   Scope fixedScope() const;
+
+private:
+   const char *cur_;                    // current position in the payload
+   const char *end_;                    // end of the payload
+   std::vector<Variable> vars_;         // decoded variables
+   std::vector<Term::SharedRep> nodes_; // decoded nodes of terms
+   Scope fixed_;                        // decoded fixed variables
+
+   void check(size_t n) const;
+   uint8_t getByte();
+   int64_t getInt();
+   uint64_t getSize();
+   double getDbl();
+   std::string getStr();
+   Interval getInterval();
+   Variable getVar();
+   std::unique_ptr<Domain> getDomain();
+   Term getTerm();
+   Constraint getCtr();
+};
+
+} // namespace realpaver
+
+#endif
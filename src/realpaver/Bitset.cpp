@@ -22,6 +22,7 @@
 #include "realpaver/AssertDebug.hpp"
 #include "realpaver/Common.hpp"
 #include <algorithm>
+#include <bitset>
 
 namespace realpaver {
 
@@ -231,24 +232,57 @@ void Bitset::flipAll()
    keepShadowBits();
 }
 
-size_t Bitset::nbZeros() const
+size_t Bitset::popCount(word_t w)
 {
-   size_t nb = 0;
+   return std::bitset<BITS_PER_WORD>(w).count();
+}
+
+size_t Bitset::lowestOne(word_t w)
+{
+#if defined(__GNUC__) || defined(__clang__)
+   return (size_t)__builtin_ctzll((unsigned long long)w);
+#else
+   size_t k = 0;
+   while ((w & word_t(1)) == 0)
+   {
+      w >>= 1;
+      ++k;
+   }
+   return k;
+#endif
+}
 
-   for (size_t i = 0; i < size_; ++i)
-      if (!get(i))
-         ++nb;
+Bitset::word_t Bitset::extract(int i) const
+{
+   long j = (long)i - (long)first_;
 
-   return nb;
+   if (j >= (long)size_ || j <= -(long)BITS_PER_WORD)
+      return 0;
+
+   // the first bits of the result are out of this
+   if (j < 0)
+      return word_[0] << (-j);
+
+   size_t w = bitIndex(j), o = bitOffset(j);
+   word_t res = word_[w] >> o;
+
+   if (o > 0 && w + 1 < wcount_)
+      res |= word_[w + 1] << (BITS_PER_WORD - o);
+
+   return res;
+}
+
+size_t Bitset::nbZeros() const
+{
+   return size_ - nbOnes();
 }
 
 size_t Bitset::nbOnes() const
 {
    size_t nb = 0;
 
-   for (size_t i = 0; i < size_; ++i)
-      if (get(i))
-         ++nb;
+   for (size_t i = 0; i < wcount_; ++i)
+      nb += popCount(word_[i]);
 
    return nb;
 }
@@ -281,6 +315,39 @@ bool Bitset::areAllZeros() const
    return true;
 }
 
+int Bitset::findFirst() const
+{
+   for (size_t i = 0; i < wcount_; ++i)
+      if (word_[i] != 0)
+         return first_ + (int)(i * BITS_PER_WORD + lowestOne(word_[i]));
+
+   return last_ + 1;
+}
+
+int Bitset::findNext(int i) const
+{
+   if (i < first_)
+      return findFirst();
+
+   if (i >= last_)
+      return last_ + 1;
+
+   size_t j = 1 + (size_t)(i - first_), w = bitIndex(j);
+
+   // bits of the current word after the i-th bit
+   word_t x = word_[w] & (~word_t(0) << bitOffset(j));
+
+   while (x == 0)
+   {
+      if (++w == wcount_)
+         return last_ + 1;
+
+      x = word_[w];
+   }
+
+   return first_ + (int)(w * BITS_PER_WORD + lowestOne(x));
+}
+
 void Bitset::print(std::ostream &os) const
 {
    if (size_ == 0)
@@ -315,7 +382,7 @@ bool Bitset::overlaps(const Bitset &other) const
    if (size_ == 0 || other.size_ == 0)
       return false;
 
-   if (first_ == other.first_ && last_ == other.last_)
+   if (isAligned(other))
    {
       for (size_t i = 0; i < wcount_; ++i)
          if (word_[i] & other.word_[i])
@@ -325,11 +392,12 @@ bool Bitset::overlaps(const Bitset &other) const
    }
    else
    {
-      // interval of indexes of common bits
+      // interval of indexes of common bits, the bits out of this interval
+      // being equal to 0 in one bitset at least
       int p = std::max(first_, other.first_), q = std::min(last_, other.last_);
 
-      for (int i = p; i <= q; ++i)
-         if (get(i) && other.get(i))
+      for (int i = p; i <= q; i += (int)BITS_PER_WORD)
+         if (extract(i) & other.extract(i))
             return true;
 
       return false;
@@ -344,7 +412,7 @@ Bitset &Bitset::operator&=(const Bitset &other)
       return *this = aux;
    }
 
-   if (first_ == other.first_ && last_ == other.last_)
+   if (isAligned(other))
    {
       for (size_t i = 0; i < wcount_; ++i)
          word_[i] &= other.word_[i];
@@ -362,13 +430,14 @@ Bitset &Bitset::operator&=(const Bitset &other)
    }
 
    Bitset aux(p, q);
-   aux.setAllZero();
 
-   for (int i = p; i <= q; ++i)
-      if (get(i) && other.get(i))
-         aux.setOne(i);
+   for (size_t i = 0; i < aux.wcount_; ++i)
+   {
+      int k = p + (int)(i * BITS_PER_WORD);
+      aux.word_[i] = extract(k) & other.extract(k);
+   }
 
-   return *this = aux;
+   return *this = std::move(aux);
 }
 
 Bitset &Bitset::operator|=(const Bitset &other)
@@ -378,7 +447,7 @@ Bitset &Bitset::operator|=(const Bitset &other)
    if (size_ == 0)
       return *this = other;
 
-   if (first_ == other.first_ && last_ == other.last_)
+   if (isAligned(other))
    {
       for (size_t i = 0; i < wcount_; ++i)
          word_[i] |= other.word_[i];
@@ -389,20 +458,33 @@ Bitset &Bitset::operator|=(const Bitset &other)
    int p = std::min(first_, other.first_), q = std::max(last_, other.last_);
 
    Bitset aux(p, q);
-   aux.setAllZero();
 
-   for (int i = p; i <= q; ++i)
+   for (size_t i = 0; i < aux.wcount_; ++i)
    {
-      bool b = false;
-      if (i >= first_ && i <= last_ && get(i))
-         b = true;
-      if (i >= other.first_ && i <= other.last_ && other.get(i))
-         b = true;
-      if (b)
-         aux.setOne(i);
+      int k = p + (int)(i * BITS_PER_WORD);
+      aux.word_[i] = extract(k) | other.extract(k);
    }
 
-   return *this = aux;
+   return *this = std::move(aux);
+}
+
+Bitset &Bitset::andNot(const Bitset &other)
+{
+   if (size_ == 0 || other.size_ == 0)
+      return *this;
+
+   if (isAligned(other))
+   {
+      for (size_t i = 0; i < wcount_; ++i)
+         word_[i] &= ~other.word_[i];
+   }
+   else
+   {
+      for (size_t i = 0; i < wcount_; ++i)
+         word_[i] &= ~other.extract(first_ + (int)(i * BITS_PER_WORD));
+   }
+
+   return *this;
 }
 
 Bitset operator&(const Bitset &b1, const Bitset &b2)
@@ -30,6 +30,14 @@ namespace realpaver {
  *
  * The number of bits is fixed at runtime when an object is created. The bit
  * indexes are positive integers and the first index may be different from 0.
+ *
+ * The bits are stored in machine words and the bitwise operations, the
+ * population counts and the searches of bits equal to 1 are implemented
+ * word by word, including for two bitsets having different ranges of indexes.
+ * The bits equal to 1 can be enumerated as follows:
+ * @code
+ * for (int i = b.findFirst(); i <= b.last(); i = b.findNext(i)) ...
+ * @endcode
  */
 class Bitset {
 public:
@@ -105,6 +113,12 @@ public:
    /// Returns true if all the bits are equal to 0
    bool areAllZeros() const;
 
+   /// Returns the index of the first bit equal to 1, last()+1 if there is none
+   int findFirst() const;
+
+   /// Returns the index of the first bit equal to 1 after the i-th bit, last()+1 if there is none
+   int findNext(int i) const;
+
    /// Output on a stream
    void print(std::ostream &os) const;
 
@@ -120,6 +134,9 @@ public:
    /// Bitwise OR with assignment
    Bitset &operator|=(const Bitset &other);
 
+   /// Assigns to 0 every bit of this equal to 1 in other
+   Bitset &andNot(const Bitset &other);
+
    friend Bitset operator&(const Bitset &b1, const Bitset &b2);
    friend Bitset operator|(const Bitset &b1, const Bitset &b2);
    friend Bitset operator~(const Bitset &b);
@@ -158,6 +175,22 @@ private:
    // assigns the last irrelevant bits in the last word to 0
    void keepShadowBits();
 
+   // returns the word made of the bits of indexes i, i+1, ..., i+k-1 where k
+   // is the number of bits in a word, a bit out of this being equal to 0
+   word_t extract(int i) const;
+
+   // returns true if this and other have the same range of indexes
+   bool isAligned(const Bitset &other) const
+   {
+      return first_ == other.first_ && last_ == other.last_;
+   }
+
+   // returns the number of bits equal to 1 in w
+   static size_t popCount(word_t w);
+
+   // returns the position of the least significant bit equal to 1 in w != 0
+   static size_t lowestOne(word_t w);
+
    // used by keepShadowBits
    word_t shadow_word_;
 };
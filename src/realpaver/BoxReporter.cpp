@@ -154,6 +154,15 @@ BoxReporter::~BoxReporter()
 {
 }
 
+void BoxReporter::start()
+{
+}
+
+void BoxReporter::report(const DomainBox &box, Proof proof)
+{
+   report(box);
+}
+
 void BoxReporter::addVariable(Variable v)
 {
    ents_.addVariable(v);
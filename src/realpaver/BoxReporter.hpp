@@ -22,6 +22,7 @@
 #define REALPAVER_BOX_REPORTER_HPP
 
 #include "realpaver/Alias.hpp"
+#include "realpaver/Common.hpp"
 #include "realpaver/DomainBox.hpp"
 #include "realpaver/Variable.hpp"
 #include <iostream>
@@ -180,9 +181,16 @@ public:
    /// Returns the length of the longest name in this
    size_t maxNameLength() const;
 
+   /// Starts the report of a sequence of boxes, does nothing by default
+   virtual void start();
+
    /// Abstract reporting method
    virtual void report(const DomainBox &box) = 0;
 
+   /// Reporting method of a box with its proof certificate, which is ignored
+   /// by default
+   virtual void report(const DomainBox &box, Proof proof);
+
 protected:
    EntityReportedVector ents_; // vector of entities
 };
@@ -0,0 +1,378 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   CSPDecomposition.cpp
+ * @brief  Decomposition of CSPs into independent sub-problems
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#include "realpaver/AssertDebug.hpp"
+#include "realpaver/CSPDecomposition.hpp"
+#include "realpaver/CSPSolver.hpp"
+#include "realpaver/ConstraintFixer.hpp"
+#include "realpaver/Parallel.hpp"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <mutex>
+#include <numeric>
+
+namespace realpaver {
+
+CSPDecomposition::CSPDecomposition(const Problem &problem)
+    : scop_(problem.scope())
+    , comp_()
+{
+   size_t n = scop_.size();
+
+   // union-find structure over the variables
+   std::vector<size_t> parent(n);
+   std::iota(parent.begin(), parent.end(), 0);
+
+   auto find = [&](size_t i)
+   {
+      while (parent[i] != i)
+      {
+         parent[i] = parent[parent[i]];
+         i = parent[i];
+      }
+      return i;
+   };
+
+   for (size_t i = 0; i < problem.nbCtrs(); ++i)
+   {
+      Scope sco = problem.ctrAt(i).scope();
+      if (sco.size() == 0)
+         continue;
+
+      size_t r = find(scop_.index(sco.var(0)));
+      for (const auto &v : sco)
+      {
+         size_t s = find(scop_.index(v));
+         if (s != r)
+            parent[s] = r;
+      }
+   }
+
+   // index of the component of every root, n if it has no constraint
+   std::vector<size_t> idx(n, n);
+   std::vector<size_t> ctrcomp(problem.nbCtrs(), 0);
+
+   for (size_t i = 0; i < problem.nbCtrs(); ++i)
+   {
+      Scope sco = problem.ctrAt(i).scope();
+      if (sco.size() == 0)
+         continue;
+
+      size_t r = find(scop_.index(sco.var(0)));
+      if (idx[r] == n)
+      {
+         idx[r] = comp_.size();
+         comp_.push_back(Component());
+      }
+      ctrcomp[i] = idx[r];
+   }
+
+   // a problem whose constraints are all constant has one component
+   if (comp_.empty())
+      comp_.push_back(Component());
+
+   for (size_t i = 0; i < n; ++i)
+   {
+      size_t k = idx[find(i)];
+      if (k != n)
+      {
+         Variable v = scop_.var(i);
+         comp_[k].vars.push_back(v);
+         comp_[k].scop.insert(v);
+      }
+   }
+
+   // sub-problems over clones of the variables
+   std::vector<ConstraintFixer::VarVarMapType> vvm(comp_.size());
+
+   for (size_t k = 0; k < comp_.size(); ++k)
+   {
+      Component &c = comp_[k];
+      c.sub = std::make_unique<Problem>(problem.getName());
+      c.nbnodes = 0;
+      c.nbfast = 0;
+      c.nbfproof = 0;
+
+      for (const auto &v : c.vars)
+         vvm[k].emplace(v, c.sub->addClonedVar(v));
+   }
+
+   ConstraintFixer::VarIntervalMapType vim;
+
+   for (size_t i = 0; i < problem.nbCtrs(); ++i)
+   {
+      size_t k = ctrcomp[i];
+      ConstraintFixer fixer(&vvm[k], &vim, DomainBox(comp_[k].scop));
+      problem.ctrAt(i).acceptVisitor(fixer);
+      comp_[k].sub->addCtr(fixer.getConstraint());
+   }
+}
+
+size_t CSPDecomposition::nbComponents() const
+{
+   return comp_.size();
+}
+
+const Problem &CSPDecomposition::getSubProblem(size_t k) const
+{
+   ASSERT(k < comp_.size(), "Bad access to a component @ " << k);
+
+   return *comp_[k].sub;
+}
+
+Scope CSPDecomposition::getComponentScope(size_t k) const
+{
+   ASSERT(k < comp_.size(), "Bad access to a component @ " << k);
+
+   return comp_[k].scop;
+}
+
+std::unique_ptr<DomainBox> CSPDecomposition::toInput(const Component &c,
+                                                     const DomainBox &box) const
+{
+   std::unique_ptr<DomainBox> res = std::make_unique<DomainBox>(c.scop);
+
+   for (size_t j = 0; j < c.vars.size(); ++j)
+   {
+      std::unique_ptr<Domain> dom(box.get(c.sub->varAt(j))->clone());
+      res->set(c.vars[j], std::move(dom));
+   }
+
+   return res;
+}
+
+void CSPDecomposition::solve(const Params &params, size_t nbt)
+{
+   using Clock = std::chrono::steady_clock;
+   Clock::time_point start = Clock::now();
+
+   double tlim = params.getDblParam("TIME_LIMIT");
+   int64_t nodes = params.getIntParam("NODE_LIMIT");
+   size_t nbstarted = 0, m = std::max(nbt, (size_t)1);
+   std::mutex mtx;
+
+   auto task = [&](size_t k)
+   {
+      Component &c = comp_[k];
+      CSPSolver solver(*c.sub);
+
+      Params *prm = solver.getEnv()->getParams();
+      *prm = params;
+      prm->setStrParam("PREPROCESSING", "NO");
+      prm->setStrParam("BP_DECOMPOSITION", "NO");
+
+      // the limits are shared by the components: the remaining nodes are
+      // split between the components not started yet and the remaining time
+      // between the rounds of m components solved in parallel
+      int nlim;
+      {
+         std::lock_guard<std::mutex> lock(mtx);
+         size_t left = comp_.size() - nbstarted++;
+         size_t rounds = (left + m - 1) / m;
+         double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+         nlim = (int)std::max(nodes / (int64_t)left, (int64_t)1);
+         nodes -= nlim;
+
+         prm->setIntParam("NODE_LIMIT", nlim);
+         prm->setDblParam("TIME_LIMIT", std::max(0.0, tlim - elapsed) / rounds);
+      }
+
+      if (nbt > 1)
+         prm->setStrParam("TRACE", "NO");
+
+      solver.solve();
+
+      // the nodes not used are given back to the next components
+      {
+         std::lock_guard<std::mutex> lock(mtx);
+         nodes += std::max(nlim - solver.getTotalNodes(), 0);
+      }
+
+      // the solutions are copied since the solver and its nodes are
+      // destroyed by the thread that created them
+      for (size_t i = 0; i < solver.nbSolutions(); ++i)
+      {
+         std::pair<DomainBox, Proof> sol = solver.getSolution(i);
+         c.sol.push_back(toInput(c, sol.first));
+         c.proof.push_back(sol.second);
+      }
+
+      for (size_t i = 0; i < solver.nbPendingNodes(); ++i)
+         c.pending.push_back(toInput(c, solver.getPendingBox(i)));
+
+      c.nbnodes = solver.getTotalNodes();
+      c.nbfast = solver.nbFastEvals();
+      c.nbfproof = solver.nbFastProofs();
+      c.env = solver.getEnv();
+   };
+
+   parallelFor(comp_.size(), nbt, task);
+}
+
+int CSPDecomposition::getTotalNodes() const
+{
+   int nb = 0;
+   for (const auto &c : comp_)
+      nb += c.nbnodes;
+   return nb;
+}
+
+size_t CSPDecomposition::nbFastEvals() const
+{
+   size_t nb = 0;
+   for (const auto &c : comp_)
+      nb += c.nbfast;
+   return nb;
+}
+
+size_t CSPDecomposition::nbFastProofs() const
+{
+   size_t nb = 0;
+   for (const auto &c : comp_)
+      nb += c.nbfproof;
+   return nb;
+}
+
+void CSPDecomposition::updateEnv(CSPEnv &env) const
+{
+   bool tl = false, nl = false, sl = false, dl = false;
+
+   for (const auto &c : comp_)
+   {
+      if (c.env == nullptr)
+         continue;
+
+      tl = tl || c.env->usedTimeLimit();
+      nl = nl || c.env->usedNodeLimit();
+      sl = sl || c.env->usedSolutionLimit();
+      dl = dl || c.env->usedDepthLimit();
+   }
+
+   env.setTimeLimit(tl);
+   env.setNodeLimit(nl);
+   env.setSolutionLimit(sl);
+   env.setDepthLimit(dl);
+}
+
+size_t CSPDecomposition::nbComponentSolutions(size_t k) const
+{
+   ASSERT(k < comp_.size(), "Bad access to a component @ " << k);
+
+   return comp_[k].sol.size();
+}
+
+std::pair<DomainBox, Proof> CSPDecomposition::getComponentSolution(size_t k,
+                                                                   size_t i) const
+{
+   ASSERT(i < nbComponentSolutions(k),
+          "Bad access to a solution of a component @ " << k << ", " << i);
+
+   return std::make_pair(DomainBox(*comp_[k].sol[i]), comp_[k].proof[i]);
+}
+
+size_t CSPDecomposition::nbSolutions() const
+{
+   const size_t smax = std::numeric_limits<size_t>::max();
+   size_t nb = 1;
+
+   for (const auto &c : comp_)
+   {
+      size_t m = c.sol.size();
+      if (m == 0)
+         return 0;
+
+      nb = (nb > smax / m) ? smax : nb * m;
+   }
+
+   return nb;
+}
+
+std::pair<DomainBox, Proof> CSPDecomposition::getSolution(size_t i) const
+{
+   ASSERT(i < nbSolutions(), "Bad access to a solution of a product @ " << i);
+
+   DomainBox box(scop_);
+   Proof proof = Proof::Inner;
+
+   // the first component corresponds to the least significant digit
+   for (const auto &c : comp_)
+   {
+      size_t m = c.sol.size(), j = i % m;
+      i /= m;
+
+      const DomainBox &aux = *c.sol[j];
+      for (const auto &v : c.vars)
+      {
+         std::unique_ptr<Domain> dom(aux.get(v)->clone());
+         box.set(v, std::move(dom));
+      }
+
+      proof = std::min(proof, c.proof[j]);
+   }
+
+   return std::make_pair(box, proof);
+}
+
+bool CSPDecomposition::hasFeasibleSolution() const
+{
+   for (const auto &c : comp_)
+   {
+      auto it = std::find_if(c.proof.begin(), c.proof.end(), [](Proof p)
+                             { return p == Proof::Feasible || p == Proof::Inner; });
+      if (it == c.proof.end())
+         return false;
+   }
+   return true;
+}
+
+size_t CSPDecomposition::nbPendingNodes() const
+{
+   size_t nb = 0;
+   for (const auto &c : comp_)
+      nb += c.pending.size();
+   return nb;
+}
+
+DomainBox CSPDecomposition::getPendingBox(size_t i) const
+{
+   ASSERT(i < nbPendingNodes(), "Bad access to a pending box of a product @ " << i);
+
+   size_t k = 0;
+   while (i >= comp_[k].pending.size())
+   {
+      i -= comp_[k].pending.size();
+      ++k;
+   }
+
+   const Component &c = comp_[k];
+   DomainBox box(scop_);
+
+   for (const auto &v : c.vars)
+   {
+      std::unique_ptr<Domain> dom(c.pending[i]->get(v)->clone());
+      box.set(v, std::move(dom));
+   }
+
+   return box;
+}
+
+} // namespace realpaver
@@ -0,0 +1,158 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   CSPDecomposition.hpp
+ * @brief  Decomposition of CSPs into independent sub-problems
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#ifndef REALPAVER_CSP_DECOMPOSITION_HPP
+#define REALPAVER_CSP_DECOMPOSITION_HPP
+
+#include "realpaver/CSPEnv.hpp"
+#include "realpaver/DomainBox.hpp"
+#include "realpaver/Problem.hpp"
+#include <memory>
+#include <vector>
+
+namespace realpaver {
+
+/**
+ * @brief Decomposition of a CSP into independent sub-problems.
+ *
+ * Two variables are linked if they occur in the same constraint. Every
+ * connected component of the resulting graph with at least one constraint
+ * defines a sub-problem over clones of its variables. The variables that
+ * occur in no constraint keep their domains in every solution.
+ *
+ * The sub-problems are solved by their own CSP solvers without preprocessing,
+ * possibly in parallel. The solution set of the input problem is then the
+ * Cartesian product of the solution sets of the components. Only the
+ * solutions of the components are stored, the i-th solution of the product
+ * being generated on demand from the representation of i in the mixed radix
+ * system whose k-th digit ranges over the solutions of the k-th component.
+ */
+class CSPDecomposition {
+public:
+   /// Constructor given a CSP
+   CSPDecomposition(const Problem &problem);
+
+   /// No copy
+   CSPDecomposition(const CSPDecomposition &) = delete;
+
+   /// No assignment
+   CSPDecomposition &operator=(const CSPDecomposition &) = delete;
+
+   /// Default destructor
+   ~CSPDecomposition() = default;
+
+   /// Returns the number of components
+   size_t nbComponents() const;
+
+   /// Returns the sub-problem of the k-th component
+   const Problem &getSubProblem(size_t k) const;
+
+   /// Returns the set of variables of the input problem in the k-th component
+   Scope getComponentScope(size_t k) const;
+
+   /**
+    * @brief Solves the sub-problems.
+    * @param params parameters of the solvers of the sub-problems
+    * @param nbt number of threads
+    *
+    * The node limit and the time limit are shared by the sub-problems. When
+    * the solving of a sub-problem starts, it is given an equal part of the
+    * remaining nodes among the sub-problems not solved yet, the nodes that it
+    * does not use being given back. The remaining time is divided by the
+    * number of rounds of nbt sub-problems solved in parallel. The solvers must
+    * not log messages or display a trace if nbt > 1.
+    */
+   void solve(const Params &params, size_t nbt);
+
+   /// Returns the total number of nodes of the solvers
+   int getTotalNodes() const;
+
+   /// Returns the total number of fast evaluations in hc4Revise
+   size_t nbFastEvals() const;
+
+   /// Returns the total number of conclusive fast evaluations in hc4Revise
+   size_t nbFastProofs() const;
+
+   /// Assigns the limit flags of env from the ones of the solvers
+   void updateEnv(CSPEnv &env) const;
+
+   /// Returns the number of solutions of the k-th component
+   size_t nbComponentSolutions(size_t k) const;
+
+   /**
+    * @brief Gets the i-th solution of the k-th component.
+    *
+    * The scope of the box is the set of variables of the input problem
+    * belonging to this component.
+    */
+   std::pair<DomainBox, Proof> getComponentSolution(size_t k, size_t i) const;
+
+   /// Returns the number of solutions of the product, saturated at SIZE_MAX
+   size_t nbSolutions() const;
+
+   /**
+    * @brief Gets the i-th solution of the product.
+    *
+    * The scope of the box is the scope of the input problem. The proof is
+    * the weakest proof among the solutions of the components.
+    */
+   std::pair<DomainBox, Proof> getSolution(size_t i) const;
+
+   /// Returns true if every component has a feasible or inner solution
+   bool hasFeasibleSolution() const;
+
+   /// Returns the number of pending nodes of all the solvers
+   size_t nbPendingNodes() const;
+
+   /**
+    * @brief Gets the i-th pending box.
+    *
+    * The scope of the box is the scope of the input problem. The domains of
+    * the variables out of the component of the pending node are the domains
+    * in the input problem.
+    */
+   DomainBox getPendingBox(size_t i) const;
+
+private:
+   // component of a problem
+   struct Component {
+      std::unique_ptr<Problem> sub;                    // sub-problem
+      std::vector<Variable> vars;                      // variables of the input problem
+      Scope scop;                                      // scope of vars
+      std::vector<std::unique_ptr<DomainBox>> sol;     // solutions over scop
+      std::vector<Proof> proof;                        // proofs of the solutions
+      std::vector<std::unique_ptr<DomainBox>> pending; // pending boxes over scop
+      int nbnodes;                                     // number of nodes
+      size_t nbfast;                                   // number of fast evaluations
+      size_t nbfproof;                                 // number of fast proofs
+      std::shared_ptr<CSPEnv> env;                     // environment of the solver
+   };
+
+   Scope scop_;                  // scope of the input problem
+   std::vector<Component> comp_; // components
+
+   // copies the domains of a box over a sub-problem in a box over the
+   // variables of the input problem
+   std::unique_ptr<DomainBox> toInput(const Component &c, const DomainBox &box) const;
+};
+
+} // namespace realpaver
+
+#endif
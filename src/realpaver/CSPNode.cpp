@@ -20,6 +20,7 @@
 
 #include "realpaver/CSPNode.hpp"
 #include "realpaver/AssertDebug.hpp"
+#include <vector>
 
 namespace realpaver {
 
@@ -30,6 +31,7 @@ CSPNode::CSPNode(Scope scop, int depth)
     , index_(-1)
     , parent_(-1)
     , proof_(Proof::Maybe)
+    , nref_(0)
 {
    ASSERT(depth >= 0, "Bad depth of a CSP node " << depth);
    ASSERT(!scop.isEmpty(), "Empty scope used to create a CSP node");
@@ -44,6 +46,7 @@ CSPNode::CSPNode(std::unique_ptr<DomainBox> box, int depth)
     , index_(-1)
     , parent_(-1)
     , proof_(Proof::Maybe)
+    , nref_(0)
 {
    ASSERT(depth >= 0, "Bad depth of a CSP node " << depth);
 }
@@ -55,6 +58,7 @@ CSPNode::CSPNode(const CSPNode &node)
     , index_(-1)
     , parent_(-1)
     , proof_(Proof::Maybe)
+    , nref_(0)
 {
    box_ = node.box_->clone();
 }
@@ -128,4 +132,184 @@ std::ostream &operator<<(std::ostream &os, const CSPNode &node)
    return os;
 }
 
+/*----------------------------------------------------------------------------*/
+
+namespace {
+
+// slots are aligned for CSP nodes
+constexpr size_t SLOT_SIZE =
+    (sizeof(CSPNode) + alignof(CSPNode) - 1) / alignof(CSPNode) * alignof(CSPNode);
+
+// number of slots per chunk
+constexpr size_t CHUNK_SIZE = 256;
+
+struct CSPNodePoolRep {
+   std::vector<void *> slots;  // free slots
+   std::vector<void *> chunks; // chunks allocated
+   size_t nused = 0;           // number of slots in use
+
+   ~CSPNodePoolRep();
+};
+
+thread_local CSPNodePoolRep pool;
+thread_local bool poolDestroyed = false;
+
+CSPNodePoolRep::~CSPNodePoolRep()
+{
+   poolDestroyed = true;
+
+   // the chunks are leaked if some nodes are still alive at thread exit
+   if (nused == 0)
+   {
+      for (void *p : chunks)
+         ::operator delete(p);
+   }
+}
+
+} // namespace
+
+void *CSPNodePool::allocate()
+{
+   if (poolDestroyed)
+      return ::operator new(SLOT_SIZE);
+
+   if (pool.slots.empty())
+   {
+      char *chunk = static_cast<char *>(::operator new(SLOT_SIZE * CHUNK_SIZE));
+      pool.chunks.push_back(chunk);
+
+      for (size_t i = CHUNK_SIZE; i > 0; --i)
+         pool.slots.push_back(chunk + (i - 1) * SLOT_SIZE);
+   }
+
+   void *p = pool.slots.back();
+   pool.slots.pop_back();
+   ++pool.nused;
+   return p;
+}
+
+void CSPNodePool::release(void *p)
+{
+   // the slot is leaked if the pool is destroyed at thread exit
+   if (poolDestroyed)
+      return;
+
+   ASSERT(pool.nused > 0, "Bad release of a slot in a pool of CSP nodes");
+
+   pool.slots.push_back(p);
+   --pool.nused;
+}
+
+size_t CSPNodePool::nbUsedSlots()
+{
+   return poolDestroyed ? 0 : pool.nused;
+}
+
+/*----------------------------------------------------------------------------*/
+
+SharedCSPNode::SharedCSPNode() noexcept
+    : node_(nullptr)
+{
+}
+
+SharedCSPNode::SharedCSPNode(std::nullptr_t) noexcept
+    : node_(nullptr)
+{
+}
+
+SharedCSPNode::SharedCSPNode(CSPNode *node) noexcept
+    : node_(node)
+{
+#if ASSERT_ON
+   if (node_->nref_ == 0)
+      node_->owner_ = std::this_thread::get_id();
+#endif
+
+   ++node_->nref_;
+}
+
+SharedCSPNode::SharedCSPNode(SharedCSPNode &&other) noexcept
+    : node_(other.node_)
+{
+   other.node_ = nullptr;
+}
+
+SharedCSPNode &SharedCSPNode::operator=(SharedCSPNode &&other) noexcept
+{
+   if (this != &other)
+   {
+      reset();
+      node_ = other.node_;
+      other.node_ = nullptr;
+   }
+   return *this;
+}
+
+SharedCSPNode::~SharedCSPNode()
+{
+   reset();
+}
+
+SharedCSPNode SharedCSPNode::share() const noexcept
+{
+   if (node_ == nullptr)
+      return SharedCSPNode();
+
+   ASSERT(node_->owner_ == std::this_thread::get_id(),
+          "CSP node shared by a thread that did not create it");
+
+   return SharedCSPNode(node_);
+}
+
+void SharedCSPNode::reset() noexcept
+{
+   if (node_ == nullptr)
+      return;
+
+   ASSERT(node_->owner_ == std::this_thread::get_id(),
+          "CSP node released by a thread that did not create it");
+
+   if (--node_->nref_ == 0)
+   {
+      node_->~CSPNode();
+      CSPNodePool::release(node_);
+   }
+   node_ = nullptr;
+}
+
+CSPNode *SharedCSPNode::get() const noexcept
+{
+   return node_;
+}
+
+CSPNode *SharedCSPNode::operator->() const noexcept
+{
+   return node_;
+}
+
+CSPNode &SharedCSPNode::operator*() const noexcept
+{
+   return *node_;
+}
+
+SharedCSPNode::operator bool() const noexcept
+{
+   return node_ != nullptr;
+}
+
+size_t SharedCSPNode::useCount() const noexcept
+{
+   return (node_ == nullptr) ? 0 : node_->nref_;
+}
+
+bool operator==(const SharedCSPNode &a, const SharedCSPNode &b) noexcept
+{
+   return a.get() == b.get();
+}
+
+bool operator!=(const SharedCSPNode &a, const SharedCSPNode &b) noexcept
+{
+   return a.get() != b.get();
+}
+
 } // namespace realpaver
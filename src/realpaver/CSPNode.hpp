@@ -21,8 +21,16 @@
 #ifndef REALPAVER_CSP_NODE_HPP
 #define REALPAVER_CSP_NODE_HPP
 
+#include "realpaver/AssertDebug.hpp"
 #include "realpaver/DomainBox.hpp"
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <utility>
+
+#if ASSERT_ON
+#include <thread>
+#endif
 
 namespace realpaver {
 
@@ -38,6 +46,9 @@ namespace realpaver {
  *
  * The domain box is owned by this. Its scope is assumed to contain
  * the scope of this.
+ *
+ * The nodes handled by the search components are created by
+ * SharedCSPNode::make and they count the handles on them.
  */
 class CSPNode {
 public:
@@ -98,13 +109,126 @@ private:
    DomainBox *box_;
    int depth_, index_, parent_;
    Proof proof_;
+   size_t nref_; // number of handles on this
+
+#if ASSERT_ON
+   std::thread::id owner_; // thread that created this
+#endif
+
+   friend class SharedCSPNode;
 };
 
 /// Output on a stream
 std::ostream &operator<<(std::ostream &os, const CSPNode &node);
 
-/// Type of shared pointers on CSP nodes
-using SharedCSPNode = std::shared_ptr<CSPNode>;
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Pool of memory slots for CSP nodes.
+ *
+ * The slots are allocated by chunks and recycled, which avoids a call to the
+ * memory allocator for each node of a search tree. There is one pool per
+ * thread, hence a node must be released in the thread that created it.
+ */
+class CSPNodePool {
+public:
+   /// Returns a slot for one node
+   static void *allocate();
+
+   /// Gives back a slot
+   static void release(void *p);
+
+   /// Returns the number of slots in use in the pool of the current thread
+   static size_t nbUsedSlots();
+};
+
+/**
+ * @brief Handle on a CSP node.
+ *
+ * It is a lightweight shared pointer whose reference counter is stored in the
+ * node, which is allocated in a pool and destroyed when its last handle is
+ * destroyed. The counter is not atomic and the pool belongs to the thread
+ * that created the node, hence the handles on a node must be used by this
+ * thread, which is checked by assertions.
+ *
+ * A handle is not copyable. It is moved, e.g. in the containers of the search
+ * spaces, and a new handle on the same node is only created by share().
+ */
+class SharedCSPNode {
+public:
+   /// Creates a null handle
+   SharedCSPNode() noexcept;
+
+   /// Creates a null handle
+   SharedCSPNode(std::nullptr_t) noexcept;
+
+   /// No copy
+   SharedCSPNode(const SharedCSPNode &) = delete;
+
+   /// Move constructor
+   SharedCSPNode(SharedCSPNode &&other) noexcept;
+
+   /// No assignment
+   SharedCSPNode &operator=(const SharedCSPNode &) = delete;
+
+   /// Move assignment
+   SharedCSPNode &operator=(SharedCSPNode &&other) noexcept;
+
+   /// Destructor
+   ~SharedCSPNode();
+
+   /// Returns a new handle on the node, to be called by the thread of the node
+   SharedCSPNode share() const noexcept;
+
+   /// Creates a node in the pool from the arguments of a constructor of CSPNode
+   template <typename... Args>
+   static SharedCSPNode make(Args &&...args);
+
+   /// Returns the node
+   CSPNode *get() const noexcept;
+
+   /// Dereferences this
+   CSPNode *operator->() const noexcept;
+
+   /// Dereferences this
+   CSPNode &operator*() const noexcept;
+
+   /// Returns true if this is not null
+   explicit operator bool() const noexcept;
+
+   /// Returns the number of handles on the node, 0 if this is null
+   size_t useCount() const noexcept;
+
+   /// Releases the node and makes this null
+   void reset() noexcept;
+
+private:
+   CSPNode *node_; // managed node
+
+   // takes a node having no handle
+   explicit SharedCSPNode(CSPNode *node) noexcept;
+};
+
+/// Equality test
+bool operator==(const SharedCSPNode &a, const SharedCSPNode &b) noexcept;
+
+/// Disequality test
+bool operator!=(const SharedCSPNode &a, const SharedCSPNode &b) noexcept;
+
+template <typename... Args>
+SharedCSPNode SharedCSPNode::make(Args &&...args)
+{
+   void *p = CSPNodePool::allocate();
+   try
+   {
+      return SharedCSPNode(new (p) CSPNode(std::forward<Args>(args)...));
+   }
+   catch (...)
+   {
+      CSPNodePool::release(p);
+      throw;
+   }
+}
 
 } // namespace realpaver
 
@@ -18,10 +18,38 @@
  * @date   2024-4-11
  */
 
+#include "realpaver/AssertDebug.hpp"
 #include "realpaver/CSPPropagator.hpp"
+#include <sstream>
 
 namespace realpaver {
 
+std::ostream &operator<<(std::ostream &os, CSPPropagAlgo alg)
+{
+   switch (alg)
+   {
+   case CSPPropagAlgo::HC4:
+      return os << "HC4";
+   case CSPPropagAlgo::BC4:
+      return os << "BC4";
+   case CSPPropagAlgo::POLYNOMIAL:
+      return os << "POLYNOMIAL";
+   case CSPPropagAlgo::AFFINE:
+      return os << "AFFINE";
+   case CSPPropagAlgo::ACID:
+      return os << "ACID";
+   case CSPPropagAlgo::Polytope:
+      return os << "Polytope";
+   case CSPPropagAlgo::Newton:
+      return os << "Newton";
+   default:
+      os.setstate(std::ios::failbit);
+   }
+   return os;
+}
+
+/*----------------------------------------------------------------------------*/
+
 CSPPropagator::CSPPropagator()
 {
 }
@@ -30,6 +58,10 @@ CSPPropagator::~CSPPropagator()
 {
 }
 
+void CSPPropagator::reset()
+{
+}
+
 Proof CSPPropagator::contractBox(const IntervalBox &B, DomainBox &box)
 {
    for (const auto &v : box.scope())
@@ -43,7 +75,7 @@ Proof CSPPropagator::contractBox(const IntervalBox &B, DomainBox &box)
    return Proof::Maybe;
 }
 
-Proof CSPPropagator::contract(CSPNode &node, CSPContext &ctx)
+Proof CSPPropagator::contract(CSPNode &node, CSPContext &ctx, DomainTrail *trail)
 {
    // creates an interval box from the domain box in the given node
    IntervalBox B(*node.box());
@@ -62,6 +94,11 @@ Proof CSPPropagator::contract(CSPNode &node, CSPContext &ctx)
       {
          Variable v = *it;
          Domain *dom = box->get(v);
+
+         // the domain is saved only if it is going to be reduced
+         if ((trail != nullptr) && !B.get(v).contains(dom->intervalHull()))
+            trail->save(v);
+
          dom->contract(B.get(v));
 
          if (dom->isEmpty())
@@ -103,6 +140,19 @@ Proof CSPPropagatorBC4::contractImpl(IntervalBox &B)
 
 /*----------------------------------------------------------------------------*/
 
+CSPPropagatorPolynomial::CSPPropagatorPolynomial(ContractorFactory &facto)
+    : CSPPropagator()
+{
+   ctc_ = facto.makePolynomial();
+}
+
+Proof CSPPropagatorPolynomial::contractImpl(IntervalBox &B)
+{
+   return ctc_->contract(B);
+}
+
+/*----------------------------------------------------------------------------*/
+
 CSPPropagatorAffine::CSPPropagatorAffine(ContractorFactory &facto)
     : CSPPropagator()
 {
@@ -169,11 +219,21 @@ Proof CSPPropagatorACID::contractImpl(IntervalBox &B)
    return proof;
 }
 
+void CSPPropagatorACID::reset()
+{
+   if (acid_ != nullptr)
+      acid_->reset();
+}
+
 /*----------------------------------------------------------------------------*/
 
 CSPPropagatorList::CSPPropagatorList()
     : CSPPropagator()
     , v_()
+    , algo_()
+    , trace_(nullptr)
+    , stage_()
+    , bnd_()
 {
 }
 
@@ -194,6 +254,12 @@ void CSPPropagatorList::pushBack(CSPPropagAlgo alg, ContractorFactory &facto)
          v_.push_back(op);
       break;
 
+   case CSPPropagAlgo::POLYNOMIAL:
+      op = std::make_shared<CSPPropagatorPolynomial>(facto);
+      if (op != nullptr)
+         v_.push_back(op);
+      break;
+
    case CSPPropagAlgo::AFFINE:
       op = std::make_shared<CSPPropagatorAffine>(facto);
       if (op != nullptr)
@@ -218,6 +284,9 @@ void CSPPropagatorList::pushBack(CSPPropagAlgo alg, ContractorFactory &facto)
          v_.push_back(op);
       break;
    }
+
+   if (algo_.size() < v_.size())
+      algo_.push_back(alg);
 }
 
 size_t CSPPropagatorList::size() const
@@ -225,10 +294,50 @@ size_t CSPPropagatorList::size() const
    return v_.size();
 }
 
+CSPPropagAlgo CSPPropagatorList::algoAt(size_t i) const
+{
+   ASSERT(i < algo_.size(), "Bad access to a propagator in a list @ " << i);
+   return algo_[i];
+}
+
+void CSPPropagatorList::setTrace(CSPTrace *trace)
+{
+   trace_ = trace;
+   stage_.clear();
+
+   if (trace_ != nullptr)
+   {
+      for (CSPPropagAlgo alg : algo_)
+      {
+         std::ostringstream os;
+         os << alg;
+         stage_.push_back(trace_->defineStage(os.str()));
+      }
+   }
+}
+
 Proof CSPPropagatorList::contractImpl(IntervalBox &B)
 {
    Proof proof = Proof::Maybe;
-   for (int i = 0; i < v_.size(); ++i)
+
+   if (trace_ != nullptr)
+   {
+      for (size_t i = 0; i < v_.size(); ++i)
+      {
+         double before = boundedPerimeter(B, true), start = CSPTrace::now();
+         proof = v_[i]->contractImpl(B);
+         double time = CSPTrace::now() - start,
+                after = (proof == Proof::Empty) ? 0.0 : boundedPerimeter(B, false);
+
+         trace_->setStage(stage_[i], before, after, time, proof);
+
+         if (proof == Proof::Empty)
+            return proof;
+      }
+      return proof;
+   }
+
+   for (size_t i = 0; i < v_.size(); ++i)
    {
       proof = v_[i]->contractImpl(B);
       if (proof == Proof::Empty)
@@ -237,4 +346,33 @@ Proof CSPPropagatorList::contractImpl(IntervalBox &B)
    return proof;
 }
 
+double CSPPropagatorList::boundedPerimeter(const IntervalBox &B, bool mark)
+{
+   if (mark)
+      bnd_.resize(B.size());
+
+   double p = 0.0;
+   size_t i = 0;
+
+   for (const auto &v : B.scope())
+   {
+      Interval x = B.get(v);
+
+      if (mark)
+         bnd_[i] = x.isFinite();
+
+      if (bnd_[i])
+         p += x.width();
+
+      ++i;
+   }
+   return p;
+}
+
+void CSPPropagatorList::reset()
+{
+   for (auto &prop : v_)
+      prop->reset();
+}
+
 } // namespace realpaver
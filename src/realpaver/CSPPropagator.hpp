@@ -23,21 +23,27 @@
 
 #include "realpaver/CSPContext.hpp"
 #include "realpaver/CSPNode.hpp"
+#include "realpaver/CSPTrace.hpp"
 #include "realpaver/ContractorFactory.hpp"
+#include "realpaver/DomainTrail.hpp"
 #include <vector>
 
 namespace realpaver {
 
 /// Type of reduction methods for CSPs
 enum class CSPPropagAlgo {
-   HC4,      ///< propagation algorithm based on HC4 contractors
-   BC4,      ///< propagation algorithm based on BC4 contractors
-   AFFINE,   ///< propagation algorithm based on affine contractors
-   ACID,     ///< adaptive CID
-   Polytope, ///< polytope hull contractor
-   Newton    ///< interval Newton operator
+   HC4,        ///< propagation algorithm based on HC4 contractors
+   BC4,        ///< propagation algorithm based on BC4 contractors
+   POLYNOMIAL, ///< HC4 combined with contractors of polynomial constraints
+   AFFINE,     ///< propagation algorithm based on affine contractors
+   ACID,       ///< adaptive CID
+   Polytope,   ///< polytope hull contractor
+   Newton      ///< interval Newton operator
 };
 
+/// Output on a stream
+std::ostream &operator<<(std::ostream &os, CSPPropagAlgo alg);
+
 /**
  * @brief Base class of propagators of CSP solver.
  *
@@ -66,15 +72,26 @@ public:
     * It applies first contractImpl and then the domain contractors for
     * the variables with disconnected domains.
     *
+    * If a trail attached to the box of the node is given, the domains are
+    * saved on the trail before being modified.
+    *
     * Returns a certificate of proof
     */
-   Proof contract(CSPNode &node, CSPContext &ctx);
+   Proof contract(CSPNode &node, CSPContext &ctx, DomainTrail *trail = nullptr);
 
    /// Reduces box by intersecting it with B
    static Proof contractBox(const IntervalBox &B, DomainBox &box);
 
    /// Contraction method to be overriden in sub-classes
    virtual Proof contractImpl(IntervalBox &B) = 0;
+
+   /**
+    * @brief Resets the state learned during a search.
+    *
+    * It is called before a new search with the same propagator. It does
+    * nothing by default.
+    */
+   virtual void reset();
 };
 
 /// Type of shared pointers on CSP propagators
@@ -128,6 +145,29 @@ private:
 
 /*----------------------------------------------------------------------------*/
 
+/// HC4 constraint propagation algorithm with polynomial contractors
+class CSPPropagatorPolynomial : public CSPPropagator {
+public:
+   /// Constructor
+   CSPPropagatorPolynomial(ContractorFactory &facto);
+
+   /// Default copy constructor
+   CSPPropagatorPolynomial(const CSPPropagatorPolynomial &) = default;
+
+   /// No assignment
+   CSPPropagatorPolynomial &operator=(const CSPPropagatorPolynomial &) = delete;
+
+   /// Default destructor
+   ~CSPPropagatorPolynomial() = default;
+
+   Proof contractImpl(IntervalBox &B) override;
+
+private:
+   SharedContractor ctc_;
+};
+
+/*----------------------------------------------------------------------------*/
+
 /// Constraint propagation algorithm based on affine contractors
 class CSPPropagatorAffine : public CSPPropagator {
 public:
@@ -213,15 +253,22 @@ public:
    ~CSPPropagatorACID() = default;
 
    Proof contractImpl(IntervalBox &B) override;
+   void reset() override;
 
 private:
    SharedContractor hc4_;
-   SharedContractor acid_;
+   SharedContractorACID acid_;
 };
 
 /*----------------------------------------------------------------------------*/
 
-/// List of propagators applied in sequence to contract a CSP node
+/**
+ * @brief List of propagators applied in sequence to contract a CSP node.
+ *
+ * If a trace is attached to this, every propagator is a stage of the trace
+ * and the perimeter of the box before and after each propagator is recorded
+ * in the current row of the trace together with the time spent.
+ */
 class CSPPropagatorList : public CSPPropagator {
 public:
    /// Constructor
@@ -242,10 +289,32 @@ public:
    /// Inserts a new algorithm in the last place
    void pushBack(CSPPropagAlgo alg, ContractorFactory &facto);
 
+   /// Returns the i-th algorithm
+   CSPPropagAlgo algoAt(size_t i) const;
+
+   /**
+    * @brief Attaches a trace to this.
+    *
+    * The algorithms of this are defined as new stages of the trace. The trace
+    * is not owned by this and it can be null. The reduction of a stage is
+    * measured by the sum of the widths of the variables that are bounded
+    * before this stage.
+    */
+   void setTrace(CSPTrace *trace);
+
    Proof contractImpl(IntervalBox &B) override;
+   void reset() override;
 
 private:
    std::vector<SharedCSPPropagator> v_;
+   std::vector<CSPPropagAlgo> algo_; // algorithms of the propagators
+   CSPTrace *trace_;                 // trace or nullptr
+   std::vector<size_t> stage_;       // stages of the propagators in the trace
+   std::vector<bool> bnd_;           // bounded variables before a stage
+
+   // sum of the widths of the bounded variables in B, which are first
+   // marked in bnd_ if mark is true
+   double boundedPerimeter(const IntervalBox &B, bool mark);
 };
 
 } // namespace realpaver
@@ -0,0 +1,212 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   CSPSettings.cpp
+ * @brief  Typed snapshot of the parameters of the CSP solver
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#include "realpaver/AssertDebug.hpp"
+#include "realpaver/CSPSettings.hpp"
+#include "realpaver/Double.hpp"
+#include <limits>
+
+namespace realpaver {
+
+std::ostream &operator<<(std::ostream &os, const CSPNodeSelection &sel)
+{
+   switch (sel)
+   {
+   case CSPNodeSelection::DFS:
+      return os << "DFS";
+   case CSPNodeSelection::BFS:
+      return os << "BFS";
+   case CSPNodeSelection::DMDFS:
+      return os << "DMDFS";
+   case CSPNodeSelection::IDFS:
+      return os << "IDFS";
+   case CSPNodeSelection::PDFS:
+      return os << "PDFS";
+   case CSPNodeSelection::GPDFS:
+      return os << "GPDFS";
+   default:
+      os.setstate(std::ios::failbit);
+   }
+   return os;
+}
+
+std::ostream &operator<<(std::ostream &os, const CSPVarSelection &sel)
+{
+   switch (sel)
+   {
+   case CSPVarSelection::RR:
+      return os << "RR";
+   case CSPVarSelection::LF:
+      return os << "LF";
+   case CSPVarSelection::SF:
+      return os << "SF";
+   case CSPVarSelection::SLF:
+      return os << "SLF";
+   case CSPVarSelection::SSR:
+      return os << "SSR";
+   case CSPVarSelection::SSR_LF:
+      return os << "SSR_LF";
+   default:
+      os.setstate(std::ios::failbit);
+   }
+   return os;
+}
+
+std::ostream &operator<<(std::ostream &os, const CSPSlicing &sli)
+{
+   switch (sli)
+   {
+   case CSPSlicing::Bi:
+      return os << "BI";
+   case CSPSlicing::KWay:
+      return os << "KWAY";
+   case CSPSlicing::Adaptive:
+      return os << "ADAPTIVE";
+   default:
+      os.setstate(std::ios::failbit);
+   }
+   return os;
+}
+
+/*----------------------------------------------------------------------------*/
+
+CSPSettings::CSPSettings()
+    : CSPSettings(Params())
+{
+}
+
+CSPSettings::CSPSettings(const Params &prm)
+{
+   nodeSelection = makeNodeSelection(prm.getStrParam("BP_NODE_SELECTION"));
+   domainTrail = makeYesNo(prm.getStrParam("BP_DOMAIN_TRAIL"));
+   decomposition = (prm.getStrParam("BP_DECOMPOSITION") != "NO");
+   complete = (prm.getStrParam("SEARCH_STATUS") == "COMPLETE");
+
+   if (complete)
+   {
+      timeLimit = Double::inf();
+      nodeLimit = std::numeric_limits<int>::max();
+      solutionLimit = std::numeric_limits<int>::max();
+      depthLimit = std::numeric_limits<int>::max();
+   }
+   else
+   {
+      timeLimit = prm.getDblParam("TIME_LIMIT");
+      nodeLimit = prm.getIntParam("NODE_LIMIT");
+      solutionLimit = prm.getIntParam("SOLUTION_LIMIT");
+      depthLimit = prm.getIntParam("DEPTH_LIMIT");
+   }
+
+   clusterGap = prm.getDblParam("SOLUTION_CLUSTER_GAP");
+   trace = makeYesNo(prm.getStrParam("TRACE"));
+   traceFrequency = prm.getIntParam("TRACE_FREQUENCY");
+
+   propagationBase = makePropagationBase(prm.getStrParam("PROPAGATION_BASE"));
+   withAcid = makeYesNo(prm.getStrParam("PROPAGATION_WITH_ACID"));
+   withPolytope = makeYesNo(prm.getStrParam("PROPAGATION_WITH_POLYTOPE_HULL"));
+   withNewton = makeYesNo(prm.getStrParam("PROPAGATION_WITH_NEWTON"));
+
+   varSelection = makeVarSelection(prm.getStrParam("SPLIT_SELECTION"));
+   slicing = makeSlicing(prm.getStrParam("SPLIT_SLICING"));
+   arity = prm.getIntParam("SPLIT_ARITY");
+   intervalPoint = prm.getDblParam("SPLIT_INTERVAL_POINT");
+   ssrLfFrequency = prm.getDblParam("SPLIT_SSR_LF_FREQUENCY");
+   splitInnerBox = makeYesNo(prm.getStrParam("SPLIT_INNER_BOX"));
+
+   certification = (prm.getStrParam("CERTIFICATION") != "NO");
+   eagerCertification = (prm.getStrParam("CERTIFICATION") == "EAGER");
+   newtonCertifyIter = prm.getIntParam("NEWTON_CERTIFY_ITER_LIMIT");
+   inflationDelta = prm.getDblParam("INFLATION_DELTA");
+   inflationChi = prm.getDblParam("INFLATION_CHI");
+}
+
+CSPNodeSelection CSPSettings::makeNodeSelection(const std::string &s)
+{
+   if (s == "DFS")
+      return CSPNodeSelection::DFS;
+   if (s == "BFS")
+      return CSPNodeSelection::BFS;
+   if (s == "DMDFS")
+      return CSPNodeSelection::DMDFS;
+   if (s == "IDFS")
+      return CSPNodeSelection::IDFS;
+   if (s == "PDFS")
+      return CSPNodeSelection::PDFS;
+   if (s == "GPDFS")
+      return CSPNodeSelection::GPDFS;
+
+   THROW("Bad parameter value for the node selection strategy: " << s);
+}
+
+CSPVarSelection CSPSettings::makeVarSelection(const std::string &s)
+{
+   if (s == "RR")
+      return CSPVarSelection::RR;
+   if (s == "LF")
+      return CSPVarSelection::LF;
+   if (s == "SF")
+      return CSPVarSelection::SF;
+   if (s == "SLF")
+      return CSPVarSelection::SLF;
+   if (s == "SSR")
+      return CSPVarSelection::SSR;
+   if (s == "SSR_LF")
+      return CSPVarSelection::SSR_LF;
+
+   THROW("Bad parameter value for the variable selection strategy: " << s);
+}
+
+CSPSlicing CSPSettings::makeSlicing(const std::string &s)
+{
+   if (s == "BI")
+      return CSPSlicing::Bi;
+   if (s == "KWAY")
+      return CSPSlicing::KWay;
+   if (s == "ADAPTIVE")
+      return CSPSlicing::Adaptive;
+
+   THROW("Bad parameter value for the slicing strategy: " << s);
+}
+
+CSPPropagAlgo CSPSettings::makePropagationBase(const std::string &s)
+{
+   if (s == "HC4")
+      return CSPPropagAlgo::HC4;
+   if (s == "BC4")
+      return CSPPropagAlgo::BC4;
+   if (s == "POLYNOMIAL")
+      return CSPPropagAlgo::POLYNOMIAL;
+   if (s == "AFFINE")
+      return CSPPropagAlgo::AFFINE;
+
+   THROW("Bad parameter value for the propagation algorithm: " << s);
+}
+
+bool CSPSettings::makeYesNo(const std::string &s)
+{
+   if (s == "YES")
+      return true;
+   if (s == "NO")
+      return false;
+
+   THROW("Bad parameter value, YES or NO expected: " << s);
+}
+
+} // namespace realpaver
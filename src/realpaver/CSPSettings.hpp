@@ -0,0 +1,139 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   CSPSettings.hpp
+ * @brief  Typed snapshot of the parameters of the CSP solver
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#ifndef REALPAVER_CSP_SETTINGS_HPP
+#define REALPAVER_CSP_SETTINGS_HPP
+
+#include "realpaver/CSPPropagator.hpp"
+#include "realpaver/Param.hpp"
+#include <iostream>
+
+namespace realpaver {
+
+/// Node selection strategies in the search tree of the CSP solver
+enum class CSPNodeSelection {
+   DFS,   ///< depth-first search
+   BFS,   ///< breadth-first search
+   DMDFS, ///< distant-most depth-first search
+   IDFS,  ///< hybrid DFS based on the depth of nodes
+   PDFS,  ///< hybrid DFS based on the perimeter of boxes
+   GPDFS  ///< hybrid DFS based on the grid perimeter of boxes
+};
+
+/// Output on a stream
+std::ostream &operator<<(std::ostream &os, const CSPNodeSelection &sel);
+
+/// Variable selection strategies in the splitting step of the CSP solver
+enum class CSPVarSelection {
+   RR,    ///< round-robin
+   LF,    ///< largest domain first
+   SF,    ///< smallest domain first
+   SLF,   ///< smallest integer domain first, then largest real domain first
+   SSR,   ///< smear sum relative
+   SSR_LF ///< hybrid strategy mixing SSR and LF
+};
+
+/// Output on a stream
+std::ostream &operator<<(std::ostream &os, const CSPVarSelection &sel);
+
+/// Domain slicing strategies in the splitting step of the CSP solver
+enum class CSPSlicing {
+   Bi,      ///< bisection
+   KWay,    ///< division in k parts
+   Adaptive ///< division in 2 up to k parts
+};
+
+/// Output on a stream
+std::ostream &operator<<(std::ostream &os, const CSPSlicing &sli);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Typed and immutable snapshot of the parameters of the CSP solver.
+ *
+ * The parameters are stored as text in a Params object, which is convenient
+ * to load them from files or the command line but requires a lookup in a map
+ * and string comparisons at each access. A snapshot resolves all the
+ * parameters used by the branch-and-prune algorithm once and for all, the
+ * multiple-choice parameters being converted into enumerations or Booleans.
+ *
+ * An exception is thrown by the constructor if a parameter has a value that
+ * is not handled by the CSP solver.
+ */
+struct CSPSettings {
+   /// Creates a snapshot of the default parameters
+   CSPSettings();
+
+   /// Creates a snapshot of the given parameters
+   explicit CSPSettings(const Params &prm);
+
+   // search
+   CSPNodeSelection nodeSelection; // BP_NODE_SELECTION
+   bool domainTrail;               // BP_DOMAIN_TRAIL == YES
+   bool decomposition;             // BP_DECOMPOSITION != NO
+   bool complete;                  // SEARCH_STATUS == COMPLETE
+   double timeLimit;               // TIME_LIMIT, infinite if complete
+   int nodeLimit;                  // NODE_LIMIT, INT_MAX if complete
+   int solutionLimit;              // SOLUTION_LIMIT, INT_MAX if complete
+   int depthLimit;                 // DEPTH_LIMIT, INT_MAX if complete
+   double clusterGap;              // SOLUTION_CLUSTER_GAP
+   bool trace;                     // TRACE == YES
+   int traceFrequency;             // TRACE_FREQUENCY
+
+   // contraction
+   CSPPropagAlgo propagationBase; // PROPAGATION_BASE (HC4, BC4, POLYNOMIAL or AFFINE)
+   bool withAcid;                 // PROPAGATION_WITH_ACID == YES
+   bool withPolytope;             // PROPAGATION_WITH_POLYTOPE_HULL == YES
+   bool withNewton;               // PROPAGATION_WITH_NEWTON == YES
+
+   // splitting
+   CSPVarSelection varSelection; // SPLIT_SELECTION
+   CSPSlicing slicing;           // SPLIT_SLICING
+   int arity;                    // SPLIT_ARITY
+   double intervalPoint;         // SPLIT_INTERVAL_POINT
+   double ssrLfFrequency;        // SPLIT_SSR_LF_FREQUENCY
+   bool splitInnerBox;           // SPLIT_INNER_BOX == YES
+
+   // certification
+   bool certification;      // CERTIFICATION != NO
+   bool eagerCertification; // CERTIFICATION == EAGER
+   int newtonCertifyIter;   // NEWTON_CERTIFY_ITER_LIMIT
+   double inflationDelta;   // INFLATION_DELTA
+   double inflationChi;     // INFLATION_CHI
+
+   /// Converts a value of BP_NODE_SELECTION
+   static CSPNodeSelection makeNodeSelection(const std::string &s);
+
+   /// Converts a value of SPLIT_SELECTION
+   static CSPVarSelection makeVarSelection(const std::string &s);
+
+   /// Converts a value of SPLIT_SLICING
+   static CSPSlicing makeSlicing(const std::string &s);
+
+   /// Converts a value of PROPAGATION_BASE
+   static CSPPropagAlgo makePropagationBase(const std::string &s);
+
+   /// Converts a value of a YES/NO parameter
+   static bool makeYesNo(const std::string &s);
+};
+
+} // namespace realpaver
+
+#endif
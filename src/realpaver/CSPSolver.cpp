@@ -25,8 +25,9 @@
 #include "realpaver/CSPSpaceDMDFS.hpp"
 #include "realpaver/CSPSpaceHybridDFS.hpp"
 #include "realpaver/DomainSlicerFactory.hpp"
+#include "realpaver/EventLog.hpp"
 #include "realpaver/Logger.hpp"
-#include <limits>
+#include <algorithm>
 #include <list>
 #include <string>
 
@@ -36,16 +37,33 @@ CSPSolver::CSPSolver(const Problem &problem)
     : problem_(nullptr)
     , preprob_(nullptr)
     , preproc_(nullptr)
+    , region_(nullptr)
+    , preprocessed_(false)
+    , fixed_()
     , context_(nullptr)
     , env_(nullptr)
+    , settings_()
     , space_(nullptr)
+    , trail_(nullptr)
     , propagator_(nullptr)
     , split_(nullptr)
     , factory_(nullptr)
+    , decomp_(nullptr)
+    , tracefile_()
+    , trace_(nullptr)
     , prover_(nullptr)
+    , pool_(nullptr)
+    , sub_()
+    , onsol_()
+    , streamed_(false)
     , stimer_()
+    , mtimer_()
+    , utimer_()
+    , ttimer_()
+    , firstnode_(0.0)
     , nbnodes_(0)
     , withPreprocessing_(true)
+    , reuse_(false)
 {
    THROW_IF(!problem.isCSP(), "CSP solver applied to a problem that is "
                                   << "not a constraint satisfaction problem");
@@ -57,24 +75,86 @@ CSPSolver::CSPSolver(const Problem &problem)
 
 CSPSolver::~CSPSolver()
 {
-   if (context_ != nullptr)
-      delete context_;
+   clearSearch();
+   clearModel();
+
    if (preproc_ != nullptr)
       delete preproc_;
+   if (region_ != nullptr)
+      delete region_;
+   if (trace_ != nullptr)
+      delete trace_;
+   if (problem_ != nullptr)
+      delete problem_;
+}
+
+void CSPSolver::clearSearch()
+{
+   if (pool_ != nullptr)
+   {
+      delete pool_;
+      pool_ = nullptr;
+   }
+   sub_.clear();
+
    if (space_ != nullptr)
+   {
       delete space_;
-   if (factory_ != nullptr)
-      delete factory_;
+      space_ = nullptr;
+   }
+   trail_ = nullptr;
+
+   if (context_ != nullptr)
+   {
+      delete context_;
+      context_ = nullptr;
+   }
+
+   // the times and the counters only cover the last solving
+   stimer_.reset();
+   mtimer_.reset();
+   utimer_.reset();
+   firstnode_ = 0.0;
+   nbnodes_ = 0;
+}
+
+void CSPSolver::clearModel()
+{
+   if (decomp_ != nullptr)
+   {
+      delete decomp_;
+      decomp_ = nullptr;
+   }
    if (split_ != nullptr)
+   {
       delete split_;
+      split_ = nullptr;
+   }
    if (propagator_ != nullptr)
+   {
       delete propagator_;
+      propagator_ = nullptr;
+   }
    if (prover_ != nullptr)
+   {
       delete prover_;
-   if (preprob_ != nullptr)
+      prover_ = nullptr;
+   }
+   if (factory_ != nullptr)
+   {
+      delete factory_;
+      factory_ = nullptr;
+   }
+
+   // the input problem is solved if there is no preprocessing
+   if (preprob_ != nullptr && preprob_ != problem_)
       delete preprob_;
-   if (problem_ != nullptr)
-      delete problem_;
+   preprob_ = nullptr;
+}
+
+bool CSPSolver::hasReusedModel() const
+{
+   return reuse_;
 }
 
 double CSPSolver::getSolvingTime() const
@@ -82,25 +162,124 @@ double CSPSolver::getSolvingTime() const
    return stimer_.elapsedTime();
 }
 
+double CSPSolver::getModelTime() const
+{
+   return mtimer_.elapsedTime();
+}
+
+double CSPSolver::getSetupTime() const
+{
+   return utimer_.elapsedTime();
+}
+
+double CSPSolver::getFirstNodeTime() const
+{
+   return firstnode_;
+}
+
 int CSPSolver::getTotalNodes() const
 {
    return nbnodes_;
 }
 
+size_t CSPSolver::nbFastEvals() const
+{
+   if (decomp_ != nullptr)
+      return decomp_->nbFastEvals();
+
+   else if (factory_ != nullptr)
+      return factory_->getDag()->nbFastEvals();
+
+   else
+      return 0;
+}
+
+size_t CSPSolver::nbFastProofs() const
+{
+   if (decomp_ != nullptr)
+      return decomp_->nbFastProofs();
+
+   else if (factory_ != nullptr)
+      return factory_->getDag()->nbFastProofs();
+
+   else
+      return 0;
+}
+
 void CSPSolver::solve()
+{
+   solve(DomainBox(problem_->scope()));
+}
+
+void CSPSolver::solve(const DomainBox &region)
 {
    LOG_MAIN("Input problem\n" << (*problem_));
 
+   ttimer_.reset();
+   ttimer_.start();
+
    int fp = env_->getParams()->getIntParam("FLOAT_PRECISION");
    Logger::getInstance()->setFloatPrecision(fp);
 
+   // initial region of the input problem
+   if (region_ != nullptr)
+      delete region_;
+   region_ = new DomainBox(problem_->scope());
+   region_->setOnScope(region, problem_->scope() & region.scope());
+
+   // the search of the previous solving is discarded, not the model
+   clearSearch();
+   streamed_ = false;
+   bool withModel = (factory_ != nullptr);
+
+   // a problem already preprocessed is not preprocessed again, its fixed
+   // variables being only removed from the search
    std::string pre = env_->getParams()->getStrParam("PREPROCESSING");
-   if (pre == "YES")
+   bool restore = preprocessed_ && !fixed_.isEmpty();
+
+   if ((pre == "YES" && !preprocessed_) || restore)
    {
       // preprocessing + branch-and-prune
       withPreprocessing_ = true;
-      preprob_ = new Problem();
-      preproc_->apply(*problem_, *preprob_);
+      Problem *dest = new Problem();
+      Preprocessor *proc = new Preprocessor();
+
+      int nbt = env_->getParams()->getIntParam("NB_THREADS");
+      proc->setNbThreads(nbt);
+
+      if (restore)
+         proc->restore(*problem_, *region_, fixed_, *dest);
+      else
+         proc->apply(*problem_, *region_, *dest);
+
+      // the model is reused if the simplified problem has the same structure,
+      // the variables of the previous simplified problem being assigned the
+      // new domains
+      reuse_ = withModel && preprob_ != problem_ && !proc->isSolved() &&
+               proc->hasSameOutcome(*preproc_);
+
+      if (reuse_)
+      {
+         LOG_MAIN("Reuses the model of the previous solving");
+
+         for (size_t i = 0; i < proc->nbUnfixedVars(); ++i)
+         {
+            Variable v = proc->getUnfixedVar(i);
+            std::unique_ptr<Domain> dom(proc->srcToDestVar(v).getDomain()->clone());
+            preproc_->srcToDestVar(v).setDomain(std::move(dom));
+         }
+
+         proc->assignDestVars(*preproc_);
+         delete dest;
+      }
+      else
+      {
+         clearModel();
+         preprob_ = dest;
+      }
+
+      delete preproc_;
+      preproc_ = proc;
 
       if (!preproc_->isSolved())
          branchAndPrune();
@@ -111,43 +290,87 @@ void CSPSolver::solve()
       LOG_MAIN("No preprocessing");
 
       withPreprocessing_ = false;
-      preprob_ = problem_;
-      problem_ = nullptr;
+      reuse_ = withModel && preprob_ == problem_;
+
+      if (reuse_)
+      {
+         LOG_MAIN("Reuses the model of the previous solving");
+      }
+      else
+      {
+         clearModel();
+         preprob_ = problem_;
+      }
+
       branchAndPrune();
    }
+
+   ttimer_.stop();
+}
+
+void CSPSolver::setPreprocessed(const Scope &fixed)
+{
+   preprocessed_ = true;
+   fixed_ = fixed;
+}
+
+void CSPSolver::setSearchTrace(const std::string &filename)
+{
+   tracefile_ = filename;
+}
+
+void CSPSolver::setSolutionCallback(SolutionCallback f)
+{
+   onsol_ = f;
+}
+
+bool CSPSolver::hasStreamedSolutions() const
+{
+   return streamed_;
 }
 
 void CSPSolver::makeSpace()
 {
    LOG_LOW("Makes the space in the CSP solver");
 
-   // gets the strategy from the parameters
-   std::string s = env_->getParams()->getStrParam("BP_NODE_SELECTION");
-   if (s == "DFS")
-      space_ = new CSPSpaceDFS();
+   trail_ = nullptr;
 
-   else if (s == "BFS")
+   switch (settings_.nodeSelection)
+   {
+   case CSPNodeSelection::DFS:
+   {
+      CSPSpaceDFS *dfs = new CSPSpaceDFS(settings_.domainTrail);
+      trail_ = dfs->getTrail();
+      space_ = dfs;
+      break;
+   }
+   case CSPNodeSelection::BFS:
       space_ = new CSPSpaceBFS();
-
-   else if (s == "DMDFS")
+      break;
+   case CSPNodeSelection::DMDFS:
       space_ = new CSPSpaceDMDFS();
-
-   else if (s == "IDFS")
+      break;
+   case CSPNodeSelection::IDFS:
       space_ = new CSPSpaceHybridDFS(HybridDFSStyle::Depth);
-
-   else if (s == "PDFS")
+      break;
+   case CSPNodeSelection::PDFS:
       space_ = new CSPSpaceHybridDFS(HybridDFSStyle::Perimeter);
-
-   else if (s == "GPDFS")
+      break;
+   case CSPNodeSelection::GPDFS:
       space_ = new CSPSpaceHybridDFS(HybridDFSStyle::GridPerimeter);
+      break;
+   }
 
    THROW_IF(space_ == nullptr, "Unable to make the space object in a CSP solver");
 
-   // creates and inserts the root node
-   SharedCSPNode node = std::make_shared<CSPNode>(preprob_->scope());
+   // creates and inserts the root node whose domains are the ones of the
+   // variables of the simplified problem or the initial region
+   std::unique_ptr<DomainBox> box(withPreprocessing_ ? new DomainBox(preprob_->scope())
+                                                     : region_->clone());
+   SharedCSPNode node = SharedCSPNode::make(std::move(box));
    node->setIndex(0);
 
-   space_->insertPendingNode(node);
+   space_->insertPendingNode(std::move(node));
    ++nbnodes_;
 }
 
@@ -157,40 +380,27 @@ void CSPSolver::makePropagator()
 
    CSPPropagatorList *aux = new CSPPropagatorList();
 
-   // Constraint propagation algorithm: HC4, BC4, or AFFIBE
-   std::string base = env_->getParams()->getStrParam("PROPAGATION_BASE");
-
-   if (base == "HC4")
-      aux->pushBack(CSPPropagAlgo::HC4, *factory_);
-   else if (base == "BC4")
-      aux->pushBack(CSPPropagAlgo::BC4, *factory_);
-   else if (base == "AFFINE")
-      aux->pushBack(CSPPropagAlgo::AFFINE, *factory_);
-   else
-      THROW("Bad parameter value for the propagation algorithm");
-
-   // ACID contractor: YES or NO
-   std::string with_acid = env_->getParams()->getStrParam("PROPAGATION_WITH_ACID");
+   // Constraint propagation algorithm: HC4, BC4, POLYNOMIAL or AFFINE
+   aux->pushBack(settings_.propagationBase, *factory_);
 
-   if (with_acid == "YES")
+   // ACID contractor
+   if (settings_.withAcid)
       aux->pushBack(CSPPropagAlgo::ACID, *factory_);
 
-   // Polytope hull contractor: YES or NO
-   std::string with_polytope =
-       env_->getParams()->getStrParam("PROPAGATION_WITH_POLYTOPE_HULL");
-
-   if (with_polytope == "YES")
+   // Polytope hull contractor
+   if (settings_.withPolytope)
       aux->pushBack(CSPPropagAlgo::Polytope, *factory_);
 
-   // Newton: YES or NO
-   std::string with_newton = env_->getParams()->getStrParam("PROPAGATION_WITH_NEWTON");
-
-   if (with_newton == "YES")
+   // Newton
+   if (settings_.withNewton)
       aux->pushBack(CSPPropagAlgo::Newton, *factory_);
 
    if (aux->size() == 0)
       THROW("Unable to create the propagator in the CSP solver");
 
+   // the propagators are the stages of the search trace
+   aux->setTrace(trace_);
+
    propagator_ = aux;
 }
 
@@ -201,48 +411,65 @@ void CSPSolver::makeSplit()
    Scope scop = preprob_->scope();
 
    // makes the slicer
-   std::string sli = env_->getParams()->getStrParam("SPLIT_SLICING");
    std::unique_ptr<DomainSlicerMap> smap = nullptr;
 
-   if (sli == "BI")
+   switch (settings_.slicing)
    {
-      double sip = env_->getParams()->getDblParam("SPLIT_INTERVAL_POINT");
-      smap = DomainSlicerFactory::makeBiStrategy(sip);
+   case CSPSlicing::Bi:
+      smap = DomainSlicerFactory::makeBiStrategy(settings_.intervalPoint);
+      break;
+   case CSPSlicing::KWay:
+      smap = DomainSlicerFactory::makeKWayStrategy(settings_.arity,
+                                                   settings_.intervalPoint);
+      break;
+   case CSPSlicing::Adaptive:
+      smap = DomainSlicerFactory::makeKWayStrategy(2, settings_.intervalPoint);
+      break;
    }
 
    THROW_IF(smap == nullptr, "Unable to make the split object in a CSP solver");
 
    // makes the spliting object acording the variable selection strategy
-   std::string sel = env_->getParams()->getStrParam("SPLIT_SELECTION");
-
-   if (sel == "RR")
+   switch (settings_.varSelection)
+   {
+   case CSPVarSelection::RR:
       split_ = new CSPSplitRR(scop, std::move(smap));
+      break;
 
-   else if (sel == "LF")
+   case CSPVarSelection::LF:
       split_ = new CSPSplitLF(scop, std::move(smap));
+      break;
 
-   else if (sel == "SF")
+   case CSPVarSelection::SF:
       split_ = new CSPSplitSF(scop, std::move(smap));
+      break;
 
-   else if (sel == "SLF")
+   case CSPVarSelection::SLF:
       split_ = new CSPSplitSLF(scop, std::move(smap));
+      break;
 
-   else if (sel == "SSR")
+   case CSPVarSelection::SSR:
       split_ =
           new CSPSplitSSR(scop, std::move(smap), factory_->makeIntervalFunctionVector());
+      break;
 
-   else if (sel == "SSR_LF")
+   case CSPVarSelection::SSR_LF:
    {
       CSPSplitSSRLF *hybrid = new CSPSplitSSRLF(scop, std::move(smap),
                                                 factory_->makeIntervalFunctionVector());
-
-      double f = env_->getParams()->getDblParam("SPLIT_SSR_LF_FREQUENCY");
-      hybrid->setFrequency(f);
-
+      hybrid->setFrequency(settings_.ssrLfFrequency);
       split_ = hybrid;
+      break;
+   }
    }
 
    THROW_IF(split_ == nullptr, "Unable to make the split object in a CSP solver");
+
+   if (settings_.slicing == CSPSlicing::Adaptive)
+      split_->setMaxArity(settings_.arity);
+
+   // the trail-based space rebuilds the sub-nodes from their parent
+   split_->setDeltaNodes(trail_ != nullptr);
 }
 
 bool CSPSolver::isInner(DomainBox *box) const
@@ -258,21 +485,31 @@ bool CSPSolver::isInner(DomainBox *box) const
    return true;
 }
 
-void CSPSolver::bpStep(int depthlimit)
+void CSPSolver::bpStep()
 {
 #if LOG_ON
    static Timer timerStep;
    timerStep.start();
 #endif
 
-   // extracts a node from the space
+   // extracts a node from the space, which may be moved in the space of
+   // solutions during its processing
    SharedCSPNode node = space_->nextPendingNode();
+   int index = node->index();
 
    // processes it
-   bpStepAux(node, depthlimit);
+   if (trace_ != nullptr)
+   {
+      trace_->beginNode(*node);
+      CSPTraceStatus status = bpStepAux(node);
+      int v = (status == CSPTraceStatus::Split) ? split_->getSplitVar().id() : -1;
+      trace_->endNode(status, v);
+   }
+   else
+      bpStepAux(node);
 
    // removes the node informations
-   context_->remove(node->index());
+   context_->remove(index);
 
 #if LOG_ON
    timerStep.stop();
@@ -280,7 +517,7 @@ void CSPSolver::bpStep(int depthlimit)
 #endif
 }
 
-void CSPSolver::bpStepAux(SharedCSPNode node, int depthlimit)
+CSPTraceStatus CSPSolver::bpStepAux(SharedCSPNode &node)
 {
 #if LOG_ON
    static Timer timerPropag, timerSplit;
@@ -289,6 +526,19 @@ void CSPSolver::bpStepAux(SharedCSPNode node, int depthlimit)
    LOG_NL_INTER();
    LOG_INTER("Extracts node " << node->index() << " (depth " << node->depth() << ")");
    LOG_LOW("Node: " << (*node->box()));
+   LOG_EVENT(LogEvent::Extract, node->index(), node->depth());
+
+#if LOG_ON
+   if (LogEventLevel(LogEvent::Domain) <= EventLog::getInstance()->getLogLevel())
+   {
+      for (const auto &v : node->scope())
+      {
+         Interval x = node->box()->get(v)->intervalHull();
+         EventLog::getInstance()->push(LogEvent::Domain, node->index(), v.id(), x.left(),
+                                       x.right());
+      }
+   }
+#endif
 
    node->setProof(Proof::Maybe);
 
@@ -297,7 +547,7 @@ void CSPSolver::bpStepAux(SharedCSPNode node, int depthlimit)
 #endif
 
    // contracts the box
-   Proof proof = propagator_->contract(*node, *context_);
+   Proof proof = propagator_->contract(*node, *context_, trail_);
 
 #if LOG_ON
    timerPropag.stop();
@@ -305,11 +555,15 @@ void CSPSolver::bpStepAux(SharedCSPNode node, int depthlimit)
 #endif
 
    LOG_INTER("Contraction -> " << proof);
+   LOG_EVENT(LogEvent::Contract, node->index(), static_cast<uint32_t>(proof));
+
+   if (trace_ != nullptr)
+      trace_->setProof(proof);
 
    if (proof == Proof::Empty)
    {
       node->setProof(Proof::Empty);
-      return;
+      return CSPTraceStatus::Empty;
    }
    else
    {
@@ -319,24 +573,25 @@ void CSPSolver::bpStepAux(SharedCSPNode node, int depthlimit)
    if (isInner(node->box()))
    {
       LOG_INTER("Node " << node->index() << " contains an inner box");
+      LOG_EVENT(LogEvent::Inner, node->index());
 
       node->setProof(Proof::Inner);
 
-      std::string str = env_->getParams()->getStrParam("SPLIT_INNER_BOX");
-      if (str == "NO")
+      if (!settings_.splitInnerBox)
       {
-         space_->pushSolNode(node);
-         return;
+         pushSolNode(std::move(node));
+         return CSPTraceStatus::Solution;
       }
    }
 
    // node depth limit
    int depth = node->depth() + 1;
-   if (depth >= depthlimit)
+   if (depth >= settings_.depthLimit)
    {
       LOG_INTER("Node fathomed due to the depth limit");
+      LOG_EVENT(LogEvent::DepthLimit, node->index());
       env_->setDepthLimit(true);
-      return;
+      return CSPTraceStatus::DepthLimit;
    }
 
 #if LOG_ON
@@ -345,24 +600,29 @@ void CSPSolver::bpStepAux(SharedCSPNode node, int depthlimit)
 
    // splits the node
    split_->apply(node, *context_);
+   CSPTraceStatus status = CSPTraceStatus::Split;
 
    if (split_->getNbNodes() <= 1)
    {
       LOG_INTER("Node " << node->index() << " is a solution");
+      LOG_EVENT(LogEvent::Solution, node->index());
       LOG_LOW(*node->box());
 
-      space_->pushSolNode(node);
+      pushSolNode(std::move(node));
+      status = CSPTraceStatus::Solution;
    }
    else
    {
       LOG_INTER("Node " << node->index() << " is split into " << split_->getNbNodes()
                         << " sub-nodes");
+      LOG_EVENT(LogEvent::Split, node->index(), split_->getNbNodes());
 
 #if LOG_ON
       for (auto it = split_->begin(); it != split_->end(); ++it)
       {
-         SharedCSPNode subnode = *it;
+         const SharedCSPNode &subnode = *it;
          LOG_INTER("Inserts node " << subnode->index() << " in the space");
+         LOG_EVENT(LogEvent::Insert, subnode->index());
          LOG_LOW(*subnode->box());
       }
 #endif
@@ -375,6 +635,8 @@ void CSPSolver::bpStepAux(SharedCSPNode node, int depthlimit)
    timerSplit.stop();
    LOG_INTER("Total time split : " << timerSplit.elapsedTime() << "(s)");
 #endif
+
+   return status;
 }
 
 void CSPSolver::branchAndPrune()
@@ -382,52 +644,95 @@ void CSPSolver::branchAndPrune()
    LOG_MAIN("Branch-and-prune algorithm on the following problem\n" << (*preprob_));
    LOG_INTER("Parameters\n" << *env_->getParams());
 
-   stimer_.start();
+#if LOG_ON
+   // names of the variables in the binary log
+   if (EventLog::getInstance()->getLogLevel() != LogLevel::none)
+   {
+      for (const auto &v : preprob_->scope())
+         EventLog::getInstance()->defineVar(v.id(), v.getName());
+   }
+#endif
 
-   context_ = new CSPContext();
+   stimer_.start();
 
-   LOG_NL_LOW();
-   LOG_LOW("Makes the factory in the CSP solver");
-   factory_ = new ContractorFactory(*preprob_, env_);
+   // resolves the parameters once and for all
+   settings_ = CSPSettings(*env_->getParams());
 
-   makeSpace();
-   makePropagator();
-   makeSplit();
+   if (!reuse_)
+   {
+      if (settings_.decomposition && decompose())
+      {
+         stimer_.stop();
+         return;
+      }
 
-   // prover that derives proof certificates of the solutions
-   prover_ = new Prover(*preprob_);
+      LOG_NL_LOW();
+      LOG_LOW("Makes the factory in the CSP solver");
 
-   int niter = env_->getParams()->getIntParam("NEWTON_CERTIFY_ITER_LIMIT");
-   prover_->setMaxIter(niter);
+      mtimer_.start();
+      factory_ = new ContractorFactory(*preprob_, env_);
+      mtimer_.stop();
+   }
 
-   double delta = env_->getParams()->getDblParam("INFLATION_DELTA");
-   prover_->setInflationDelta(delta);
+   context_ = new CSPContext();
 
-   double chi = env_->getParams()->getDblParam("INFLATION_CHI");
-   prover_->setInflationChi(chi);
+   utimer_.start();
 
-   // parameters
-   bool trace = env_->getParams()->getStrParam("TRACE") == "YES";
-   int tracefreq = env_->getParams()->getIntParam("TRACE_FREQUENCY");
-   bool complete = (env_->getParams()->getStrParam("SEARCH_STATUS") == "COMPLETE");
+   // search trace whose stages are defined by the propagator
+   if (trace_ != nullptr)
+   {
+      delete trace_;
+      trace_ = nullptr;
+   }
+   if (!tracefile_.empty())
+   {
+      trace_ = new CSPTrace(tracefile_);
+      for (const auto &v : preprob_->scope())
+         trace_->defineVar(v.id(), v.getName());
+   }
 
-   double time_limit;
-   int node_limit, sol_limit, depth_limit;
+   makeSpace();
 
-   if (complete)
+   if (reuse_)
    {
-      time_limit = Double::inf();
-      node_limit = std::numeric_limits<int>::max();
-      sol_limit = std::numeric_limits<int>::max();
-      depth_limit = std::numeric_limits<int>::max();
+      propagator_->setTrace(trace_);
+      propagator_->reset();
+      split_->reset();
+      split_->setDeltaNodes(trail_ != nullptr);
    }
    else
    {
-      time_limit = env_->getParams()->getDblParam("TIME_LIMIT");
-      node_limit = env_->getParams()->getIntParam("NODE_LIMIT");
-      sol_limit = env_->getParams()->getIntParam("SOLUTION_LIMIT");
-      depth_limit = env_->getParams()->getIntParam("DEPTH_LIMIT");
+      makePropagator();
+      makeSplit();
+
+      // prover that derives proof certificates of the solutions
+      prover_ = new Prover(*preprob_);
+
+      prover_->setMaxIter(settings_.newtonCertifyIter);
+      prover_->setInflationDelta(settings_.inflationDelta);
+      prover_->setInflationChi(settings_.inflationChi);
+   }
+
+   // the solutions are final when they are found if they are neither
+   // certified nor clustered afterwards
+   streamed_ = onsol_ && !settings_.certification && settings_.clusterGap < 0.0;
+
+   // the solution nodes are certified during the search if they are not
+   // clustered afterwards
+   size_t nbt = nbCertifyThreads();
+   if (settings_.certification && settings_.eagerCertification &&
+       settings_.clusterGap < 0.0 && nbt > 0)
+   {
+      LOG_LOW("Eager certification with " << nbt << " thread(s)");
+      pool_ = new ProverPool(*prover_, nbt);
    }
+   utimer_.stop();
+
+   const bool trace = settings_.trace;
+   const int tracefreq = settings_.traceFrequency;
+   const double time_limit = settings_.timeLimit;
+   const int node_limit = settings_.nodeLimit;
+   const int sol_limit = settings_.solutionLimit;
 
    env_->setTimeLimit(false);
    env_->setNodeLimit(false);
@@ -443,10 +748,14 @@ void CSPSolver::branchAndPrune()
    timerBP.start();
 #endif
 
+   firstnode_ = ttimer_.elapsedTime();
+   LOG_MAIN("Time to first node: " << firstnode_ << "s (model: " << getModelTime()
+                                   << "s, setup: " << getSetupTime() << "s)");
+
    do
    {
       ++nb_nodes_processed;
-      bpStep(depth_limit);
+      bpStep();
 
       // trace every new solution
       size_t nb_sol = space_->nbSolNodes();
@@ -506,8 +815,10 @@ void CSPSolver::branchAndPrune()
 #endif
    } while (iter);
 
-   double gap = env_->getParams()->getDblParam("SOLUTION_CLUSTER_GAP");
-   space_->makeSolClusters(gap);
+   if (trace_ != nullptr)
+      trace_->close();
+
+   space_->makeSolClusters(settings_.clusterGap);
 
 #if LOG_ON
    timerBP.stop();
@@ -516,8 +827,7 @@ void CSPSolver::branchAndPrune()
 
    LOG_NL_MAIN();
 
-   std::string sc = env_->getParams()->getStrParam("CERTIFICATION");
-   if (sc == "YES")
+   if (settings_.certification)
    {
       LOG_INTER("Certification a posteriori");
       certifySolutions();
@@ -530,18 +840,106 @@ void CSPSolver::branchAndPrune()
    stimer_.stop();
 }
 
+bool CSPSolver::decompose()
+{
+   decomp_ = new CSPDecomposition(*preprob_);
+
+   if (decomp_->nbComponents() <= 1)
+   {
+      delete decomp_;
+      decomp_ = nullptr;
+      return false;
+   }
+
+   LOG_MAIN("Decomposition in " << decomp_->nbComponents() << " sub-problems");
+
+   // the sub-problems are solved in parallel if they do not log messages
+   size_t nbt = 1;
+   if (!settings_.trace && Logger::getInstance()->getLogLevel() == LogLevel::none)
+      nbt = env_->getParams()->getIntParam("NB_THREADS");
+
+   // the time limit includes the preprocessing time
+   Params prm(*env_->getParams());
+   if (!settings_.complete)
+   {
+      double tl = settings_.timeLimit - preproc_->elapsedTime();
+      prm.setDblParam("TIME_LIMIT", std::max(0.0, tl));
+   }
+
+   firstnode_ = ttimer_.elapsedTime();
+
+   decomp_->solve(prm, nbt);
+   decomp_->updateEnv(*env_);
+   nbnodes_ = decomp_->getTotalNodes();
+
+   return true;
+}
+
+void CSPSolver::pushSolNode(SharedCSPNode node)
+{
+   space_->pushSolNode(std::move(node));
+
+   // the space may store a copy of node, hence the last solution node is
+   // submitted with its index and given to the callback
+   SharedCSPNode sol = space_->getSolNode(space_->nbSolNodes() - 1);
+
+   if (pool_ != nullptr)
+      sub_.push_back(pool_->submit(IntervalBox(*sol->box())));
+
+   if (streamed_)
+      onsol_(toInputBox(*sol->box()), sol->getProof());
+}
+
+size_t CSPSolver::nbCertifyThreads() const
+{
+   // the provers log messages at the inter level
+   if (Logger::getInstance()->getLogLevel() >= LogLevel::inter)
+      return 0;
+
+   return env_->getParams()->getIntParam("NB_THREADS");
+}
+
 void CSPSolver::certifySolutions()
 {
-   std::list<SharedCSPNode> lsol;
+   std::vector<SharedCSPNode> vsol;
    while (space_->nbSolNodes() > 0)
+      vsol.push_back(space_->popSolNode());
+
+   // pool of provers if the solutions have not been submitted eagerly
+   size_t nbt = nbCertifyThreads();
+   if (pool_ == nullptr && nbt > 1 && vsol.size() > 1)
+      pool_ = new ProverPool(*prover_, std::min(nbt, vsol.size()));
+
+   // vsol[j] is the solution node of index n-1-j in the space
+   size_t n = vsol.size();
+
+   if (pool_ != nullptr)
    {
-      SharedCSPNode node = space_->popSolNode();
-      Proof proof = node->getProof();
+      // submits the solution nodes that have not been submitted eagerly
+      for (size_t i = sub_.size(); i < n; ++i)
+         sub_.push_back(pool_->submit(IntervalBox(*vsol[n - 1 - i]->box())));
+
+      pool_->wait();
+   }
 
+   std::list<SharedCSPNode> lsol;
+   for (size_t j = 0; j < n; ++j)
+   {
+      SharedCSPNode &node = vsol[j];
       DomainBox *dbox = node->box();
       IntervalBox B(*dbox);
+      Proof proof;
 
-      proof = prover_->certify(B);
+      if (pool_ != nullptr)
+      {
+         size_t i = sub_[n - 1 - j];
+         B = pool_->getBox(i);
+         proof = pool_->getProof(i);
+      }
+      else
+         proof = prover_->certify(B);
+
+      LOG_EVENT(LogEvent::Certify, node->index(), static_cast<uint32_t>(proof));
 
       if (proof != Proof::Empty)
       {
@@ -560,13 +958,20 @@ void CSPSolver::certifySolutions()
          }
 
          node->setProof(proof);
-         lsol.push_back(node);
+         lsol.push_back(std::move(node));
       }
    }
 
+   if (pool_ != nullptr)
+   {
+      delete pool_;
+      pool_ = nullptr;
+      sub_.clear();
+   }
+
    while (!lsol.empty())
    {
-      space_->pushSolNode(lsol.front());
+      space_->pushSolNode(std::move(lsol.front()));
       lsol.pop_front();
    }
 }
@@ -581,6 +986,11 @@ CSPSpace *CSPSolver::getSpace() const
    return space_;
 }
 
+const CSPDecomposition *CSPSolver::getDecomposition() const
+{
+   return decomp_;
+}
+
 Preprocessor *CSPSolver::getPreprocessor() const
 {
    return preproc_;
@@ -591,41 +1001,66 @@ size_t CSPSolver::nbSolutions() const
    if (withPreprocessing_ && preproc_->isSolved())
       return preproc_->isUnfeasible() ? 0 : 1;
 
+   else if (decomp_ != nullptr)
+      return decomp_->nbSolutions();
+
    else
       return space_->nbSolNodes();
 }
 
+bool CSPSolver::hasFeasibleSolution() const
+{
+   if (withPreprocessing_ && preproc_->isSolved())
+      return !preproc_->isUnfeasible();
+
+   else if (decomp_ != nullptr)
+      return decomp_->hasFeasibleSolution();
+
+   else
+      return space_->hasFeasibleSolNode();
+}
+
+std::pair<DomainBox, Proof> CSPSolver::getSolutionAux(size_t i) const
+{
+   if (decomp_ != nullptr)
+      return decomp_->getSolution(i);
+
+   SharedCSPNode node = space_->getSolNode(i);
+   return std::make_pair(DomainBox(*node->box()), node->getProof());
+}
+
+DomainBox CSPSolver::getPendingBoxAux(size_t i) const
+{
+   if (decomp_ != nullptr)
+      return decomp_->getPendingBox(i);
+
+   SharedCSPNode node = space_->getPendingNode(i);
+   return DomainBox(*node->box());
+}
+
 std::pair<DomainBox, Proof> CSPSolver::getSolution(size_t i) const
 {
    ASSERT(i < nbSolutions(), "Bad access to a solution in a CSP solver @ " << i);
 
    if (withPreprocessing_)
    {
-      DomainBox box(problem_->scope());
+      DomainBox box(*region_);
       Proof proof = Proof::Inner;
 
       // assigns the values of the fixed variables
-      for (size_t i = 0; i < preproc_->nbFixedVars(); ++i)
-      {
-         Variable v = preproc_->getFixedVar(i);
-         Interval x = preproc_->getFixedDomain(v);
-         Domain *dom = box.get(v);
-         dom->contract(x);
-      }
+      assignFixedDomains(box);
 
       // assigns the values of the unfixed variables
       if (!preproc_->allVarsFixed())
       {
-         SharedCSPNode node = space_->getSolNode(i);
-         proof = node->getProof();
-
-         DomainBox *aux = node->box();
+         std::pair<DomainBox, Proof> sol = getSolutionAux(i);
+         proof = sol.second;
 
          for (size_t i = 0; i < preproc_->nbUnfixedVars(); ++i)
          {
             Variable v = preproc_->getUnfixedVar(i);
             Variable w = preproc_->srcToDestVar(v);
-            std::unique_ptr<Domain> p(aux->get(w)->clone());
+            std::unique_ptr<Domain> p(sol.first.get(w)->clone());
             box.set(v, std::move(p));
          }
       }
@@ -633,19 +1068,84 @@ std::pair<DomainBox, Proof> CSPSolver::getSolution(size_t i) const
       return std::make_pair(box, proof);
    }
    else
+      return getSolutionAux(i);
+}
+
+void CSPSolver::assignFixedDomains(DomainBox &box) const
+{
+   for (size_t i = 0; i < preproc_->nbFixedVars(); ++i)
    {
-      SharedCSPNode node = space_->getSolNode(i);
-      Proof proof = node->getProof();
-      DomainBox aux(*node->box());
-      return std::make_pair(aux, proof);
+      Variable v = preproc_->getFixedVar(i);
+      Interval x = preproc_->getFixedDomain(v);
+      Domain *dom = box.get(v);
+      dom->contract(x);
    }
 }
 
+DomainBox CSPSolver::toInputBox(const DomainBox &box) const
+{
+   DomainBox res(*region_);
+
+   if (!withPreprocessing_)
+   {
+      res.setOnScope(box, box.scope());
+      return res;
+   }
+
+   assignFixedDomains(res);
+
+   // assigns the values of the unfixed variables in the scope of box
+   Scope scop = box.scope();
+   for (size_t j = 0; j < preproc_->nbUnfixedVars(); ++j)
+   {
+      Variable v = preproc_->getUnfixedVar(j);
+      Variable w = preproc_->srcToDestVar(v);
+
+      if (scop.contains(w))
+      {
+         std::unique_ptr<Domain> p(box.get(w)->clone());
+         res.set(v, std::move(p));
+      }
+   }
+
+   return res;
+}
+
+std::pair<DomainBox, Proof> CSPSolver::getComponentSolution(size_t k, size_t i) const
+{
+   ASSERT(decomp_ != nullptr, "No decomposition in a CSP solver");
+
+   std::pair<DomainBox, Proof> sol = decomp_->getComponentSolution(k, i);
+   return std::make_pair(toInputBox(sol.first), sol.second);
+}
+
+Scope CSPSolver::getComponentScope(size_t k) const
+{
+   ASSERT(decomp_ != nullptr, "No decomposition in a CSP solver");
+
+   Scope comp = decomp_->getComponentScope(k);
+
+   if (!withPreprocessing_)
+      return comp;
+
+   Scope res;
+   for (size_t j = 0; j < preproc_->nbUnfixedVars(); ++j)
+   {
+      Variable v = preproc_->getUnfixedVar(j);
+      if (comp.contains(preproc_->srcToDestVar(v)))
+         res.insert(v);
+   }
+   return res;
+}
+
 size_t CSPSolver::nbPendingNodes() const
 {
-   if (preproc_->isSolved())
+   if (withPreprocessing_ && preproc_->isSolved())
       return 0;
 
+   else if (decomp_ != nullptr)
+      return decomp_->nbPendingNodes();
+
    else
       return space_->nbPendingNodes();
 }
@@ -656,28 +1156,21 @@ DomainBox CSPSolver::getPendingBox(size_t i) const
 
    if (withPreprocessing_)
    {
-      DomainBox box(problem_->scope());
+      DomainBox box(*region_);
 
       // assigns the values of the fixed variables
-      for (size_t i = 0; i < preproc_->nbFixedVars(); ++i)
-      {
-         Variable v = preproc_->getFixedVar(i);
-         Interval x = preproc_->getFixedDomain(v);
-         Domain *dom = box.get(v);
-         dom->contract(x);
-      }
+      assignFixedDomains(box);
 
       // assigns the values of the unfixed variables
       if (!preproc_->allVarsFixed())
       {
-         SharedCSPNode node = space_->getPendingNode(i);
-         DomainBox *aux = node->box();
+         DomainBox aux = getPendingBoxAux(i);
 
          for (size_t i = 0; i < preproc_->nbUnfixedVars(); ++i)
          {
             Variable v = preproc_->getUnfixedVar(i);
             Variable w = preproc_->srcToDestVar(v);
-            std::unique_ptr<Domain> p(aux->get(w)->clone());
+            std::unique_ptr<Domain> p(aux.get(w)->clone());
             box.set(v, std::move(p));
          }
       }
@@ -685,11 +1178,7 @@ DomainBox CSPSolver::getPendingBox(size_t i) const
       return box;
    }
    else
-   {
-      SharedCSPNode node = space_->getPendingNode(i);
-      DomainBox aux(*node->box());
-      return aux;
-   }
+      return getPendingBoxAux(i);
 }
 
 const Problem &CSPSolver::getProblem() const
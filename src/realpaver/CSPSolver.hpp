@@ -21,15 +21,22 @@
 #ifndef REALPAVER_CSP_SOLVER_HPP
 #define REALPAVER_CSP_SOLVER_HPP
 
+#include "realpaver/CSPDecomposition.hpp"
 #include "realpaver/CSPEnv.hpp"
 #include "realpaver/CSPPropagator.hpp"
+#include "realpaver/CSPSettings.hpp"
 #include "realpaver/CSPSpace.hpp"
 #include "realpaver/CSPSplit.hpp"
+#include "realpaver/CSPTrace.hpp"
 #include "realpaver/Preprocessor.hpp"
 #include "realpaver/Problem.hpp"
 #include "realpaver/Prover.hpp"
+#include "realpaver/ProverPool.hpp"
 #include "realpaver/Timer.hpp"
+#include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace realpaver {
 
@@ -59,9 +66,53 @@ namespace realpaver {
    @endverbatim
  *
  * The scope of each solution is the one of the input problem.
+ *
+ * If BP_DECOMPOSITION is not NO and the problem resulting from preprocessing
+ * is made of independent components, then every component is solved by its
+ * own solver, in parallel if NB_THREADS > 1 and there is no log and no trace.
+ * The solutions are then the elements of the Cartesian product of the
+ * solution sets of the components, which are generated on demand. In this
+ * case, there is no space and getSpace() returns nullptr.
+ *
+ * The solutions are certified by a pool of NB_THREADS provers if
+ * NB_THREADS > 1 and the log level is lower than INTER. If CERTIFICATION is
+ * EAGER and there is no clustering of solutions, the pool is created before
+ * the search and every solution node is certified in the background as soon
+ * as it is found. In all cases, the solutions are returned in the same order
+ * as in the sequential certification.
+ *
+ * A trace of the search tree can be written in a file for offline analysis,
+ * e.g. by rp_trace_summary. It records one row per processed node together
+ * with the effect of every propagator of the contraction step. There is no
+ * trace if the problem is decomposed.
+ *
+ * A solver can be reused to solve a sequence of instances of the same problem
+ * that only differ in the initial domains, typically in a parameter sweep
+ * where the parameters are variables with point domains:
+ *
+   @verbatim
+   CSPSolver solver(problem);
+   for (...) {
+      DomainBox region(...);  // e.g. the domains of the parameters
+      solver.solve(region);
+      ...
+   }
+   @endverbatim
+ *
+ * The model made of the DAG, the contractors, the propagator, the splitting
+ * object and the prover is built at the first solving. It is reused by the
+ * next ones if the preprocessing step generates the same simplified problem
+ * up to the domains of the variables. Only the preprocessing step and the
+ * search are then executed again. Otherwise, the model is rebuilt. It is
+ * never reused if the problem is decomposed. The parameters that define the
+ * components of the model must not be modified between two solvings, in
+ * contrast to the limits of the search.
  */
 class CSPSolver {
 public:
+   /// Type of the functions called for the solutions found during the search
+   using SolutionCallback = std::function<void(const DomainBox &box, Proof proof)>;
+
    /// Constructor
    CSPSolver(const Problem &problem);
 
@@ -74,21 +125,96 @@ public:
    /// No assignment
    CSPSolver &operator=(const CSPSolver &) = delete;
 
-   /// Solving method
+   /// Solving method from the domains of the variables
    void solve();
 
+   /**
+    * @brief Solving method from a given region.
+    *
+    * The domains of the variables of the input problem that belong to the
+    * scope of region are replaced by the domains in region, the other
+    * variables keeping their own domains. The variables of the input problem
+    * are not modified. The model of the previous solving is reused if
+    * possible.
+    */
+   void solve(const DomainBox &region);
+
+   /**
+    * @brief Declares that the input problem has already been preprocessed.
+    *
+    * @param fixed variables of the input problem fixed by the preprocessing
+    *
+    * It is typically the case of a problem read from a binary model. The
+    * variables of fixed must not occur in the constraints. The preprocessor
+    * is not applied whatever the parameters, the variables of fixed being
+    * removed from the search without propagation and restored with their
+    * domains in the solutions.
+    */
+   void setPreprocessed(const Scope &fixed);
+
+   /// Returns true if the last solving has reused the model of the previous one
+   bool hasReusedModel() const;
+
+   /**
+    * @brief Enables the trace of the search tree.
+    *
+    * The trace is written in the given file during the next solving. It is
+    * disabled if the file name is empty.
+    */
+   void setSearchTrace(const std::string &filename);
+
+   /**
+    * @brief Assigns a function called for the solutions found during the search.
+    *
+    * The box is over the scope of the input problem as the boxes returned by
+    * getSolution(). The function is only called if the solutions are final
+    * when they are found, i.e. if there is no certification, no clustering
+    * (SOLUTION_CLUSTER_GAP < 0) and no decomposition. It permits to keep the
+    * solutions found before an interruption of the solving.
+    */
+   void setSolutionCallback(SolutionCallback f);
+
+   /// Returns true if the solutions of the last solving have been given to
+   /// the solution callback
+   bool hasStreamedSolutions() const;
+
    /// Returns the solving time in seconds
    double getSolvingTime() const;
 
+   /// Returns the time spent to build the DAG and the contractor factory
+   double getModelTime() const;
+
+   /// Returns the time spent to build the search components and the prover
+   double getSetupTime() const;
+
+   /**
+    * @brief Returns the time to first node in seconds.
+    *
+    * It is the time elapsed from the beginning of the solving method to the
+    * extraction of the root node of the search tree, hence the sum of the
+    * preprocessing, model and setup times. It is equal to 0 if no node is
+    * processed, e.g. if the problem is solved at preprocessing time.
+    */
+   double getFirstNodeTime() const;
+
    /// Returns the number of nodes processed
    int getTotalNodes() const;
 
+   /// Returns the number of fast evaluations in hc4Revise
+   size_t nbFastEvals() const;
+
+   /// Returns the number of fast evaluations that have been conclusive
+   size_t nbFastProofs() const;
+
    /// Returns the environment of this
    std::shared_ptr<CSPEnv> getEnv() const;
 
-   /// Returns the space of this
+   /// Returns the space of this, nullptr if the problem is decomposed
    CSPSpace *getSpace() const;
 
+   /// Returns the decomposition of the problem, nullptr if it is not decomposed
+   const CSPDecomposition *getDecomposition() const;
+
    /// Returns the preprocessor used by this
    Preprocessor *getPreprocessor() const;
 
@@ -103,6 +229,22 @@ public:
     */
    std::pair<DomainBox, Proof> getSolution(size_t i) const;
 
+   /**
+    * @brief Gets the i-th solution of the k-th component of the decomposition.
+    *
+    * The scope of the box is the scope of the initial problem. The variables
+    * fixed at preprocessing time are assigned their fixed domains and the
+    * variables of the other components keep their initial domains.
+    */
+   std::pair<DomainBox, Proof> getComponentSolution(size_t k, size_t i) const;
+
+   /// Returns the set of variables of the initial problem in the k-th component
+   /// of the decomposition
+   Scope getComponentScope(size_t k) const;
+
+   /// Returns true if a solution is proved feasible or inner
+   bool hasFeasibleSolution() const;
+
    /// Returns the number of unexplored nodes after the solving phase
    size_t nbPendingNodes() const;
 
@@ -121,29 +263,61 @@ private:
    Problem *problem_;      // initial problem
    Problem *preprob_;      // problem resulting from preprocessing
    Preprocessor *preproc_; // preprocessor
+   DomainBox *region_;     // initial region of the input problem
+   bool preprocessed_;     // true if the input problem is preprocessed
+   Scope fixed_;           // variables fixed in the preprocessed problem
 
    CSPContext *context_; // solving context for the BP algorithm
 
-   std::shared_ptr<CSPEnv> env_; // environment
-   CSPSpace *space_;             // search tree
-   SharedDag dag_;               // dag
-   CSPPropagator *propagator_;   // contraction method
-   CSPSplit *split_;             // splitting strategy
-   ContractorFactory *factory_;  // contractor factory
+   std::shared_ptr<CSPEnv> env_;   // environment
+   CSPSettings settings_;          // snapshot of the parameters
+   CSPSpace *space_;               // search tree
+   DomainTrail *trail_;            // trail of the space or nullptr
+   SharedDag dag_;                 // dag
+   CSPPropagatorList *propagator_; // contraction method
+   CSPSplit *split_;               // splitting strategy
+   ContractorFactory *factory_;    // contractor factory
+   CSPDecomposition *decomp_;      // decomposition or nullptr
+   std::string tracefile_;         // file of the search trace or empty
+   CSPTrace *trace_;               // search trace or nullptr
+
+   Prover *prover_;          // solution prover
+   ProverPool *pool_;        // pool of provers or nullptr
+   std::vector<size_t> sub_; // i-th solution node in space_ -> index in pool_
 
-   Prover *prover_; // solution prover
+   SolutionCallback onsol_; // function called for the solutions found
+   bool streamed_;          // true if the solutions are given to onsol_
 
    Timer stimer_;           // timer for the solving phase
+   Timer mtimer_;           // timer for the construction of the model
+   Timer utimer_;           // timer for the setup of the search components
+   Timer ttimer_;           // timer from the beginning to the first node
+   double firstnode_;       // time to first node
    int nbnodes_;            // number of nodes processed
    bool withPreprocessing_; // true if preprocessing enabled
+   bool reuse_;             // true if the model is reused
 
    void branchAndPrune();
+   bool decompose();
+   void clearModel();
+   void clearSearch();
+   std::pair<DomainBox, Proof> getSolutionAux(size_t i) const;
+
+   // assigns the domains of the variables fixed at preprocessing time in box
+   void assignFixedDomains(DomainBox &box) const;
+
+   // returns a box over the scope of the input problem from a box whose
+   // scope is included in the scope of the simplified problem
+   DomainBox toInputBox(const DomainBox &box) const;
+   DomainBox getPendingBoxAux(size_t i) const;
    void makeSpace();
    void makePropagator();
    void makeSplit();
-   void bpStep(int depthlimit);
-   void bpStepAux(SharedCSPNode node, int depthlimit);
+   void bpStep();
+   CSPTraceStatus bpStepAux(SharedCSPNode &node);
    bool isInner(DomainBox *box) const;
+   void pushSolNode(SharedCSPNode node);
+   size_t nbCertifyThreads() const;
    void certifySolutions();
 };
 
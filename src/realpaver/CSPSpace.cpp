@@ -30,7 +30,7 @@ CSPSpace::~CSPSpace()
 void CSPSpace::insertPendingNodes(CSPSplit::iterator first, CSPSplit::iterator last)
 {
    for (auto it = first; it != last; ++it)
-      insertPendingNode(*it);
+      insertPendingNode(std::move(*it));
 }
 
 void CSPSpace::makeSolClusters(double gap)
@@ -50,7 +50,7 @@ void CSPSpace::makeSolClusters(double gap)
    while (!lnode.empty())
    {
       // extracts the first node
-      SharedCSPNode node = lnode.front();
+      SharedCSPNode node = std::move(lnode.front());
       DomainBox *box = node->box();
       lnode.pop_front();
 
@@ -59,8 +59,7 @@ void CSPSpace::makeSolClusters(double gap)
       auto it = lnode.begin();
       while (!found && it != lnode.end())
       {
-         SharedCSPNode bis = *it;
-         DomainBox *boxbis = bis->box();
+         DomainBox *boxbis = (*it)->box();
 
          if (box->gap(*boxbis) < gap)
          {
@@ -74,12 +73,12 @@ void CSPSpace::makeSolClusters(double gap)
 
       // this is a solution node and no other solution is close enough
       if (!found)
-         res.push_back(node);
+         res.push_back(std::move(node));
    }
 
    // pushes the solution nodes in this
-   for (const auto &node : res)
-      pushSolNode(node);
+   for (auto &node : res)
+      pushSolNode(std::move(node));
 }
 
 } // namespace realpaver
@@ -55,13 +55,13 @@ public:
    /// Returns the number of solution nodes of this
    virtual size_t nbSolNodes() const = 0;
 
-   /// Inserts a solution node in this
-   virtual void pushSolNode(const SharedCSPNode &node) = 0;
+   /// Inserts a solution node in this, the handle being moved in this
+   virtual void pushSolNode(SharedCSPNode node) = 0;
 
    /// Removes a solution node from this
    virtual SharedCSPNode popSolNode() = 0;
 
-   /// Returns the i-th solution node
+   /// Returns a new handle on the i-th solution node
    virtual SharedCSPNode getSolNode(size_t i) const = 0;
 
    /// Returns true if a solution node is feasible
@@ -86,18 +86,18 @@ public:
    /// Extracts the next pending node from this
    virtual SharedCSPNode nextPendingNode() = 0;
 
-   /// Inserts a pending node in this
-   virtual void insertPendingNode(const SharedCSPNode &node) = 0;
+   /// Inserts a pending node in this, the handle being moved in this
+   virtual void insertPendingNode(SharedCSPNode node) = 0;
 
    /**
     * @brief Inserts a collection of pending nodes in this.
     *
     * The default behavior calls insertPendingNode for each node in
-    * the range of iterators.
+    * the range of iterators. The handles are moved out of the range.
     */
    virtual void insertPendingNodes(CSPSplit::iterator first, CSPSplit::iterator last);
 
-   /// Returns the i-th pending node
+   /// Returns a new handle on the i-th pending node
    virtual SharedCSPNode getPendingNode(size_t i) const = 0;
    ///@}
 };
@@ -34,14 +34,14 @@ size_t CSPSpaceBFS::nbSolNodes() const
    return vsol_.size();
 }
 
-void CSPSpaceBFS::pushSolNode(const SharedCSPNode &node)
+void CSPSpaceBFS::pushSolNode(SharedCSPNode node)
 {
-   vsol_.push_back(node);
+   vsol_.push_back(std::move(node));
 }
 
 SharedCSPNode CSPSpaceBFS::popSolNode()
 {
-   SharedCSPNode node = vsol_.back();
+   SharedCSPNode node = std::move(vsol_.back());
    vsol_.pop_back();
    return node;
 }
@@ -50,12 +50,12 @@ SharedCSPNode CSPSpaceBFS::getSolNode(size_t i) const
 {
    ASSERT(i < vsol_.size(), "Bad access to a solution node in a CSP space");
 
-   return vsol_[i];
+   return vsol_[i].share();
 }
 
 bool CSPSpaceBFS::hasFeasibleSolNode() const
 {
-   for (auto node : vsol_)
+   for (const auto &node : vsol_)
    {
       Proof p = node->getProof();
       if (p == Proof::Feasible || p == Proof::Inner)
@@ -71,14 +71,14 @@ size_t CSPSpaceBFS::nbPendingNodes() const
 
 SharedCSPNode CSPSpaceBFS::nextPendingNode()
 {
-   SharedCSPNode node = lnode_.back();
+   SharedCSPNode node = std::move(lnode_.back());
    lnode_.pop_back();
    return node;
 }
 
-void CSPSpaceBFS::insertPendingNode(const SharedCSPNode &node)
+void CSPSpaceBFS::insertPendingNode(SharedCSPNode node)
 {
-   lnode_.push_front(node);
+   lnode_.push_front(std::move(node));
 }
 
 SharedCSPNode CSPSpaceBFS::getPendingNode(size_t i) const
@@ -89,7 +89,7 @@ SharedCSPNode CSPSpaceBFS::getPendingNode(size_t i) const
    if (i != 0)
       std::advance(it, i);
 
-   return *it;
+   return it->share();
 }
 
 } // namespace realpaver
@@ -47,13 +47,13 @@ public:
    CSPSpaceBFS(const CSPSpaceBFS &) = default;
 
    size_t nbSolNodes() const override;
-   void pushSolNode(const SharedCSPNode &node) override;
+   void pushSolNode(SharedCSPNode node) override;
    SharedCSPNode popSolNode() override;
    SharedCSPNode getSolNode(size_t i) const override;
    bool hasFeasibleSolNode() const override;
    size_t nbPendingNodes() const override;
    SharedCSPNode nextPendingNode() override;
-   void insertPendingNode(const SharedCSPNode &node) override;
+   void insertPendingNode(SharedCSPNode node) override;
    SharedCSPNode getPendingNode(size_t i) const override;
 
 private:
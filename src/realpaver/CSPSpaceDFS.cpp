@@ -23,10 +23,20 @@
 
 namespace realpaver {
 
-CSPSpaceDFS::CSPSpaceDFS()
+CSPSpaceDFS::CSPSpaceDFS(bool trail)
     : vsol_()
     , vnode_()
+    , trail_(nullptr)
+    , vmark_()
+    , work_(nullptr)
 {
+   if (trail)
+      trail_ = std::make_unique<DomainTrail>();
+}
+
+DomainTrail *CSPSpaceDFS::getTrail() const
+{
+   return trail_.get();
 }
 
 size_t CSPSpaceDFS::nbSolNodes() const
@@ -34,14 +44,24 @@ size_t CSPSpaceDFS::nbSolNodes() const
    return vsol_.size();
 }
 
-void CSPSpaceDFS::pushSolNode(const SharedCSPNode &node)
+void CSPSpaceDFS::pushSolNode(SharedCSPNode node)
 {
-   vsol_.push_back(node);
+   if (trail_ != nullptr && node == work_)
+   {
+      // the working node is modified after this step
+      SharedCSPNode sol = SharedCSPNode::make(*node);
+      sol->setIndex(node->index());
+      sol->setParent(node->parent());
+      sol->setProof(node->getProof());
+      vsol_.push_back(std::move(sol));
+   }
+   else
+      vsol_.push_back(std::move(node));
 }
 
 SharedCSPNode CSPSpaceDFS::popSolNode()
 {
-   SharedCSPNode node = vsol_.back();
+   SharedCSPNode node = std::move(vsol_.back());
    vsol_.pop_back();
    return node;
 }
@@ -50,12 +70,12 @@ SharedCSPNode CSPSpaceDFS::getSolNode(size_t i) const
 {
    ASSERT(i < vsol_.size(), "Bad access to a solution node in a CSP space @ " << i);
 
-   return vsol_[i];
+   return vsol_[i].share();
 }
 
 bool CSPSpaceDFS::hasFeasibleSolNode() const
 {
-   for (auto node : vsol_)
+   for (const auto &node : vsol_)
    {
       Proof p = node->getProof();
       if (p == Proof::Feasible || p == Proof::Inner)
@@ -71,21 +91,71 @@ size_t CSPSpaceDFS::nbPendingNodes() const
 
 SharedCSPNode CSPSpaceDFS::nextPendingNode()
 {
-   SharedCSPNode node = vnode_.back();
+   SharedCSPNode node = std::move(vnode_.back());
    vnode_.pop_back();
-   return node;
+
+   if (trail_ == nullptr)
+      return node;
+
+   // restores the box of the parent node
+   trail_->undo(vmark_.back());
+   vmark_.pop_back();
+
+   if (node != work_)
+   {
+      // assigns the domains of the delta node
+      DomainBox *delta = node->box();
+      for (size_t i = 0; i < delta->size(); ++i)
+         trail_->assign(delta->var(i), std::unique_ptr<Domain>(delta->get(i)->clone()));
+
+      work_->setIndex(node->index());
+      work_->setDepth(node->depth());
+      work_->setParent(node->parent());
+   }
+
+   work_->setProof(Proof::Maybe);
+   return work_.share();
 }
 
-void CSPSpaceDFS::insertPendingNode(const SharedCSPNode &node)
+void CSPSpaceDFS::insertPendingNode(SharedCSPNode node)
 {
-   vnode_.push_back(node);
+   if (trail_ != nullptr)
+   {
+      // the first node becomes the working node
+      if (work_ == nullptr)
+      {
+         work_ = node.share();
+         trail_->attach(node->box());
+      }
+      vmark_.push_back(trail_->mark());
+   }
+
+   vnode_.push_back(std::move(node));
 }
 
 SharedCSPNode CSPSpaceDFS::getPendingNode(size_t i) const
 {
    ASSERT(i < vnode_.size(), "Bad access to a pending node in a CSP space @ " << i);
 
-   return vnode_[i];
+   if (trail_ == nullptr)
+      return vnode_[i].share();
+
+   // rebuilds the box of the i-th pending node
+   std::unique_ptr<DomainBox> box(work_->box()->clone());
+   trail_->restore(*box, vmark_[i]);
+
+   const SharedCSPNode &node = vnode_[i];
+   if (node != work_)
+   {
+      DomainBox *delta = node->box();
+      for (size_t j = 0; j < delta->size(); ++j)
+         box->set(delta->var(j), std::unique_ptr<Domain>(delta->get(j)->clone()));
+   }
+
+   SharedCSPNode aux = SharedCSPNode::make(std::move(box), node->depth());
+   aux->setIndex(node->index());
+   aux->setParent(node->parent());
+   return aux;
 }
 
 } // namespace realpaver
@@ -22,6 +22,8 @@
 #define REALPAVER_CSP_SPACE_DFS_HPP
 
 #include "realpaver/CSPSpace.hpp"
+#include "realpaver/DomainTrail.hpp"
+#include <memory>
 
 namespace realpaver {
 
@@ -29,11 +31,23 @@ namespace realpaver {
  * @brief Depth-First-Search strategy.
  *
  * The pending nodes are stored in a stack in order to implement a DFS strategy.
+ *
+ * In the trail-based mode, the search relies on one working node whose box
+ * is modified in place. The pending nodes are delta nodes generated by a
+ * split object that only store the domain of the split variable, each one
+ * being associated with a mark of a trail of domains. Extracting a pending
+ * node then consists of undoing the trail to its mark, which restores the
+ * box of its parent after contraction, and assigning the domain of the split
+ * variable. The domains modified by the propagator must be saved on the trail
+ * given by getTrail().
+ *
+ * In this mode, the solution nodes are copies of the working node and the
+ * pending nodes returned by getPendingNode are rebuilt with a full box.
  */
 class CSPSpaceDFS : public CSPSpace {
 public:
-   /// Constructor
-   CSPSpaceDFS();
+   /// Constructor, the trail-based mode is enabled if trail is true
+   CSPSpaceDFS(bool trail = false);
 
    /// Default destructor
    ~CSPSpaceDFS() = default;
@@ -41,22 +55,28 @@ public:
    /// No assignment
    CSPSpaceDFS &operator=(const CSPSpaceDFS &) = delete;
 
-   /// Default copy constructor
-   CSPSpaceDFS(const CSPSpaceDFS &) = default;
+   /// No copy
+   CSPSpaceDFS(const CSPSpaceDFS &) = delete;
+
+   /// Returns the trail of domains, nullptr if the trail-based mode is disabled
+   DomainTrail *getTrail() const;
 
    size_t nbSolNodes() const override;
-   void pushSolNode(const SharedCSPNode &node) override;
+   void pushSolNode(SharedCSPNode node) override;
    SharedCSPNode popSolNode() override;
    SharedCSPNode getSolNode(size_t i) const override;
    bool hasFeasibleSolNode() const override;
    size_t nbPendingNodes() const override;
    SharedCSPNode nextPendingNode() override;
-   void insertPendingNode(const SharedCSPNode &node) override;
+   void insertPendingNode(SharedCSPNode node) override;
    SharedCSPNode getPendingNode(size_t i) const override;
 
 private:
-   std::vector<SharedCSPNode> vsol_;  // vector of solution nodes
-   std::vector<SharedCSPNode> vnode_; // vector of pending nodes
+   std::vector<SharedCSPNode> vsol_;    // vector of solution nodes
+   std::vector<SharedCSPNode> vnode_;   // vector of pending nodes
+   std::unique_ptr<DomainTrail> trail_; // trail of domains or nullptr
+   std::vector<size_t> vmark_;          // marks of the pending nodes
+   SharedCSPNode work_;                 // working node in the trail mode
 };
 
 } // namespace realpaver
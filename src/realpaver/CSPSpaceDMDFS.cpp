@@ -76,10 +76,8 @@ size_t CSPSpaceDMDFS::nbSolNodes() const
    return vsol_.size();
 }
 
-void CSPSpaceDMDFS::pushSolNode(const SharedCSPNode &node)
+void CSPSpaceDMDFS::pushSolNode(SharedCSPNode node)
 {
-   vsol_.push_back(node);
-
    // update the distances
    for (auto &elem : vnode_)
    {
@@ -89,13 +87,15 @@ void CSPSpaceDMDFS::pushSolNode(const SharedCSPNode &node)
          elem.mindist = d;
    }
 
+   vsol_.push_back(std::move(node));
+
    // ascending ordering of the node distances
    std::sort(vnode_.begin(), vnode_.end(), comparator);
 }
 
 SharedCSPNode CSPSpaceDMDFS::popSolNode()
 {
-   SharedCSPNode node = vsol_.back();
+   SharedCSPNode node = std::move(vsol_.back());
    vsol_.pop_back();
    return node;
 }
@@ -104,12 +104,12 @@ SharedCSPNode CSPSpaceDMDFS::getSolNode(size_t i) const
 {
    ASSERT(i < vsol_.size(), "Bad access to a solution node in a CSP space");
 
-   return vsol_[i];
+   return vsol_[i].share();
 }
 
 bool CSPSpaceDMDFS::hasFeasibleSolNode() const
 {
-   for (auto node : vsol_)
+   for (const auto &node : vsol_)
    {
       Proof p = node->getProof();
       if (p == Proof::Feasible || p == Proof::Inner)
@@ -155,12 +155,12 @@ size_t CSPSpaceDMDFS::nbPendingNodes() const
 
 SharedCSPNode CSPSpaceDMDFS::nextPendingNode()
 {
-   SharedCSPNode node = vnode_.back().node;
+   SharedCSPNode node = std::move(vnode_.back().node);
    vnode_.pop_back();
    return node;
 }
 
-void CSPSpaceDMDFS::insertPendingNode(const SharedCSPNode &node)
+void CSPSpaceDMDFS::insertPendingNode(SharedCSPNode node)
 {
    // Finds the distance to the closest solution
    double d = Double::inf();
@@ -176,15 +176,15 @@ void CSPSpaceDMDFS::insertPendingNode(const SharedCSPNode &node)
    LOG_INTER("Insert node " << node->index()
                             << " / distance to the closest solution : " << d);
 
-   Elem elem = {node, d};
-   vnode_.push_back(elem);
+   Elem elem = {std::move(node), d};
+   vnode_.push_back(std::move(elem));
 }
 
 SharedCSPNode CSPSpaceDMDFS::getPendingNode(size_t i) const
 {
    ASSERT(i < vnode_.size(), "Bad access to a pending node in a CSP space");
 
-   return vnode_[i].node;
+   return vnode_[i].node.share();
 }
 
 } // namespace realpaver
@@ -73,14 +73,14 @@ public:
    CSPSpaceDMDFS(const CSPSpaceDMDFS &) = default;
 
    size_t nbSolNodes() const override;
-   void pushSolNode(const SharedCSPNode &node) override;
+   void pushSolNode(SharedCSPNode node) override;
    SharedCSPNode popSolNode() override;
    SharedCSPNode getSolNode(size_t i) const override;
    bool hasFeasibleSolNode() const override;
    void makeSolClusters(double gap) override;
    size_t nbPendingNodes() const override;
    SharedCSPNode nextPendingNode() override;
-   void insertPendingNode(const SharedCSPNode &node) override;
+   void insertPendingNode(SharedCSPNode node) override;
    SharedCSPNode getPendingNode(size_t i) const override;
 
    /// Assigns the distance calculator in this
@@ -60,20 +60,20 @@ size_t DepthCSPNodeSet::size() const
    return set_.size();
 }
 
-void DepthCSPNodeSet::insert(const SharedCSPNode &node)
+void DepthCSPNodeSet::insert(SharedCSPNode node)
 {
-   Elem e = {node, node->depth()};
-   set_.insert(e);
+   int depth = node->depth();
+   Elem e = {std::move(node), depth};
+   set_.insert(std::move(e));
 }
 
 SharedCSPNode DepthCSPNodeSet::extract()
 {
-   auto it = set_.begin();
-   SharedCSPNode node = it->node;
+   auto elem = set_.extract(set_.begin());
+   SharedCSPNode node = std::move(elem.value().node);
 
-   LOG_INTER("Extract node " << node->index() << " / depth : " << it->depth);
+   LOG_INTER("Extract node " << node->index() << " / depth : " << elem.value().depth);
 
-   set_.erase(it);
    return node;
 }
 
@@ -81,7 +81,7 @@ SharedCSPNode DepthCSPNodeSet::getNode(size_t i) const
 {
    auto it = set_.begin();
    std::advance(it, i);
-   return it->node;
+   return it->node.share();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -96,24 +96,23 @@ size_t PerimeterCSPNodeSet::size() const
    return set_.size();
 }
 
-void PerimeterCSPNodeSet::insert(const SharedCSPNode &node)
+void PerimeterCSPNodeSet::insert(SharedCSPNode node)
 {
    double p = node->box()->perimeter();
 
    LOG_INTER("Insert node " << node->index() << " / perimeter : " << p);
 
-   Elem e = {node, p};
-   set_.insert(e);
+   Elem e = {std::move(node), p};
+   set_.insert(std::move(e));
 }
 
 SharedCSPNode PerimeterCSPNodeSet::extract()
 {
-   auto it = set_.begin();
-   SharedCSPNode node = it->node;
+   auto elem = set_.extract(set_.begin());
+   SharedCSPNode node = std::move(elem.value().node);
 
-   LOG_INTER("Extract node " << node->index() << " / perimeter : " << it->peri);
+   LOG_INTER("Extract node " << node->index() << " / perimeter : " << elem.value().peri);
 
-   set_.erase(it);
    return node;
 }
 
@@ -121,7 +120,7 @@ SharedCSPNode PerimeterCSPNodeSet::getNode(size_t i) const
 {
    auto it = set_.begin();
    std::advance(it, i);
-   return it->node;
+   return it->node.share();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -136,24 +135,23 @@ size_t GridPerimeterCSPNodeSet::size() const
    return set_.size();
 }
 
-void GridPerimeterCSPNodeSet::insert(const SharedCSPNode &node)
+void GridPerimeterCSPNodeSet::insert(SharedCSPNode node)
 {
    double p = node->box()->gridPerimeter();
 
    LOG_INTER("Insert node " << node->index() << " / grid perimeter : " << p);
 
-   Elem e = {node, p};
-   set_.insert(e);
+   Elem e = {std::move(node), p};
+   set_.insert(std::move(e));
 }
 
 SharedCSPNode GridPerimeterCSPNodeSet::extract()
 {
-   auto it = set_.begin();
-   SharedCSPNode node = it->node;
+   auto elem = set_.extract(set_.begin());
+   SharedCSPNode node = std::move(elem.value().node);
 
-   LOG_INTER("Extract node " << node->index() << " / grid perimeter : " << it->peri);
+   LOG_INTER("Extract node " << node->index() << " / grid perimeter : " << elem.value().peri);
 
-   set_.erase(it);
    return node;
 }
 
@@ -161,7 +159,7 @@ SharedCSPNode GridPerimeterCSPNodeSet::getNode(size_t i) const
 {
    auto it = set_.begin();
    std::advance(it, i);
-   return it->node;
+   return it->node.share();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -196,23 +194,23 @@ size_t CSPSpaceHybridDFS::nbSolNodes() const
    return vsol_.size();
 }
 
-void CSPSpaceHybridDFS::pushSolNode(const SharedCSPNode &node)
+void CSPSpaceHybridDFS::pushSolNode(SharedCSPNode node)
 {
-   vsol_.push_back(node);
+   vsol_.push_back(std::move(node));
 
    // changes the ordering for the next DFS stage
    leftRight_ = !leftRight_;
 
    // moves the nodes from the stack to the set
-   for (auto node : sta_)
-      set_->insert(node);
+   for (auto &aux : sta_)
+      set_->insert(std::move(aux));
 
    sta_.clear();
 }
 
 SharedCSPNode CSPSpaceHybridDFS::popSolNode()
 {
-   SharedCSPNode node = vsol_.back();
+   SharedCSPNode node = std::move(vsol_.back());
    vsol_.pop_back();
    return node;
 }
@@ -221,12 +219,12 @@ SharedCSPNode CSPSpaceHybridDFS::getSolNode(size_t i) const
 {
    ASSERT(i < vsol_.size(), "Bad access to a solution node in a CSP space");
 
-   return vsol_[i];
+   return vsol_[i].share();
 }
 
 bool CSPSpaceHybridDFS::hasFeasibleSolNode() const
 {
-   for (auto node : vsol_)
+   for (const auto &node : vsol_)
    {
       Proof p = node->getProof();
       if (p == Proof::Feasible || p == Proof::Inner)
@@ -251,16 +249,16 @@ SharedCSPNode CSPSpaceHybridDFS::nextPendingNode()
    // the first element of the set otherwise
    else
    {
-      SharedCSPNode node = sta_.back();
+      SharedCSPNode node = std::move(sta_.back());
       sta_.pop_back();
       return node;
    }
 }
 
-void CSPSpaceHybridDFS::insertPendingNode(const SharedCSPNode &node)
+void CSPSpaceHybridDFS::insertPendingNode(SharedCSPNode node)
 {
    // inserts a node in the stack during a DFS stage
-   sta_.push_back(node);
+   sta_.push_back(std::move(node));
 }
 
 SharedCSPNode CSPSpaceHybridDFS::getPendingNode(size_t i) const
@@ -270,7 +268,7 @@ SharedCSPNode CSPSpaceHybridDFS::getPendingNode(size_t i) const
    if (i < sta_.size())
    {
       // gets the i-th node from the stack
-      return sta_[i];
+      return sta_[i].share();
    }
    else
    {
@@ -291,15 +289,15 @@ void CSPSpaceHybridDFS::insertPendingNodes(CSPSplit::iterator first,
    {
       std::list<SharedCSPNode> aux;
       for (auto it = first; it != last; ++it)
-         aux.push_front(*it);
+         aux.push_front(std::move(*it));
 
       for (auto it = aux.begin(); it != aux.end(); ++it)
-         insertPendingNode(*it);
+         insertPendingNode(std::move(*it));
    }
    else
    {
       for (auto it = first; it != last; ++it)
-         insertPendingNode(*it);
+         insertPendingNode(std::move(*it));
    }
 }
 
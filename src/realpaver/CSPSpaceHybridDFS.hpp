@@ -61,7 +61,7 @@ public:
    virtual size_t size() const = 0;
 
    /// Inserts a node in this
-   virtual void insert(const SharedCSPNode &node) = 0;
+   virtual void insert(SharedCSPNode node) = 0;
 
    /// Extracts the first node of this
    virtual SharedCSPNode extract() = 0;
@@ -89,7 +89,7 @@ public:
 
    bool isEmpty() const override;
    size_t size() const override;
-   void insert(const SharedCSPNode &node) override;
+   void insert(SharedCSPNode node) override;
    SharedCSPNode extract() override;
    SharedCSPNode getNode(size_t i) const override;
 
@@ -129,7 +129,7 @@ public:
 
    bool isEmpty() const override;
    size_t size() const override;
-   void insert(const SharedCSPNode &node) override;
+   void insert(SharedCSPNode node) override;
    SharedCSPNode extract() override;
    SharedCSPNode getNode(size_t i) const override;
 
@@ -169,7 +169,7 @@ public:
 
    bool isEmpty() const override;
    size_t size() const override;
-   void insert(const SharedCSPNode &node) override;
+   void insert(SharedCSPNode node) override;
    SharedCSPNode extract() override;
    SharedCSPNode getNode(size_t i) const override;
 
@@ -216,13 +216,13 @@ public:
    CSPSpaceHybridDFS &operator=(const CSPSpaceHybridDFS &) = delete;
 
    size_t nbSolNodes() const override;
-   void pushSolNode(const SharedCSPNode &node) override;
+   void pushSolNode(SharedCSPNode node) override;
    SharedCSPNode popSolNode() override;
    SharedCSPNode getSolNode(size_t i) const override;
    bool hasFeasibleSolNode() const override;
    size_t nbPendingNodes() const override;
    SharedCSPNode nextPendingNode() override;
-   void insertPendingNode(const SharedCSPNode &node) override;
+   void insertPendingNode(SharedCSPNode node) override;
    SharedCSPNode getPendingNode(size_t i) const override;
    void insertPendingNodes(CSPSplit::iterator first, CSPSplit::iterator last) override;
 
@@ -22,6 +22,8 @@
 #include "realpaver/AssertDebug.hpp"
 #include "realpaver/CSPSplit.hpp"
 #include "realpaver/Logger.hpp"
+#include <cmath>
+#include <vector>
 
 namespace realpaver {
 
@@ -31,6 +33,9 @@ CSPSplit::CSPSplit(Scope scop, std::unique_ptr<DomainSlicerMap> smap)
     , cont_()
     , nbs_(0)
     , idx_(0)
+    , kmax_(0)
+    , delta_(false)
+    , v_()
 {
    ASSERT(!scop.isEmpty(), "Creation of a split object with an empty scope");
    ASSERT(slicerMap_ != nullptr, "No domain slicer map in a split object");
@@ -51,6 +56,7 @@ void CSPSplit::apply(SharedCSPNode &node, CSPContext &context)
    LOG_INTER("Split node " << node->index() << ": " << (*node->box()));
 
    cont_.clear();
+   v_ = Variable();
    ++nbs_;
 
    applyImpl(node, context);
@@ -68,34 +74,69 @@ size_t CSPSplit::getNbSplits() const
    return nbs_;
 }
 
+Variable CSPSplit::getSplitVar() const
+{
+   return v_;
+}
+
 SharedCSPNode CSPSplit::cloneNode(const SharedCSPNode &node)
 {
-   SharedCSPNode aux = std::make_shared<CSPNode>(*node);
+   SharedCSPNode aux = SharedCSPNode::make(*node);
    aux->setIndex(++idx_);
    aux->setDepth(1 + node->depth());
    aux->setParent(node->index());
    return aux;
 }
 
+size_t CSPSplit::selectArity(const SharedCSPNode &node, const Variable &v)
+{
+   return 2;
+}
+
 void CSPSplit::splitOne(SharedCSPNode &node, Variable v)
 {
    Domain *dom = node->box()->get(v);
    DomainSlicer *slicer = slicerMap_->getSlicer(dom->type());
 
+   if (kmax_ > 0)
+      slicer->setArity(selectArity(node, v));
+
    size_t n = slicer->apply(dom);
    if (n < 2)
       return;
 
+   v_ = v;
+
+   // a delta sub-node only stores the domain of v
+   Scope sv;
+   if (delta_)
+      sv.insert(v);
+
    auto it = slicer->begin();
    while (it != slicer->end())
    {
-      std::unique_ptr<Domain> slice = slicer->next(it);
-      SharedCSPNode aux = cloneNode(node);
-      aux->box()->set(v, std::move(slice));
-      cont_.push_back(aux);
+      SharedCSPNode aux =
+          delta_ ? SharedCSPNode::make(std::unique_ptr<DomainBox>(new DomainBox(sv)))
+                 : SharedCSPNode::make(*node);
+
+      aux->setIndex(++idx_);
+      aux->setDepth(1 + node->depth());
+      aux->setParent(node->index());
+      aux->box()->set(v, slicer->next(it));
+      cont_.push_back(std::move(aux));
    }
 }
 
+bool CSPSplit::hasDeltaNodes() const
+{
+   return delta_;
+}
+
+void CSPSplit::setDeltaNodes(bool delta)
+{
+   delta_ = delta;
+}
+
 void CSPSplit::reset()
 {
    nbs_ = idx_ = 0;
@@ -116,6 +157,17 @@ DomainSlicerMap *CSPSplit::getSlicerMap() const
    return slicerMap_;
 }
 
+size_t CSPSplit::getMaxArity() const
+{
+   return kmax_;
+}
+
+void CSPSplit::setMaxArity(size_t kmax)
+{
+   ASSERT(kmax == 0 || kmax >= 2, "Bad maximum arity " << kmax << " in a split object");
+   kmax_ = kmax;
+}
+
 /*----------------------------------------------------------------------------*/
 
 CSPSplitRR::CSPSplitRR(Scope scop, std::unique_ptr<DomainSlicerMap> smap)
@@ -278,6 +330,12 @@ void CSPSplitSSR::applyImpl(SharedCSPNode &node, CSPContext &context)
    }
 }
 
+size_t CSPSplitSSR::selectArity(const SharedCSPNode &node, const Variable &v)
+{
+   double s = ssr_.getSmearShare(v);
+   return 2 + (size_t)std::round(s * (getMaxArity() - 2));
+}
+
 /*----------------------------------------------------------------------------*/
 
 CSPSplitSSRLF::CSPSplitSSRLF(Scope scop, std::unique_ptr<DomainSlicerMap> smap,
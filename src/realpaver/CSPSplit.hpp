@@ -31,7 +31,7 @@
 #include "realpaver/SelectorSLF.hpp"
 #include "realpaver/SelectorSSR.hpp"
 #include "realpaver/SelectorSSRLF.hpp"
-#include <list>
+#include <vector>
 
 namespace realpaver {
 
@@ -48,6 +48,19 @@ namespace realpaver {
  * apply method, its index is assigned to the counter value, which is then
  * incremented. In order to reset this counter, the reset method must be called,
  * e.g., before the solving of a new problem.
+ *
+ * The sub-nodes generated by a splitting step are allocated in the pool of
+ * CSP nodes and their handles are stored in a vector whose capacity is kept
+ * from one step to the next.
+ *
+ * The arity of the slicers, i.e. the number of sub-nodes per splitting step,
+ * can be fixed in the slicer map or adaptive. In the latter case, it is
+ * chosen at each step between 2 and a maximum arity by selectArity.
+ *
+ * If the delta nodes are enabled, a sub-node only stores the domain of the
+ * split variable instead of a copy of the whole box of its parent. This is
+ * used by the trail-based DFS strategy, which rebuilds the box of a sub-node
+ * from the box of its parent.
  */
 class CSPSplit {
 public:
@@ -82,14 +95,29 @@ public:
    /// Returns the number of application of this
    size_t getNbSplits() const;
 
+   /// Returns the variable split by the last application of this, if any
+   Variable getSplitVar() const;
+
    /// Resets this
    void reset();
 
    /// Returns the slicer map
    DomainSlicerMap *getSlicerMap() const;
 
+   /// Returns the maximum arity, 0 if the arity is not adaptive
+   size_t getMaxArity() const;
+
+   /// Enables the adaptive arity if kmax >= 2, disables it if kmax = 0
+   void setMaxArity(size_t kmax);
+
+   /// Returns true if the sub-nodes only store the domain of the split variable
+   bool hasDeltaNodes() const;
+
+   /// Enables or disables the delta sub-nodes
+   void setDeltaNodes(bool delta);
+
 protected:
-   typedef std::list<SharedCSPNode> ContainerType;
+   typedef std::vector<SharedCSPNode> ContainerType;
 
    Scope scop_;                 // set of variables
    DomainSlicerMap *slicerMap_; // slicer of domains
@@ -104,9 +132,20 @@ protected:
    /// Clones a node, assigns an index to the clone and increments its depth
    SharedCSPNode cloneNode(const SharedCSPNode &node);
 
+   /**
+    * @brief Returns the arity used to split the domain of v in a node.
+    *
+    * It is called if the arity is adaptive. The default implementation
+    * returns 2.
+    */
+   virtual size_t selectArity(const SharedCSPNode &node, const Variable &v);
+
 private:
-   size_t nbs_; // number of splitting steps
-   size_t idx_; // next node index
+   size_t nbs_;  // number of splitting steps
+   size_t idx_;  // next node index
+   size_t kmax_; // maximum arity, 0 if the arity is not adaptive
+   bool delta_;  // true if the sub-nodes are delta nodes
+   Variable v_;  // variable split by the last application
 
 public:
    /// Type of iterators on the set of sub-nodes
@@ -238,6 +277,16 @@ public:
 
    void applyImpl(SharedCSPNode &node, CSPContext &context) override;
 
+protected:
+   /**
+    * @brief Returns the arity used to split the domain of v in a node.
+    *
+    * Let s in [0, 1] be the share of v in the smear sum rel values calculated
+    * in the node. The arity is equal to 2 + round(s * (kmax - 2)). A variable
+    * that concentrates the smear of the system is then split in more parts.
+    */
+   size_t selectArity(const SharedCSPNode &node, const Variable &v) override;
+
 private:
    SelectorSSR ssr_; // main selector based on SSR values
    Scope sbis_;      // selector for the variables not handled by the SSR selector
@@ -0,0 +1,616 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   CSPTrace.cpp
+ * @brief  Trace of the search tree of CSP solver
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#include "realpaver/AssertDebug.hpp"
+#include "realpaver/CSPTrace.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
+namespace realpaver {
+
+namespace {
+
+template <typename T>
+void writeColumn(std::ofstream &f, const std::vector<T> &v)
+{
+   f.write(reinterpret_cast<const char *>(v.data()), v.size() * sizeof(T));
+}
+
+} // namespace
+
+std::ostream &operator<<(std::ostream &os, CSPTraceStatus status)
+{
+   switch (status)
+   {
+   case CSPTraceStatus::Empty:
+      return os << "empty";
+   case CSPTraceStatus::Split:
+      return os << "split";
+   case CSPTraceStatus::Solution:
+      return os << "solution";
+   case CSPTraceStatus::DepthLimit:
+      return os << "depth limit";
+   default:
+      os.setstate(std::ios::failbit);
+   }
+   return os;
+}
+
+/*----------------------------------------------------------------------------*/
+
+const uint32_t CSPTrace::VERSION = 1;
+const size_t CSPTrace::CHUNK_SIZE = 4096;
+const uint8_t CSPTrace::NO_PROOF = 255;
+
+CSPTrace::CSPTrace(const std::string &filename)
+    : filename_(filename)
+    , f_()
+    , nbnodes_(0)
+    , start_(0.0)
+    , started_(false)
+{
+   f_.open(filename, std::ios::out | std::ios::binary);
+   THROW_IF(!f_.is_open(), "Open error of the trace file " << filename);
+
+   f_.write("RPST", 4);
+   f_.write(reinterpret_cast<const char *>(&VERSION), sizeof(VERSION));
+}
+
+CSPTrace::~CSPTrace()
+{
+   close();
+}
+
+double CSPTrace::now()
+{
+   auto d = std::chrono::steady_clock::now().time_since_epoch();
+   return std::chrono::duration<double>(d).count();
+}
+
+std::string CSPTrace::getFilename() const
+{
+   return filename_;
+}
+
+void CSPTrace::writeString(char tag, int32_t id, const std::string &s)
+{
+   uint32_t n = s.size();
+   f_.put(tag);
+   f_.write(reinterpret_cast<const char *>(&id), sizeof(id));
+   f_.write(reinterpret_cast<const char *>(&n), sizeof(n));
+   f_.write(s.data(), n);
+}
+
+void CSPTrace::defineVar(int id, const std::string &name)
+{
+   ASSERT(!started_, "Variable defined in a trace after the first row");
+   writeString('V', id, name);
+}
+
+size_t CSPTrace::defineStage(const std::string &name)
+{
+   ASSERT(!started_, "Stage defined in a trace after the first row");
+
+   size_t i = stage_.size();
+   stage_.push_back(name);
+   before_.emplace_back();
+   after_.emplace_back();
+   stime_.emplace_back();
+   sproof_.emplace_back();
+
+   writeString('S', i, name);
+   return i;
+}
+
+size_t CSPTrace::nbStages() const
+{
+   return stage_.size();
+}
+
+void CSPTrace::beginNode(const CSPNode &node)
+{
+   started_ = true;
+
+   index_.push_back(node.index());
+   parent_.push_back(node.parent());
+   depth_.push_back(node.depth());
+   svar_.push_back(-1);
+   status_.push_back(static_cast<uint8_t>(CSPTraceStatus::Empty));
+   proof_.push_back(static_cast<uint8_t>(Proof::Maybe));
+   time_.push_back(0.0);
+
+   for (size_t i = 0; i < stage_.size(); ++i)
+   {
+      before_[i].push_back(0.0);
+      after_[i].push_back(0.0);
+      stime_[i].push_back(0.0);
+      sproof_[i].push_back(NO_PROOF);
+   }
+
+   start_ = now();
+}
+
+void CSPTrace::setStage(size_t i, double before, double after, double time, Proof proof)
+{
+   ASSERT(i < stage_.size(), "Bad access to a stage of a trace @ " << i);
+   ASSERT(!index_.empty(), "No current row in a trace");
+
+   before_[i].back() = before;
+   after_[i].back() = after;
+   stime_[i].back() = time;
+   sproof_[i].back() = static_cast<uint8_t>(proof);
+}
+
+void CSPTrace::setProof(Proof proof)
+{
+   ASSERT(!index_.empty(), "No current row in a trace");
+   proof_.back() = static_cast<uint8_t>(proof);
+}
+
+void CSPTrace::endNode(CSPTraceStatus status, int splitvar)
+{
+   ASSERT(!index_.empty(), "No current row in a trace");
+
+   time_.back() = now() - start_;
+   status_.back() = static_cast<uint8_t>(status);
+   svar_.back() = splitvar;
+   ++nbnodes_;
+
+   if (index_.size() >= CHUNK_SIZE)
+      flush();
+}
+
+size_t CSPTrace::nbNodes() const
+{
+   return nbnodes_;
+}
+
+void CSPTrace::flush()
+{
+   if (index_.empty())
+      return;
+
+   uint32_t n = index_.size(), ns = stage_.size();
+   f_.put('C');
+   f_.write(reinterpret_cast<const char *>(&n), sizeof(n));
+   f_.write(reinterpret_cast<const char *>(&ns), sizeof(ns));
+
+   writeColumn(f_, index_);
+   writeColumn(f_, parent_);
+   writeColumn(f_, depth_);
+   writeColumn(f_, svar_);
+   writeColumn(f_, status_);
+   writeColumn(f_, proof_);
+   writeColumn(f_, time_);
+
+   index_.clear();
+   parent_.clear();
+   depth_.clear();
+   svar_.clear();
+   status_.clear();
+   proof_.clear();
+   time_.clear();
+
+   for (size_t i = 0; i < ns; ++i)
+   {
+      writeColumn(f_, before_[i]);
+      writeColumn(f_, after_[i]);
+      writeColumn(f_, stime_[i]);
+      writeColumn(f_, sproof_[i]);
+
+      before_[i].clear();
+      after_[i].clear();
+      stime_[i].clear();
+      sproof_[i].clear();
+   }
+}
+
+void CSPTrace::close()
+{
+   if (f_.is_open())
+   {
+      flush();
+      f_.close();
+   }
+}
+
+/*----------------------------------------------------------------------------*/
+
+void CSPTraceReader::read(const std::string &filename)
+{
+   std::ifstream f(filename, std::ios::in | std::ios::binary);
+   THROW_IF(!f.is_open(), "Open error of the trace file " << filename);
+
+   std::string buf((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+   const char *cur = buf.data(), *end = buf.data() + buf.size();
+
+   auto check = [&](size_t n)
+   { THROW_IF((size_t)(end - cur) < n, "Truncated trace file " << filename); };
+
+   auto get = [&](auto &x)
+   {
+      check(sizeof(x));
+      std::memcpy(&x, cur, sizeof(x));
+      cur += sizeof(x);
+   };
+
+   auto getColumn = [&](auto &v, size_t n)
+   {
+      using T = typename std::decay_t<decltype(v)>::value_type;
+      check(n * sizeof(T));
+      size_t k = v.size();
+      v.resize(k + n);
+      std::memcpy(v.data() + k, cur, n * sizeof(T));
+      cur += n * sizeof(T);
+   };
+
+   uint32_t version;
+   check(4 + sizeof(version));
+   THROW_IF(std::memcmp(cur, "RPST", 4) != 0, "Bad format of trace file " << filename);
+   cur += 4;
+   get(version);
+   THROW_IF(version != CSPTrace::VERSION, "Bad version of trace file " << filename);
+
+   *this = CSPTraceReader();
+
+   while (cur != end)
+   {
+      char tag = *cur++;
+
+      if (tag == 'V' || tag == 'S')
+      {
+         int32_t id;
+         uint32_t n;
+         get(id);
+         get(n);
+         check(n);
+         std::string s(cur, n);
+         cur += n;
+
+         if (tag == 'V')
+            name_[id] = s;
+
+         else
+         {
+            THROW_IF(id != (int32_t)stage_.size(), "Bad stage in trace file " << filename);
+            stage_.push_back(s);
+            before_.emplace_back();
+            after_.emplace_back();
+            stime_.emplace_back();
+            sproof_.emplace_back();
+         }
+      }
+      else if (tag == 'C')
+      {
+         uint32_t n, ns;
+         get(n);
+         get(ns);
+         THROW_IF(ns != stage_.size(), "Bad chunk in trace file " << filename);
+
+         getColumn(index_, n);
+         getColumn(parent_, n);
+         getColumn(depth_, n);
+         getColumn(svar_, n);
+         getColumn(status_, n);
+         getColumn(proof_, n);
+         getColumn(time_, n);
+
+         for (size_t i = 0; i < ns; ++i)
+         {
+            getColumn(before_[i], n);
+            getColumn(after_[i], n);
+            getColumn(stime_[i], n);
+            getColumn(sproof_[i], n);
+         }
+      }
+      else
+         THROW("Bad entry in trace file " << filename);
+   }
+}
+
+size_t CSPTraceReader::nbNodes() const
+{
+   return index_.size();
+}
+
+size_t CSPTraceReader::nbStages() const
+{
+   return stage_.size();
+}
+
+int CSPTraceReader::index(size_t i) const
+{
+   ASSERT(i < index_.size(), "Bad access to a row of a trace @ " << i);
+   return index_[i];
+}
+
+int CSPTraceReader::parent(size_t i) const
+{
+   ASSERT(i < parent_.size(), "Bad access to a row of a trace @ " << i);
+   return parent_[i];
+}
+
+int CSPTraceReader::depth(size_t i) const
+{
+   ASSERT(i < depth_.size(), "Bad access to a row of a trace @ " << i);
+   return depth_[i];
+}
+
+int CSPTraceReader::splitVar(size_t i) const
+{
+   ASSERT(i < svar_.size(), "Bad access to a row of a trace @ " << i);
+   return svar_[i];
+}
+
+CSPTraceStatus CSPTraceReader::status(size_t i) const
+{
+   ASSERT(i < status_.size(), "Bad access to a row of a trace @ " << i);
+   return static_cast<CSPTraceStatus>(status_[i]);
+}
+
+Proof CSPTraceReader::proof(size_t i) const
+{
+   ASSERT(i < proof_.size(), "Bad access to a row of a trace @ " << i);
+   return static_cast<Proof>(proof_[i]);
+}
+
+double CSPTraceReader::time(size_t i) const
+{
+   ASSERT(i < time_.size(), "Bad access to a row of a trace @ " << i);
+   return time_[i];
+}
+
+std::string CSPTraceReader::stageName(size_t s) const
+{
+   ASSERT(s < stage_.size(), "Bad access to a stage of a trace @ " << s);
+   return stage_[s];
+}
+
+bool CSPTraceReader::stageApplied(size_t s, size_t i) const
+{
+   ASSERT(s < stage_.size() && i < sproof_[s].size(),
+          "Bad access to a stage of a trace @ " << s << ", " << i);
+   return sproof_[s][i] != CSPTrace::NO_PROOF;
+}
+
+double CSPTraceReader::stageBefore(size_t s, size_t i) const
+{
+   ASSERT(s < stage_.size() && i < before_[s].size(),
+          "Bad access to a stage of a trace @ " << s << ", " << i);
+   return before_[s][i];
+}
+
+double CSPTraceReader::stageAfter(size_t s, size_t i) const
+{
+   ASSERT(s < stage_.size() && i < after_[s].size(),
+          "Bad access to a stage of a trace @ " << s << ", " << i);
+   return after_[s][i];
+}
+
+double CSPTraceReader::stageTime(size_t s, size_t i) const
+{
+   ASSERT(s < stage_.size() && i < stime_[s].size(),
+          "Bad access to a stage of a trace @ " << s << ", " << i);
+   return stime_[s][i];
+}
+
+Proof CSPTraceReader::stageProof(size_t s, size_t i) const
+{
+   ASSERT(stageApplied(s, i), "Stage not applied in a trace @ " << s << ", " << i);
+   return static_cast<Proof>(sproof_[s][i]);
+}
+
+std::string CSPTraceReader::varName(int id) const
+{
+   auto it = name_.find(id);
+   return (it == name_.end()) ? "_v" + std::to_string(id) : it->second;
+}
+
+std::vector<size_t> CSPTraceReader::subtreeSizes() const
+{
+   size_t n = index_.size();
+   std::vector<size_t> res(n, 1);
+
+   std::unordered_map<int, size_t> row;
+   for (size_t i = 0; i < n; ++i)
+      row[index_[i]] = i;
+
+   // a node is processed before its sub-nodes
+   for (size_t i = n; i-- > 0;)
+   {
+      auto it = row.find(parent_[i]);
+      if (it != row.end() && it->second < i)
+         res[it->second] += res[i];
+   }
+   return res;
+}
+
+void CSPTraceReader::summarize(std::ostream &os, int depth, size_t k) const
+{
+   size_t n = index_.size();
+   std::ios::fmtflags flags = os.flags();
+   os << std::left;
+
+   std::unordered_map<int, size_t> row;
+   for (size_t i = 0; i < n; ++i)
+      row[index_[i]] = i;
+
+   // aggregates the times and the solutions in the subtrees
+   std::vector<size_t> size = subtreeSizes(), sol(n, 0);
+   std::vector<double> time(time_);
+   for (size_t i = n; i-- > 0;)
+   {
+      if (status(i) == CSPTraceStatus::Solution)
+         ++sol[i];
+
+      auto it = row.find(parent_[i]);
+      if (it != row.end() && it->second < i)
+      {
+         sol[it->second] += sol[i];
+         time[it->second] += time[i];
+      }
+   }
+
+   double total = 0.0;
+   int maxdepth = 0;
+   size_t nbs[4] = {0, 0, 0, 0};
+   for (size_t i = 0; i < n; ++i)
+   {
+      total += time_[i];
+      maxdepth = std::max(maxdepth, depth_[i]);
+      ++nbs[status_[i] % 4];
+   }
+
+   os << "Search tree" << std::endl
+      << "   nodes       : " << n << std::endl
+      << "   max depth   : " << maxdepth << std::endl
+      << "   time        : " << total << "s" << std::endl;
+
+   for (uint8_t s = 0; s < 4; ++s)
+      os << "   " << std::setw(12) << static_cast<CSPTraceStatus>(s) << ": "
+         << nbs[s] << std::endl;
+
+   // hot subtrees
+   std::vector<size_t> hot;
+   for (size_t i = 0; i < n; ++i)
+      if (depth_[i] == depth)
+         hot.push_back(i);
+
+   std::stable_sort(hot.begin(), hot.end(),
+                    [&](size_t i, size_t j) { return size[i] > size[j]; });
+   if (hot.size() > k)
+      hot.resize(k);
+
+   os << std::endl << "Hot subtrees at depth " << depth << std::endl;
+   if (hot.empty())
+      os << "   no node" << std::endl;
+
+   else
+      os << "   " << std::setw(10) << "node" << std::setw(10) << "nodes" << std::setw(10)
+         << "share" << std::setw(10) << "sols" << std::setw(12) << "time(s)"
+         << "split path" << std::endl;
+
+   for (size_t i : hot)
+   {
+      // split variables from the root
+      std::vector<int> path;
+      auto it = row.find(parent_[i]);
+      while (it != row.end() && it->second < i)
+      {
+         path.push_back(svar_[it->second]);
+         it = row.find(parent_[it->second]);
+      }
+
+      std::ostringstream share;
+      share << std::fixed << std::setprecision(1) << (100.0 * size[i] / n) << "%";
+
+      os << "   " << std::setw(10) << index_[i] << std::setw(10) << size[i]
+         << std::setw(10) << share.str() << std::setw(10) << sol[i] << std::setw(12)
+         << time[i];
+
+      for (auto p = path.rbegin(); p != path.rend(); ++p)
+         os << varName(*p) << " ";
+      os << std::endl;
+   }
+
+   // stages of the propagator
+   os << std::endl << "Stages of the propagator" << std::endl;
+   os << "   " << std::setw(12) << "stage" << std::setw(10) << "calls" << std::setw(10)
+      << "empty" << std::setw(10) << "reduced" << std::setw(12) << "mean red."
+      << std::setw(12) << "time(s)" << std::endl;
+
+   for (size_t s = 0; s < stage_.size(); ++s)
+   {
+      size_t calls = 0, nbempty = 0, nbred = 0, nbratio = 0;
+      double ratio = 0.0, t = 0.0;
+
+      for (size_t i = 0; i < n; ++i)
+      {
+         if (!stageApplied(s, i))
+            continue;
+
+         ++calls;
+         t += stime_[s][i];
+
+         if (stageProof(s, i) == Proof::Empty)
+            ++nbempty;
+
+         else
+         {
+            double a = before_[s][i], b = after_[s][i];
+            if (b < a)
+               ++nbred;
+
+            if (a > 0.0 && std::isfinite(a))
+            {
+               ratio += 1.0 - b / a;
+               ++nbratio;
+            }
+         }
+      }
+
+      std::ostringstream red;
+      red << std::fixed << std::setprecision(1)
+          << (nbratio > 0 ? 100.0 * ratio / nbratio : 0.0) << "%";
+
+      os << "   " << std::setw(12) << stage_[s] << std::setw(10) << calls << std::setw(10)
+         << nbempty << std::setw(10) << nbred << std::setw(12) << red.str()
+         << std::setw(12) << t;
+
+      if (calls > 0 && nbempty == 0 && nbred == 0)
+         os << "useless";
+      os << std::endl;
+   }
+
+   // histogram of the split variables
+   std::unordered_map<int, size_t> hist;
+   size_t nbsplit = 0, width = 1;
+   for (size_t i = 0; i < n; ++i)
+      if (svar_[i] >= 0)
+      {
+         ++hist[svar_[i]];
+         ++nbsplit;
+      }
+
+   std::vector<std::pair<int, size_t>> vh(hist.begin(), hist.end());
+   std::sort(vh.begin(), vh.end(),
+             [](const std::pair<int, size_t> &a, const std::pair<int, size_t> &b)
+             { return a.second > b.second || (a.second == b.second && a.first < b.first); });
+
+   for (const auto &p : vh)
+      width = std::max(width, varName(p.first).size());
+
+   os << std::endl << "Split variables" << std::endl;
+   for (const auto &p : vh)
+   {
+      size_t bar = (50 * p.second + nbsplit - 1) / nbsplit;
+      os << "   " << std::setw(width + 2) << varName(p.first) << std::setw(10)
+         << p.second << std::string(bar, '#') << std::endl;
+   }
+
+   os.flags(flags);
+}
+
+} // namespace realpaver
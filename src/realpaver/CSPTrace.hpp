@@ -0,0 +1,239 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   CSPTrace.hpp
+ * @brief  Trace of the search tree of CSP solver
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#ifndef REALPAVER_CSP_TRACE_HPP
+#define REALPAVER_CSP_TRACE_HPP
+
+#include "realpaver/CSPNode.hpp"
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace realpaver {
+
+/// Outcome of the processing of a node in a search tree trace
+enum class CSPTraceStatus : uint8_t {
+   Empty,     ///< node fathomed by contraction
+   Split,     ///< node split in sub-nodes
+   Solution,  ///< solution node
+   DepthLimit ///< node fathomed due to the depth limit
+};
+
+/// Output on a stream
+std::ostream &operator<<(std::ostream &os, CSPTraceStatus status);
+
+/**
+ * @brief Writer of a trace of the search tree of CSP solver.
+ *
+ * A trace records one row per processed node: its index, the index of its
+ * parent, its depth, the identifier of the split variable (-1 if the node
+ * is not split), the outcome, the proof certificate of the contraction and
+ * the time spent. It also records for every stage of the propagator, e.g.
+ * HC4 then Newton, the perimeter of the box before and after the stage, the
+ * time spent and the proof certificate. The perimeter only sums the widths of
+ * the variables that are bounded before the stage.
+ *
+ * The file is columnar. It starts with the magic string "RPST" and the
+ * version of the format, followed by tagged sections: 'V' defines the name
+ * of a variable, 'S' defines the name of a stage and 'C' is a chunk of rows.
+ * A chunk holds the number of rows and the number of stages followed by the
+ * columns, each column being an array of fixed-size values. The rows are
+ * buffered in memory and written by chunks of CHUNK_SIZE rows.
+ *
+ * The stages and the variables must be defined before the first row.
+ */
+class CSPTrace {
+public:
+   /// Version of the format
+   static const uint32_t VERSION;
+
+   /// Number of rows per chunk
+   static const size_t CHUNK_SIZE;
+
+   /// Proof code of a stage that has not been applied
+   static const uint8_t NO_PROOF;
+
+   /// Constructor that opens a file, throws an exception in case of failure
+   CSPTrace(const std::string &filename);
+
+   /// Destructor that closes the file
+   ~CSPTrace();
+
+   /// No copy
+   CSPTrace(const CSPTrace &) = delete;
+
+   /// No assignment
+   CSPTrace &operator=(const CSPTrace &) = delete;
+
+   /// Returns the time in seconds given by a monotonic clock
+   static double now();
+
+   /// Returns the name of the file
+   std::string getFilename() const;
+
+   /// Defines the name of a variable given its identifier
+   void defineVar(int id, const std::string &name);
+
+   /// Defines a new stage and returns its index
+   size_t defineStage(const std::string &name);
+
+   /// Returns the number of stages
+   size_t nbStages() const;
+
+   /// Starts a new row for a node
+   void beginNode(const CSPNode &node);
+
+   /// Assigns the data of the i-th stage in the current row
+   void setStage(size_t i, double before, double after, double time, Proof proof);
+
+   /// Assigns the proof of the contraction in the current row
+   void setProof(Proof proof);
+
+   /**
+    * @brief Ends the current row.
+    *
+    * The identifier of the split variable is -1 if the node is not split.
+    */
+   void endNode(CSPTraceStatus status, int splitvar = -1);
+
+   /// Returns the number of rows written or buffered
+   size_t nbNodes() const;
+
+   /// Writes the buffered rows and closes the file
+   void close();
+
+private:
+   std::string filename_; // name of the file
+   std::ofstream f_;      // output file
+   size_t nbnodes_;       // number of rows
+   double start_;         // starting time of the current node
+   bool started_;         // true if the first row has been started
+
+   // columns of the buffered rows
+   std::vector<int32_t> index_, parent_, depth_, svar_;
+   std::vector<uint8_t> status_, proof_;
+   std::vector<double> time_;
+
+   // columns of the stages
+   std::vector<std::string> stage_;
+   std::vector<std::vector<double>> before_, after_, stime_;
+   std::vector<std::vector<uint8_t>> sproof_;
+
+   void writeString(char tag, int32_t id, const std::string &s);
+   void flush();
+};
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Reader of a trace of the search tree of CSP solver.
+ *
+ * The rows are stored in columns in the order of processing of the nodes.
+ * The method summarize reports the hot subtrees, i.e. the subtrees rooted at
+ * a given depth that contain the largest numbers of nodes, the efficiency of
+ * the stages of the propagator and the histogram of the split variables.
+ */
+class CSPTraceReader {
+public:
+   /// Constructor
+   CSPTraceReader() = default;
+
+   /// Reads a trace, throws an exception in case of failure
+   void read(const std::string &filename);
+
+   /// Returns the number of rows
+   size_t nbNodes() const;
+
+   /// Returns the number of stages
+   size_t nbStages() const;
+
+   /// Returns the index of the node of the i-th row
+   int index(size_t i) const;
+
+   /// Returns the index of the parent node of the i-th row
+   int parent(size_t i) const;
+
+   /// Returns the depth of the node of the i-th row
+   int depth(size_t i) const;
+
+   /// Returns the split variable identifier of the i-th row, -1 if none
+   int splitVar(size_t i) const;
+
+   /// Returns the outcome of the i-th row
+   CSPTraceStatus status(size_t i) const;
+
+   /// Returns the proof certificate of the contraction of the i-th row
+   Proof proof(size_t i) const;
+
+   /// Returns the time spent in the i-th row
+   double time(size_t i) const;
+
+   /// Returns the name of the s-th stage
+   std::string stageName(size_t s) const;
+
+   /// Returns true if the s-th stage has been applied in the i-th row
+   bool stageApplied(size_t s, size_t i) const;
+
+   /// Returns the perimeter of the box before the s-th stage in the i-th row
+   double stageBefore(size_t s, size_t i) const;
+
+   /// Returns the perimeter of the box after the s-th stage in the i-th row
+   double stageAfter(size_t s, size_t i) const;
+
+   /// Returns the time spent in the s-th stage in the i-th row
+   double stageTime(size_t s, size_t i) const;
+
+   /// Returns the proof certificate of the s-th stage in the i-th row
+   Proof stageProof(size_t s, size_t i) const;
+
+   /// Returns the name of a variable given its identifier
+   std::string varName(int id) const;
+
+   /**
+    * @brief Returns the sizes of the subtrees.
+    *
+    * The i-th element of the result is the number of rows of the subtree
+    * rooted at the node of the i-th row.
+    */
+   std::vector<size_t> subtreeSizes() const;
+
+   /**
+    * @brief Writes a summary of the trace on a stream.
+    *
+    * It reports the k largest subtrees rooted at the given depth.
+    */
+   void summarize(std::ostream &os, int depth = 4, size_t k = 10) const;
+
+private:
+   std::vector<int32_t> index_, parent_, depth_, svar_;
+   std::vector<uint8_t> status_, proof_;
+   std::vector<double> time_;
+   std::vector<std::string> stage_;
+   std::vector<std::vector<double>> before_, after_, stime_;
+   std::vector<std::vector<uint8_t>> sproof_;
+   std::unordered_map<int, std::string> name_;
+};
+
+} // namespace realpaver
+
+#endif
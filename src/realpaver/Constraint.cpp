@@ -1134,9 +1134,9 @@ Proof TableCtr::contract(IntervalBox &B)
 
       // hull of values of this variable occurring in the consistent rows
       Interval h = Interval::emptyset();
-      for (size_t i = 0; i < nbRows(); ++i)
-         if (consistent.get(i))
-            h |= vcol_[j].getVal(i);
+      for (int i = consistent.findFirst(); i <= consistent.last();
+           i = consistent.findNext(i))
+         h |= vcol_[j].getVal(i);
 
       Interval x = h & B.get(v);
       if (x.isEmpty())
@@ -1196,9 +1196,9 @@ Proof TableCtr::contract(DomainBox &box)
 
       // hull of values of this variable occurring in the consistent rows
       Interval x = Interval::emptyset();
-      for (size_t i = 0; i < nbRows(); ++i)
-         if (consistent.get(i))
-            x |= vcol_[j].getVal(i);
+      for (int i = consistent.findFirst(); i <= consistent.last();
+           i = consistent.findNext(i))
+         x |= vcol_[j].getVal(i);
 
       Domain *domain = box.get(v);
       domain->contract(x);
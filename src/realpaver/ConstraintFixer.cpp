@@ -136,9 +136,9 @@ void ConstraintFixer::apply(const TableCtr *c)
       {
          TableCtrCol col(it->second);
 
-         for (size_t i = 0; i < c->nbRows(); ++i)
-            if (consistent.get(i))
-               col.addValue(c->getVal(i, j));
+         for (int i = consistent.findFirst(); i <= consistent.last();
+              i = consistent.findNext(i))
+            col.addValue(c->getVal(i, j));
 
          rep->addCol(col);
       }
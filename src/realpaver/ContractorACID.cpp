@@ -63,6 +63,13 @@ ContractorACID::ContractorACID(std::unique_ptr<SelectorSSR> ssr, SharedContracto
    ctRatio_ = ctRatio;
 }
 
+void ContractorACID::reset()
+{
+   numVarCID_ = n_;
+   sumGood_ = 0;
+   nbCalls_ = 0;
+}
+
 Scope ContractorACID::scope() const
 {
    return ssr_->scope();
@@ -87,6 +87,9 @@ public:
    /// Returns the contractor of slices
    SharedContractor sliceContractor() const;
 
+   /// Resets the learning state, e.g. before a new search
+   void reset();
+
    Scope scope() const override;
    Proof contract(IntervalBox &B) override;
    void print(std::ostream &os) const override;
@@ -24,14 +24,16 @@
 
 namespace realpaver {
 
-ContractorAffine::ContractorAffine(SharedDag dag, bool minrange)
+ContractorAffine::ContractorAffine(SharedDag dag, bool minrange, bool incremental)
     : dag_(dag)
 {
    SharedContractorPool pool = std::make_shared<ContractorPool>();
 
    for (size_t i = 0; i < dag_->nbFuns(); ++i)
    {
-      SharedContractor op = std::make_shared<ContractorAffineRevise>(dag_, i, minrange);
+      std::shared_ptr<ContractorAffineRevise> op =
+          std::make_shared<ContractorAffineRevise>(dag_, i, minrange);
+      op->useIncremental(incremental);
       pool->push(op);
    }
 
@@ -70,6 +72,21 @@ void ContractorAffine::setTol(double tol)
    propag_->setTol(tol);
 }
 
+PropagationScheduling ContractorAffine::getScheduling() const
+{
+   return propag_->getScheduling();
+}
+
+void ContractorAffine::setScheduling(PropagationScheduling s)
+{
+   propag_->setScheduling(s);
+}
+
+IntervalPropagator *ContractorAffine::getPropagator() const
+{
+   return propag_;
+}
+
 void ContractorAffine::push(SharedContractor op)
 {
    propag_->push(op);
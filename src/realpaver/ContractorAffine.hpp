@@ -38,9 +38,10 @@ public:
     *
     * The boolean minrage is true if the linearization of the elementary
     * functions must use the Minrange approximation, false for the Chebyshev
-    * approximation.
+    * approximation. The boolean incremental is true if the affine forms must
+    * be created incrementally from one box to the next one.
     */
-   ContractorAffine(SharedDag dag, bool minrange = true);
+   ContractorAffine(SharedDag dag, bool minrange = true, bool incremental = true);
 
    /// Destructor
    ~ContractorAffine();
@@ -64,6 +65,15 @@ public:
    /// Sets the tolerance used as stopping criterion
    void setTol(double tol);
 
+   /// Returns the scheduling strategy of the propagator
+   PropagationScheduling getScheduling() const;
+
+   /// Sets the scheduling strategy of the propagator
+   void setScheduling(PropagationScheduling s);
+
+   /// Returns the propagator
+   IntervalPropagator *getPropagator() const;
+
 private:
    SharedDag dag_;              // DAG
    IntervalPropagator *propag_; // propagation algorithm
@@ -18,7 +18,6 @@
  * @date   21 Apr 2025
  */
 
-#include "realpaver/AffineCreator.hpp"
 #include "realpaver/AssertDebug.hpp"
 #include "realpaver/ContractorAffineRevise.hpp"
 
@@ -28,11 +27,25 @@ ContractorAffineRevise::ContractorAffineRevise(SharedDag dag, size_t i, bool min
     : Contractor()
     , dag_(dag)
     , idx_(i)
-    , minrange_(minrange)
+    , creator_(nullptr)
 {
    ASSERT(dag != nullptr, "Creation of affine contractor from a null pointer");
    ASSERT(i < dag->nbFuns(),
           "Creation of affine contractor given a bad " << " function index " << i);
+
+   creator_ = std::make_unique<AffineCreator>(dag, i, minrange);
+   creator_->useIncremental(true);
+}
+
+ContractorAffineRevise::ContractorAffineRevise(const ContractorAffineRevise &other)
+    : Contractor()
+    , dag_(other.dag_)
+    , idx_(other.idx_)
+    , creator_(nullptr)
+{
+   creator_ = std::make_unique<AffineCreator>(dag_, idx_);
+   creator_->useMinrange(other.creator_->isMinrange());
+   creator_->useIncremental(other.creator_->isIncremental());
 }
 
 Scope ContractorAffineRevise::scope() const
@@ -42,9 +55,8 @@ Scope ContractorAffineRevise::scope() const
 
 Proof ContractorAffineRevise::contract(IntervalBox &B)
 {
-   AffineCreator creator(dag_, idx_, minrange_);
-   creator.create(B);
-   const AffineForm &f = creator.fun(0);
+   creator_->create(B);
+   const AffineForm &f = creator_->fun(0);
 
    Interval I = dag_->fun(idx_)->getImage();
    Interval E = f.errorTerm();
@@ -77,7 +89,7 @@ Proof ContractorAffineRevise::contract(IntervalBox &B)
       Interval domi = Interval::minusOnePlusOne() & ((J + Interval(-si, si)) / it->itv);
 
       // new domain of v
-      const AffineForm &g = creator.fun(v);
+      const AffineForm &g = creator_->fun(v);
       Interval domv = g.constantTerm() + g.cbegin()->itv * domi;
       domv &= B.get(v);
       if (domv.isEmpty())
@@ -106,7 +118,12 @@ size_t ContractorAffineRevise::getFunIndex() const
 
 void ContractorAffineRevise::useMinrange(bool minrange)
 {
-   minrange_ = minrange;
+   creator_->useMinrange(minrange);
+}
+
+void ContractorAffineRevise::useIncremental(bool incremental)
+{
+   creator_->useIncremental(incremental);
 }
 
 } // namespace realpaver
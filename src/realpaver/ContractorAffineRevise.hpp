@@ -21,6 +21,7 @@
 #ifndef REALPAVER_CONTRACTOR_AFFINE_REVISE_HPP
 #define REALPAVER_CONTRACTOR_AFFINE_REVISE_HPP
 
+#include "realpaver/AffineCreator.hpp"
 #include "realpaver/Contractor.hpp"
 #include "realpaver/Dag.hpp"
 
@@ -38,6 +39,10 @@ namespace realpaver {
  * there is no solution. Otherwise, we try to reduce the domain of ei. For each i, let
  * si = s - |ai|. The new domain of ei is [-1, 1] inter (J + [-si, si]) / ai. The new
  * domain of xi is obtained from its affine form evaluated with the domain of ei.
+ *
+ * The affine forms are created by an incremental creator by default, which
+ * recreates only the affine forms of the nodes depending on the variables
+ * whose domains have been modified since the previous call.
  */
 class ContractorAffineRevise : public Contractor {
 public:
@@ -50,8 +55,8 @@ public:
     */
    ContractorAffineRevise(SharedDag dag, size_t i, bool minrange = true);
 
-   /// Default copy constructor
-   ContractorAffineRevise(const ContractorAffineRevise &) = default;
+   /// Copy constructor that does not copy the affine forms
+   ContractorAffineRevise(const ContractorAffineRevise &other);
 
    /// Default assignment operator
    ContractorAffineRevise &operator=(const ContractorAffineRevise &) = delete;
@@ -72,10 +77,13 @@ public:
    /// Selects the Minrange or the Chebyshev approximation
    void useMinrange(bool minrange = true);
 
+   /// Enables or disables the incremental creation of the affine forms
+   void useIncremental(bool incremental = true);
+
 private:
-   SharedDag dag_; // dag
-   size_t idx_;    // function index in the dag
-   bool minrange_; // true: Minrange, false:Chebyshev
+   SharedDag dag_;                          // dag
+   size_t idx_;                             // function index in the dag
+   std::unique_ptr<AffineCreator> creator_; // creator of affine forms
 };
 
 } // namespace realpaver
@@ -84,6 +84,31 @@ void ContractorBC4::setTol(double tol)
    propag_->setTol(tol);
 }
 
+PropagationScheduling ContractorBC4::getScheduling() const
+{
+   return propag_->getScheduling();
+}
+
+void ContractorBC4::setScheduling(PropagationScheduling s)
+{
+   propag_->setScheduling(s);
+}
+
+size_t ContractorBC4::getNbThreads() const
+{
+   return propag_->getNbThreads();
+}
+
+void ContractorBC4::setNbThreads(size_t n)
+{
+   propag_->setNbThreads(n);
+}
+
+IntervalPropagator *ContractorBC4::getPropagator() const
+{
+   return propag_;
+}
+
 void ContractorBC4::push(SharedContractor op)
 {
    propag_->push(op);
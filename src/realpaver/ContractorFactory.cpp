@@ -34,6 +34,7 @@ ContractorFactory::ContractorFactory(const Problem &pbm, std::shared_ptr<Env> en
     , ve_()
     , vi_()
     , vc_()
+    , vt_()
     , se_()
     , si_()
     , sc_()
@@ -52,6 +53,12 @@ ContractorFactory::ContractorFactory(const Problem &pbm, std::shared_ptr<Env> en
       try
       {
          size_t j = dag_->insert(c);
+
+         // term f of the function such that the constraint is f in img
+         ArithCtrIn *ci = dynamic_cast<ArithCtrIn *>(c.rep().get());
+         ArithCtrBinary *cb = dynamic_cast<ArithCtrBinary *>(c.rep().get());
+         vt_.push_back(ci != nullptr ? ci->term() : cb->left() - cb->right());
+
          if (c.isEquation())
          {
             ve_.push_back(j);
@@ -74,6 +81,12 @@ ContractorFactory::ContractorFactory(const Problem &pbm, std::shared_ptr<Env> en
    se_ = ScopeBank::getInstance()->insertScope(se_);
    si_ = ScopeBank::getInstance()->insertScope(si_);
    sc_ = ScopeBank::getInstance()->insertScope(sc_);
+
+   // fast path of hc4Revise
+   dag_->setFastEval(env_->getParams()->getStrParam("HC4_FAST_EVAL") == "YES");
+
+   // monotonicity-based evaluation in hc4Revise
+   dag_->setMonotonicEval(env_->getParams()->getStrParam("HC4_MONOTONIC_EVAL") == "YES");
 }
 
 std::shared_ptr<Env> ContractorFactory::getEnv() const
@@ -96,6 +109,40 @@ IntervalFunctionVector ContractorFactory::makeIntervalFunctionVector()
    return F;
 }
 
+PropagationScheduling ContractorFactory::scheduling() const
+{
+   std::string s = env_->getParams()->getStrParam("PROPAGATION_SCHEDULING");
+
+   if (s == "ADAPTIVE")
+      return PropagationScheduling::Adaptive;
+
+   else if (s == "ADAPTIVE_SKIP")
+      return PropagationScheduling::AdaptiveSkip;
+
+   else if (s == "BLOCKS")
+      return PropagationScheduling::Blocks;
+
+   else
+      return PropagationScheduling::FIFO;
+}
+
+CornerStyle ContractorFactory::cornerStyle() const
+{
+   std::string s = env_->getParams()->getStrParam("POLYTOPE_HULL_TAYLOR_CORNER");
+
+   if (s == "RANDOM")
+      return CornerStyle::Random;
+
+   else if (s == "LEFT")
+      return CornerStyle::Left;
+
+   else if (s == "RIGHT")
+      return CornerStyle::Right;
+
+   else
+      return CornerStyle::RandomOpposite;
+}
+
 SharedContractorHC4 ContractorFactory::makeHC4(double tol)
 {
    // constraints from the dag
@@ -117,6 +164,8 @@ SharedContractorHC4 ContractorFactory::makeHC4(double tol)
 
    // tuning of propagation
    hc4->setTol(tol);
+   hc4->setScheduling(scheduling());
+   hc4->setNbThreads(env_->getParams()->getIntParam("NB_THREADS"));
 
    return hc4;
 }
@@ -149,6 +198,8 @@ SharedContractorBC4 ContractorFactory::makeBC4()
    // tuning of propagation
    double tol = env_->getParams()->getDblParam("PROPAGATION_TOL");
    bc4->setTol(tol);
+   bc4->setScheduling(scheduling());
+   bc4->setNbThreads(env_->getParams()->getIntParam("NB_THREADS"));
 
    // tuning of BC4Revise operators
    double f = env_->getParams()->getDblParam("BC3_PEEL_FACTOR");
@@ -160,10 +211,44 @@ SharedContractorBC4 ContractorFactory::makeBC4()
    return bc4;
 }
 
+SharedContractorHC4 ContractorFactory::makePolynomial()
+{
+   SharedContractorHC4 hc4 = makeHC4();
+
+   size_t bmax = env_->getParams()->getIntParam("POLYNOMIAL_BERNSTEIN_LIMIT");
+   double f = env_->getParams()->getDblParam("BC3_PEEL_FACTOR");
+   int niter = env_->getParams()->getIntParam("BC3_ITER_LIMIT");
+
+   for (size_t i = 0; i < dag_->nbFuns(); ++i)
+   {
+      SharedContractorPolynomial op;
+      try
+      {
+         op = std::make_shared<ContractorPolynomial>(dag_, i);
+      }
+      catch (Exception &e)
+      {
+         // not a polynomial
+         continue;
+      }
+
+      if (op->getPolynomial().degree() <= 1)
+         continue;
+
+      op->setBernsteinLimit(bmax);
+      op->setPeelFactor(f);
+      op->setMaxIter(niter);
+      hc4->push(op);
+   }
+
+   return hc4;
+}
+
 SharedContractorAffine ContractorFactory::makeAffine(double tol)
 {
    // constraints from the dag
-   SharedContractorAffine ctc = std::make_shared<ContractorAffine>(dag_);
+   bool incremental = env_->getParams()->getStrParam("AFFINE_INCREMENTAL") == "YES";
+   SharedContractorAffine ctc = std::make_shared<ContractorAffine>(dag_, true, incremental);
 
    // other constraints
    for (const Constraint &c : vc_)
@@ -181,6 +266,7 @@ SharedContractorAffine ContractorFactory::makeAffine(double tol)
 
    // tuning of propagation
    ctc->setTol(tol);
+   ctc->setScheduling(scheduling());
 
    return ctc;
 }
@@ -311,18 +397,7 @@ SharedContractorPolytope ContractorFactory::makePolytope()
          bool hansen =
              env_->getParams()->getStrParam("POLYTOPE_HULL_TAYLOR_HANSEN") == "YES";
 
-         std::string corner =
-             env_->getParams()->getStrParam("POLYTOPE_HULL_TAYLOR_CORNER");
-
-         CornerStyle style;
-         if (corner == "RANDOM_OPPOSITE")
-            style = CornerStyle::RandomOpposite;
-         else if (corner == "RANDOM")
-            style = CornerStyle::Random;
-         else if (corner == "LEFT")
-            style = CornerStyle::Left;
-         else if (corner == "RIGHT")
-            style = CornerStyle::Right;
+         CornerStyle style = cornerStyle();
 
          unsigned seed =
              (unsigned)env_->getParams()->getIntParam("POLYTOPE_HULL_TAYLOR_SEED");
@@ -337,9 +412,12 @@ SharedContractorPolytope ContractorFactory::makePolytope()
          bool minrange =
              env_->getParams()->getStrParam("POLYTOPE_HULL_AFFINE_APPROX") == "MINRANGE";
 
-         std::unique_ptr<Linearizer> lzr =
+         std::unique_ptr<LinearizerAffine> lzr =
              std::make_unique<LinearizerAffine>(dag_, minrange);
 
+         lzr->useIncremental(env_->getParams()->getStrParam("AFFINE_INCREMENTAL") ==
+                             "YES");
+
          op = std::make_shared<ContractorPolytope>(std::move(lzr));
       }
       else if (relaxation == "AFFINE_TAYLOR")
@@ -347,18 +425,7 @@ SharedContractorPolytope ContractorFactory::makePolytope()
          bool hansen =
              env_->getParams()->getStrParam("POLYTOPE_HULL_TAYLOR_HANSEN") == "YES";
 
-         std::string corner =
-             env_->getParams()->getStrParam("POLYTOPE_HULL_TAYLOR_CORNER");
-
-         CornerStyle style;
-         if (corner == "RANDOM_OPPOSITE")
-            style = CornerStyle::RandomOpposite;
-         else if (corner == "RANDOM")
-            style = CornerStyle::Random;
-         else if (corner == "LEFT")
-            style = CornerStyle::Left;
-         else if (corner == "RIGHT")
-            style = CornerStyle::Right;
+         CornerStyle style = cornerStyle();
 
          unsigned seed =
              (unsigned)env_->getParams()->getIntParam("POLYTOPE_HULL_TAYLOR_SEED");
@@ -376,9 +443,34 @@ SharedContractorPolytope ContractorFactory::makePolytope()
 
          ASSERT(affine != nullptr, "affine null");
 
+         affine->useIncremental(env_->getParams()->getStrParam("AFFINE_INCREMENTAL") ==
+                                "YES");
+
          std::unique_ptr<Linearizer> lzr = std::make_unique<LinearizerAffineTaylor>(
              dag_, std::move(affine), std::move(taylor));
 
+         op = std::make_shared<ContractorPolytope>(std::move(lzr));
+      }
+      else if (relaxation == "QUADRATIC")
+      {
+         std::unique_ptr<LinearizerQuadratic> lzr =
+             std::make_unique<LinearizerQuadratic>(dag_, vt_);
+
+         // Taylor forms for the functions that are not quadratic
+         if (!lzr->otherFuns().empty())
+         {
+            bool hansen =
+                env_->getParams()->getStrParam("POLYTOPE_HULL_TAYLOR_HANSEN") == "YES";
+
+            CornerStyle style = cornerStyle();
+
+            unsigned seed =
+                (unsigned)env_->getParams()->getIntParam("POLYTOPE_HULL_TAYLOR_SEED");
+
+            lzr->setTaylor(std::make_unique<LinearizerTaylor>(dag_, lzr->otherFuns(),
+                                                              hansen, style, seed));
+         }
+
          op = std::make_shared<ContractorPolytope>(std::move(lzr));
       }
    }
@@ -400,6 +492,9 @@ SharedContractorPolytope ContractorFactory::makePolytope()
       bool loop = (env_->getParams()->getStrParam("POLYTOPE_HULL_LOOP") == "YES");
       double looptol = env_->getParams()->getDblParam("POLYTOPE_HULL_LOOP_TOL");
       op->enforceLoop(loop, looptol);
+
+      int nbt = env_->getParams()->getIntParam("POLYTOPE_HULL_THREADS");
+      op->setNbThreads(nbt);
    }
 
    return op;
@@ -26,6 +26,7 @@
 #include "realpaver/ContractorBC4.hpp"
 #include "realpaver/ContractorDomain.hpp"
 #include "realpaver/ContractorHC4.hpp"
+#include "realpaver/ContractorPolynomial.hpp"
 #include "realpaver/ContractorPolytope.hpp"
 #include "realpaver/Dag.hpp"
 #include "realpaver/Env.hpp"
@@ -95,6 +96,15 @@ public:
     */
    SharedContractorBC4 makeBC4();
 
+   /**
+    * @brief Returns an HC4 contractor enriched with polynomial contractors.
+    *
+    * Creates the contractor returned by makeHC4() and inserts in its
+    * propagator a polynomial contractor for each function of the DAG that
+    * is a polynomial whose total degree is greater than 1.
+    */
+   SharedContractorHC4 makePolynomial();
+
    /**
     * @brief Returns an affine contractor.
     *
@@ -155,10 +165,17 @@ private:
    std::vector<size_t> ve_;     // indexes of equations in the DAG
    std::vector<size_t> vi_;     // indexes of inequalities in the DAG
    std::vector<Constraint> vc_; // other constraints
+   std::vector<Term> vt_;       // terms of the functions of the DAG
 
    Scope se_; // scope of equations
    Scope si_; // scope of inequalities
    Scope sc_; // scope of the other constraints
+
+   // returns the value of PROPAGATION_SCHEDULING
+   PropagationScheduling scheduling() const;
+
+   // returns the value of POLYTOPE_HULL_TAYLOR_CORNER
+   CornerStyle cornerStyle() const;
 };
 
 } // namespace realpaver
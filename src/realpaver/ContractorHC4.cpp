@@ -70,6 +70,31 @@ void ContractorHC4::setTol(double tol)
    propag_->setTol(tol);
 }
 
+PropagationScheduling ContractorHC4::getScheduling() const
+{
+   return propag_->getScheduling();
+}
+
+void ContractorHC4::setScheduling(PropagationScheduling s)
+{
+   propag_->setScheduling(s);
+}
+
+size_t ContractorHC4::getNbThreads() const
+{
+   return propag_->getNbThreads();
+}
+
+void ContractorHC4::setNbThreads(size_t n)
+{
+   propag_->setNbThreads(n);
+}
+
+IntervalPropagator *ContractorHC4::getPropagator() const
+{
+   return propag_;
+}
+
 void ContractorHC4::push(SharedContractor op)
 {
    propag_->push(op);
@@ -59,6 +59,21 @@ public:
    /// Sets the tolerance used as stopping criterion
    void setTol(double tol);
 
+   /// Returns the scheduling strategy of the propagator
+   PropagationScheduling getScheduling() const;
+
+   /// Sets the scheduling strategy of the propagator
+   void setScheduling(PropagationScheduling s);
+
+   /// Returns the number of threads used to propagate the components
+   size_t getNbThreads() const;
+
+   /// Sets the number of threads used to propagate the components
+   void setNbThreads(size_t n);
+
+   /// Returns the propagator
+   IntervalPropagator *getPropagator() const;
+
 private:
    SharedDag dag_;              // DAG
    IntervalPropagator *propag_; // propagation algorithm
@@ -0,0 +1,219 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   ContractorPolynomial.cpp
+ * @brief  Contractor of polynomial constraints
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#include "realpaver/ContractorPolynomial.hpp"
+#include "realpaver/Logger.hpp"
+#include "realpaver/Param.hpp"
+#include <stack>
+
+namespace realpaver {
+
+ContractorPolynomial::ContractorPolynomial(SharedDag dag, size_t i)
+    : dag_(dag)
+    , if_(i)
+    , p_(dag->fun(i))
+    , bmax_(0)
+    , peeler_(Params::GetDblParam("BC3_PEEL_FACTOR"))
+    , maxiter_(Params::GetIntParam("BC3_ITER_LIMIT"))
+    , newton_()
+    , g_()
+    , q_()
+{
+}
+
+const Polynomial &ContractorPolynomial::getPolynomial() const
+{
+   return p_;
+}
+
+size_t ContractorPolynomial::getBernsteinLimit() const
+{
+   return bmax_;
+}
+
+void ContractorPolynomial::setBernsteinLimit(size_t n)
+{
+   bmax_ = n;
+}
+
+void ContractorPolynomial::setPeelFactor(double f)
+{
+   peeler_.setFactor(f);
+}
+
+void ContractorPolynomial::setMaxIter(size_t val)
+{
+   maxiter_ = val;
+}
+
+Scope ContractorPolynomial::scope() const
+{
+   return p_.scope();
+}
+
+Proof ContractorPolynomial::isConsistent(const Interval &x)
+{
+   Interval e = g_.eval(x);
+
+   if (e.isEmpty() || !e.containsZero())
+      return Proof::Empty;
+
+   else
+      return Proof::Maybe;
+}
+
+Proof ContractorPolynomial::shrink(const Interval &x, Interval &res, bool left)
+{
+   std::stack<Interval> stak;
+   size_t nbiter = 0;
+
+   stak.push(x);
+   while (!stak.empty())
+   {
+      Interval y(stak.top());
+      stak.pop();
+
+      if (++nbiter > maxiter_)
+      {
+         res = y;
+         return Proof::Maybe;
+      }
+
+      // is the bound of y consistent ?
+      Interval b = left ? peeler_.peelLeft(y) : peeler_.peelRight(y),
+               z = left ? Interval(b.right(), y.right()) : Interval(y.left(), b.left());
+
+      if (isConsistent(b) != Proof::Empty)
+      {
+         res = b;
+         return Proof::Maybe;
+      }
+
+      Proof proof = newton_.contract(g_, z);
+
+      if (proof == Proof::Feasible)
+      {
+         res = z;
+         return Proof::Maybe;
+      }
+      else if (proof != Proof::Empty)
+      {
+         double c = z.midpoint();
+
+         if (!z.strictlyContains(c))
+         {
+            res = z;
+            return Proof::Maybe;
+         }
+
+         // the part close to the bound is explored first
+         if (left)
+         {
+            stak.push(Interval(c, z.right()));
+            stak.push(Interval(z.left(), c));
+         }
+         else
+         {
+            stak.push(Interval(z.left(), c));
+            stak.push(Interval(c, z.right()));
+         }
+      }
+   }
+
+   res = Interval::emptyset();
+   return Proof::Empty;
+}
+
+Proof ContractorPolynomial::contract(IntervalBox &B)
+{
+   LOG_LOW("Polynomial contractor @ " << if_ << " on " << B);
+
+   Interval img = dag_->fun(if_)->getImage();
+
+   // range enclosure, the Bernstein form being calculated only if the
+   // Horner form does not permit to conclude
+   Interval e = p_.eval(B), eb;
+
+   if (bmax_ > 0 && !e.isEmpty() && e.overlaps(img) && !img.contains(e) &&
+       p_.bernstein(B, bmax_, eb))
+      e &= eb;
+
+   if (e.isEmpty() || !e.overlaps(img))
+   {
+      LOG_LOW(" -> " << Proof::Empty);
+      return Proof::Empty;
+   }
+
+   if (img.contains(e))
+   {
+      LOG_LOW(" -> " << Proof::Inner);
+      return Proof::Inner;
+   }
+
+   // contraction of the variables one by one
+   for (size_t i = 0; i < p_.nbVars(); ++i)
+   {
+      if (p_.degree(i) == 0)
+         continue;
+
+      Variable v = p_.var(i);
+      Interval x = B.get(v);
+
+      p_.coefficients(i, B, q_);
+
+      if (q_.size() == 2 && !q_[1].containsZero())
+      {
+         // projection q0 + q1*x in img
+         x &= (img - q_[0]) / q_[1];
+      }
+      else
+      {
+         g_.set(q_, img);
+
+         Interval lsol, rsol;
+         if (shrink(x, lsol, true) == Proof::Empty)
+            x.setEmpty();
+
+         else
+         {
+            shrink(Interval(lsol.left(), x.right()), rsol, false);
+            x = lsol | rsol;
+         }
+      }
+
+      if (x.isEmpty())
+      {
+         LOG_LOW(" -> " << Proof::Empty);
+         return Proof::Empty;
+      }
+
+      B.set(v, x);
+   }
+
+   LOG_LOW(" -> " << Proof::Maybe << ", " << B);
+   return Proof::Maybe;
+}
+
+void ContractorPolynomial::print(std::ostream &os) const
+{
+   os << "Polynomial contractor #" << if_;
+}
+
+} // namespace realpaver
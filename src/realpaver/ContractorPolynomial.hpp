@@ -0,0 +1,106 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   ContractorPolynomial.hpp
+ * @brief  Contractor of polynomial constraints
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#ifndef REALPAVER_CONTRACTOR_POLYNOMIAL_HPP
+#define REALPAVER_CONTRACTOR_POLYNOMIAL_HPP
+
+#include "realpaver/Contractor.hpp"
+#include "realpaver/IntervalNewtonUni.hpp"
+#include "realpaver/IntervalSlicer.hpp"
+#include "realpaver/Polynomial.hpp"
+
+namespace realpaver {
+
+/**
+ * @brief Contractor of a polynomial constraint.
+ *
+ * It applies to a constraint f(x1, ..., xn) in I from a DAG such that f is
+ * a polynomial. The range of f on a box is first enclosed by its Horner form.
+ * If this enclosure is not included in I and does not prove infeasibility,
+ * it is intersected with the Bernstein form of f provided that the number of
+ * Bernstein coefficients is not greater than a limit (0 by default, i.e. the
+ * Bernstein form is disabled). Then, for each variable xi, f is rewritten as
+ * a univariate polynomial in xi whose coefficients are the Horner evaluations
+ * of polynomials in the other variables. The domain of xi is contracted with
+ * respect to this univariate polynomial by a BC3-like algorithm, i.e. by a
+ * combination of peeling, bisection and the univariate interval Newton
+ * method. A direct projection is used for the variables of degree 1.
+ */
+class ContractorPolynomial : public Contractor {
+public:
+   /**
+    * @brief Creates a contractor associated with the i-th function of a DAG.
+    *
+    * Throws an exception if this function is not a polynomial.
+    */
+   ContractorPolynomial(SharedDag dag, size_t i);
+
+   /// Default destructor
+   ~ContractorPolynomial() = default;
+
+   /// No copy
+   ContractorPolynomial(const ContractorPolynomial &) = delete;
+
+   /// No assignment
+   ContractorPolynomial &operator=(const ContractorPolynomial &) = delete;
+
+   /// Returns the polynomial enclosed
+   const Polynomial &getPolynomial() const;
+
+   /// Returns the maximum number of Bernstein coefficients (0 if disabled)
+   size_t getBernsteinLimit() const;
+
+   /// Sets the maximum number of Bernstein coefficients (0 if disabled)
+   void setBernsteinLimit(size_t n);
+
+   /// Sets the peel factor
+   void setPeelFactor(double f);
+
+   /// Sets the maximum number of steps in the shrinking method
+   void setMaxIter(size_t val);
+
+   Scope scope() const override;
+   Proof contract(IntervalBox &B) override;
+   void print(std::ostream &os) const override;
+
+private:
+   SharedDag dag_;            // a dag
+   size_t if_;                // index of the function in the dag
+   Polynomial p_;             // polynomial
+   size_t bmax_;              // maximum number of Bernstein coefficients
+   IntervalPeeler peeler_;    // peeling at interval bounds
+   size_t maxiter_;           // maximum number of steps in shrink
+   IntervalNewtonUni newton_; // interval Newton method
+   PolynomialUni g_;          // univariate polynomial
+   std::vector<Interval> q_;  // coefficients of g_
+
+   // shrinks the left or right bound of x with respect to g_
+   Proof shrink(const Interval &x, Interval &res, bool left);
+
+   // returns Empty if g_ has no zero in x
+   Proof isConsistent(const Interval &x);
+};
+
+/// Type of shared pointers on polynomial contractors
+using SharedContractorPolynomial = std::shared_ptr<ContractorPolynomial>;
+
+} // namespace realpaver
+
+#endif
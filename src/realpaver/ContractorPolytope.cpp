@@ -22,8 +22,10 @@
 #include "realpaver/ContractorPolytope.hpp"
 #include "realpaver/LPModel.hpp"
 #include "realpaver/Logger.hpp"
+#include "realpaver/Parallel.hpp"
 #include "realpaver/Param.hpp"
 #include "realpaver/Scope.hpp"
+#include <memory>
 
 namespace realpaver {
 
@@ -35,6 +37,9 @@ ContractorPolytope::ContractorPolytope(std::unique_ptr<Linearizer> lzr)
     , feastol_(Params::GetDblParam("LP_FEAS_TOL"))
     , loop_(Params::GetStrParam("POLYTOPE_HULL_LOOP") == "YES")
     , looptol_(Params::GetDblParam("POLYTOPE_HULL_LOOP_TOL"))
+    , nbt_(Params::GetIntParam("POLYTOPE_HULL_THREADS"))
+    , nbsolved_(0)
+    , nbskipped_(0)
 {
    ASSERT((lzr_ != nullptr), "Empty linearizer in a polytope contractor");
 }
@@ -95,8 +100,32 @@ void ContractorPolytope::enforceLoop(bool loop, double tol)
    looptol_ = tol;
 }
 
+size_t ContractorPolytope::getNbThreads() const
+{
+   return nbt_;
+}
+
+void ContractorPolytope::setNbThreads(size_t n)
+{
+   ASSERT(n >= 1, "Bad number of threads in a polytope contractor: " << n);
+
+   nbt_ = n;
+}
+
+size_t ContractorPolytope::nbSolvedLPs() const
+{
+   return nbsolved_;
+}
+
+size_t ContractorPolytope::nbSkippedLPs() const
+{
+   return nbskipped_;
+}
+
 Proof ContractorPolytope::contract(IntervalBox &B)
 {
+   nbsolved_ = nbskipped_ = 0;
+
    if (!loop_)
       return contractImpl(B);
 
@@ -146,11 +175,21 @@ Proof ContractorPolytope::contractImpl(IntervalBox &B)
    for (int i = 0; i < nrb; ++i)
       rb[i] = i;
 
-   Proof proof = run(solver, B, lb, nlb, rb, nrb, iv, sense);
+   // the LP solvers write logs, which cannot be done concurrently
+   size_t nbt = nbt_;
+#if LOG_ON
+   if (Logger::getInstance()->getLogLevel() >= LogLevel::inter)
+      nbt = 1;
+#endif
+
+   Proof proof = (nbt > 1) ? runParallel(solver, B, lb, nlb, rb, nrb, nbt)
+                           : run(solver, B, lb, nlb, rb, nrb, iv, sense);
 
    delete[] lb;
    delete[] rb;
 
+   LOG_INTER("LPs solved: " << nbsolved_ << ", skipped: " << nbskipped_);
+
    return proof;
 }
 
@@ -172,6 +211,7 @@ Proof ContractorPolytope::run(LPSolver &solver, IntervalBox &B, int *lb, int &nl
 
       // optimization
       status = (status != LPStatus::Optimal) ? solver.optimize() : solver.reoptimize();
+      ++nbsolved_;
 
       LOG_LOW("Status : " << status);
 
@@ -240,7 +280,8 @@ Proof ContractorPolytope::run(LPSolver &solver, IntervalBox &B, int *lb, int &nl
       if (iv >= 0)
       {
          if (status == LPStatus::Optimal)
-            selectAchterberg(solver, B, lb, nlb, rb, nrb, iv, sense);
+            selectAchterberg(solver, solver.primalSolution(), B, lb, nlb, rb, nrb, iv,
+                             sense);
 
          else
             selectNext(lb, nlb, rb, nrb, iv, sense);
@@ -256,114 +297,298 @@ Proof ContractorPolytope::run(LPSolver &solver, IntervalBox &B, int *lb, int &nl
    return proof;
 }
 
-void ContractorPolytope::selectAchterberg(LPSolver &solver, IntervalBox &B, int *lb,
-                                          int &nlb, int *rb, int &nrb, int &iv,
-                                          LPSense &sense)
+Proof ContractorPolytope::runParallel(LPSolver &solver, IntervalBox &B, int *lb,
+                                      int &nlb, int *rb, int &nrb, size_t nbt)
 {
-   LOG_LOW("Achterberg's heuristics");
+   // one LP solver per thread, the first one being the given solver
+   std::vector<std::unique_ptr<LPSolver>> copies;
+   std::vector<LPSolver *> solvers = {&solver};
+   for (size_t k = 1; k < nbt; ++k)
+   {
+      copies.push_back(std::make_unique<LPSolver>());
+      copies.back()->copyModel(solver);
+      solvers.push_back(copies.back().get());
+   }
 
-   if (nlb + nrb == 0)
+   // task k is solved by the k-th solver
+   std::vector<Task> tasks(nbt);
+   for (Task &t : tasks)
+      t.status = LPStatus::Other;
+
+   // first round: left bound of the first variable and the next bounds
+   int iv = 0;
+   LPSense sense = LPSense::Min;
+   size_t nt = 0;
+   while (nt < nbt)
    {
-      iv = -1;
-      return;
+      if (nt > 0)
+         selectNext(lb, nlb, rb, nrb, iv, sense);
+      if (iv < 0)
+         break;
+
+      tasks[nt].iv = iv;
+      tasks[nt].sense = sense;
+      ++nt;
    }
 
-   // Achterberg's heuristics. Each bound that is too close to the current
-   // primal solution is discarded. Among the other bounds, the one that is
-   // the clothest to the primal solution is selected., which aims at
-   // minimizing the number of iterations of the Simplex algorithm.
-   double dist = Double::greatest();
-   int idx = -1;
-   LPSense sns = LPSense::Min;
+   auto solve = [&](size_t k)
+   {
+      Task &t = tasks[k];
+      LPSolver *lp = solvers[k];
+
+      LinExpr e({1.0}, {lp->getLinVar(t.lin)});
+      lp->setCost(e);
+      lp->setSense(t.sense);
+
+      t.status = (t.status != LPStatus::Optimal) ? lp->optimize() : lp->reoptimize();
+      if (t.status == LPStatus::Optimal)
+      {
+         t.bnd = lp->certifiedCostSolution();
+         t.primal = lp->primalSolution();
+      }
+   };
 
-   RealVector primal = solver.primalSolution();
+   Proof proof = Proof::Maybe;
+   bool stop = false;
+
+   while (nt > 0 && !stop)
+   {
+      for (size_t k = 0; k < nt; ++k)
+         tasks[k].lin = lzr_->linVarIndex(scope().var(tasks[k].iv));
+
+      parallelFor(nt, nbt, solve);
+      nbsolved_ += nt;
+
+      // contracts the domains
+      for (size_t k = 0; k < nt && !stop; ++k)
+      {
+         Task &t = tasks[k];
+         Variable v = scope().var(t.iv);
+
+         LOG_LOW("LP solved: " << t.sense << " " << v.getName() << " -> "
+                               << t.status);
+
+         switch (t.status)
+         {
+         case LPStatus::Optimal: {
+            Interval x = B.get(v);
+            if (t.sense == LPSense::Min)
+            {
+               if (t.bnd > x.right())
+               {
+                  stop = true;
+                  proof = Proof::Empty;
+               }
+               else if (t.bnd > x.left())
+               {
+                  B.set(v, Interval(t.bnd, x.right()));
+                  for (LPSolver *lp : solvers)
+                     lp->getLinVar(t.lin).setLB(t.bnd);
+               }
+            }
+            else
+            {
+               if (t.bnd < x.left())
+               {
+                  stop = true;
+                  proof = Proof::Empty;
+               }
+               else if (t.bnd < x.right())
+               {
+                  B.set(v, Interval(x.left(), t.bnd));
+                  for (LPSolver *lp : solvers)
+                     lp->getLinVar(t.lin).setUB(t.bnd);
+               }
+            }
+            break;
+         }
+         case LPStatus::Infeasible: {
+            stop = true;
+            if (solvers[k]->isCertifiedInfeasible())
+               proof = Proof::Empty;
+            break;
+         }
+         case LPStatus::StopOnIterLimit:
+         case LPStatus::StopOnTimeLimit: {
+            stop = true;
+            break;
+         }
+         default: {
+            break;
+         }
+         }
+      }
+
+      if (stop)
+         break;
+
+      // filters the bounds given all the primal solutions of this round
+      for (size_t k = 0; k < nt; ++k)
+         if (tasks[k].status == LPStatus::Optimal)
+            filterBounds(solver, tasks[k].primal, B, lb, nlb, rb, nrb);
+
+      // selects the next LPs, each thread reusing its last primal solution
+      size_t ntasks = nt;
+      nt = 0;
+      while (nt < ntasks)
+      {
+         Task &t = tasks[nt];
+         iv = t.iv;
+         sense = t.sense;
+
+         if (t.status == LPStatus::Optimal)
+            selectAchterberg(solver, t.primal, B, lb, nlb, rb, nrb, iv, sense);
+         else
+            selectNext(lb, nlb, rb, nrb, iv, sense);
+
+         if (iv < 0)
+            break;
+
+         t.iv = iv;
+         t.sense = sense;
+         ++nt;
+      }
+   }
+
+#if LOG_ON
+   LOG_INTER("Proof: " << proof);
+   if (proof != Proof::Empty)
+      LOG_INTER("New box: " << B);
+#endif
 
+   return proof;
+}
+
+bool ContractorPolytope::isAttained(double bnd, double sol) const
+{
+   double delta = Double::abs(sol - bnd);
+
+   return (Double::abs(bnd) < 1.0 && delta < feastol_) ||
+          (Double::abs(bnd) >= 1.0 && Double::abs(delta / bnd) < feastol_);
+}
+
+void ContractorPolytope::filterBounds(LPModel &model, const RealVector &primal,
+                                      const IntervalBox &B, int *lb, int &nlb, int *rb,
+                                      int &nrb)
+{
    // examines the left bounds
    int j = 0;
    while (j < nlb)
    {
-      int jv = lb[j]; // index of variable in the scope
-      Variable aux = scope().var(jv);
-      LinVar lin = solver.getLinVar(lzr_->linVarIndex(aux));
-      double bnd = B.get(aux).left(), sol = primal[lin.getIndex()],
-             delta = Double::abs(sol - bnd);
+      Variable aux = scope().var(lb[j]);
+      LinVar lin = model.getLinVar(lzr_->linVarIndex(aux));
 
-      LOG_LOW("Var: " << aux.getName() << ", left: " << bnd << ", sol: " << sol
-                      << ", delta: " << delta);
-
-      if ((Double::abs(bnd) < 1.0 && delta < feastol_) ||
-          (Double::abs(bnd) >= 1.0 && Double::abs(delta / bnd) < feastol_))
+      if (isAttained(B.get(aux).left(), primal[lin.getIndex()]))
       {
          // the primal solution is close enough to the left bound
          // this bound can be discarded
          LOG_LOW("Left bound of " << aux.getName() << " discarded");
          std::swap(lb[j], lb[--nlb]);
+         ++nbskipped_;
       }
       else
-      {
-         if (delta < dist)
-         {
-            // this bound minimizes the distance with its primal solution
-            // (but it is not close enough acording to the tolerance)
-            dist = delta;
-            idx = j;
-            sns = LPSense::Min;
-         }
          j++;
-      }
    }
 
    // examines the right bounds
    j = 0;
    while (j < nrb)
    {
-      int jv = rb[j]; // index of variable in the scope
-      Variable aux = scope().var(jv);
-      LinVar lin = solver.getLinVar(lzr_->linVarIndex(aux));
-      double bnd = B.get(aux).right(), sol = primal[lin.getIndex()],
-             delta = Double::abs(sol - bnd);
+      Variable aux = scope().var(rb[j]);
+      LinVar lin = model.getLinVar(lzr_->linVarIndex(aux));
 
-      LOG_LOW("Var: " << aux.getName() << ", right: " << bnd << ", sol: " << sol
-                      << ", delta: " << delta);
-
-      if ((Double::abs(bnd) < 1.0 && delta < feastol_) ||
-          (Double::abs(bnd) >= 1.0 && Double::abs(delta / bnd) < feastol_))
+      if (isAttained(B.get(aux).right(), primal[lin.getIndex()]))
       {
          // the primal solution is close enough to the right bound
          // this bound can be discarded
          LOG_LOW("Right bound of " << aux.getName() << " discarded");
          std::swap(rb[j], rb[--nrb]);
+         ++nbskipped_;
       }
       else
-      {
-         if (delta < dist)
-         {
-            // this bound minimizes the distance to the primal solution
-            // (but it is not close enough acording to the tolerance)
-            dist = delta;
-            idx = j;
-            sns = LPSense::Max;
-         }
          j++;
-      }
    }
+}
 
-   if (idx == -1)
+void ContractorPolytope::selectAchterberg(LPModel &model, const RealVector &primal,
+                                          const IntervalBox &B, int *lb, int &nlb,
+                                          int *rb, int &nrb, int &iv, LPSense &sense)
+{
+   LOG_LOW("Achterberg's heuristics");
+
+   // Achterberg's heuristics. Each bound that is too close to the current
+   // primal solution is discarded. Among the other bounds, the one that is
+   // the clothest to the primal solution is selected., which aims at
+   // minimizing the number of iterations of the Simplex algorithm.
+   filterBounds(model, primal, B, lb, nlb, rb, nrb);
+
+   if (nlb + nrb == 0)
+   {
       iv = -1;
-   else
+      return;
+   }
+
+   double dist = Double::greatest();
+   int idx = -1;
+   LPSense sns = LPSense::Min;
+
+   // examines the left bounds
+   for (int j = 0; j < nlb; ++j)
    {
-      sense = sns;
-      if (sns == LPSense::Min)
+      Variable aux = scope().var(lb[j]);
+      LinVar lin = model.getLinVar(lzr_->linVarIndex(aux));
+      double bnd = B.get(aux).left(), sol = primal[lin.getIndex()],
+             delta = Double::abs(sol - bnd);
+
+      LOG_LOW("Var: " << aux.getName() << ", left: " << bnd << ", sol: " << sol
+                      << ", delta: " << delta);
+
+      if (delta < dist)
       {
-         iv = lb[idx];
-         std::swap(lb[idx], lb[--nlb]);
+         // this bound minimizes the distance with its primal solution
+         dist = delta;
+         idx = j;
+         sns = LPSense::Min;
       }
-      else
+   }
+
+   // examines the right bounds
+   for (int j = 0; j < nrb; ++j)
+   {
+      Variable aux = scope().var(rb[j]);
+      LinVar lin = model.getLinVar(lzr_->linVarIndex(aux));
+      double bnd = B.get(aux).right(), sol = primal[lin.getIndex()],
+             delta = Double::abs(sol - bnd);
+
+      LOG_LOW("Var: " << aux.getName() << ", right: " << bnd << ", sol: " << sol
+                      << ", delta: " << delta);
+
+      if (delta < dist)
       {
-         iv = rb[idx];
-         std::swap(rb[idx], rb[--nrb]);
+         // this bound minimizes the distance to the primal solution
+         dist = delta;
+         idx = j;
+         sns = LPSense::Max;
       }
    }
+
+   if (idx == -1)
+   {
+      iv = -1;
+      return;
+   }
+
+   sense = sns;
+   if (sns == LPSense::Min)
+   {
+      iv = lb[idx];
+      std::swap(lb[idx], lb[--nlb]);
+   }
+   else
+   {
+      iv = rb[idx];
+      std::swap(rb[idx], rb[--nrb]);
+   }
 }
 
 void ContractorPolytope::selectNext(int *lb, int &nlb, int *rb, int &nrb, int &iv,
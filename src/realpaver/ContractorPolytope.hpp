@@ -42,6 +42,16 @@ namespace realpaver {
  * tuned according to Achterberg's heuristics, see: A. Baharev, T. Achterberg,
  * and E. Rév. Computation of an extractive distillation column with affine
  * arithmetic. AIChE journal, 2009, 55(7):1695-1704.
+ *
+ * Every primal solution is used to filter the bounds: an LP is skipped if its
+ * bound is already attained by a primal solution since it cannot be improved.
+ *
+ * The LPs can be solved concurrently by several threads. In this case, the
+ * model is copied once per thread and the LPs are solved by rounds. Each
+ * thread solves one LP per round, then the domains are contracted, the bounds
+ * are filtered, and the next LPs are selected from the primal solutions. This
+ * mode is disabled when the log level is at least inter since the LP solvers
+ * write logs.
  */
 class ContractorPolytope : public Contractor {
 public:
@@ -97,6 +107,18 @@ public:
     */
    void enforceLoop(bool loop, double tol = 0.0);
 
+   /// Returns the number of threads solving the LPs
+   size_t getNbThreads() const;
+
+   /// Assigns the number of threads solving the LPs (at least 1)
+   void setNbThreads(size_t n);
+
+   /// Returns the number of LPs solved by the last contraction
+   size_t nbSolvedLPs() const;
+
+   /// Returns the number of LPs skipped by the last contraction
+   size_t nbSkippedLPs() const;
+
    Scope scope() const override;
    Proof contract(IntervalBox &B) override;
    void print(std::ostream &os) const override;
@@ -110,6 +132,21 @@ private:
    double feastol_;    // feasibility tolerance
    bool loop_;         // true when applied in a fixed-point loop
    double looptol_;    // improvement factor of the fixed-point loop
+   size_t nbt_;        // number of threads solving the LPs
+
+   // statistics of the last contraction
+   size_t nbsolved_;  // number of LPs solved
+   size_t nbskipped_; // number of LPs skipped by the filtering of bounds
+
+   // LP solved by a thread in one round of the parallel mode
+   struct Task {
+      int iv;            // index of the variable in the scope
+      int lin;           // index of the linear variable
+      LPSense sense;     // optimization sense
+      LPStatus status;   // status of the last LP solved by this thread
+      double bnd;        // certified bound if the status is Optimal
+      RealVector primal; // primal solution if the status is Optimal
+   };
 
    // tunes the LP solver
    void tuneLPSolver(LPSolver &solver);
@@ -118,10 +155,19 @@ private:
    Proof contractImpl(IntervalBox &B);
    Proof run(LPSolver &solver, IntervalBox &B, int *lb, int &nlb, int *rb, int &nrb,
              int &iv, LPSense &sense);
+   Proof runParallel(LPSolver &solver, IntervalBox &B, int *lb, int &nlb, int *rb,
+                     int &nrb, size_t nbt);
+
+   // returns true if a bound is attained by the value of a primal solution
+   bool isAttained(double bnd, double sol) const;
+
+   // discards the bounds attained by a primal solution
+   void filterBounds(LPModel &model, const RealVector &primal, const IntervalBox &B,
+                     int *lb, int &nlb, int *rb, int &nrb);
 
    // selects the next variable and the optimization sense
-   void selectAchterberg(LPSolver &solver, IntervalBox &B, int *lb, int &nlb, int *rb,
-                         int &nrb, int &iv, LPSense &sense);
+   void selectAchterberg(LPModel &model, const RealVector &primal, const IntervalBox &B,
+                         int *lb, int &nlb, int *rb, int &nrb, int &iv, LPSense &sense);
    void selectNext(int *lb, int &nlb, int *rb, int &nrb, int &iv, LPSense &sense);
 };
 
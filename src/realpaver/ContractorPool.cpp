@@ -21,6 +21,7 @@
 #include "realpaver/ContractorPool.hpp"
 #include "realpaver/AssertDebug.hpp"
 #include "realpaver/ScopeBank.hpp"
+#include <algorithm>
 
 namespace realpaver {
 
@@ -62,20 +63,234 @@ void ContractorPool::makeDep()
    dep_.clear();
    dep_.resize(scop_.size());
 
-   for (size_t i = 0; i < scop_.size(); ++i)
+   // only the variables of the scope of a contractor are considered, hence the
+   // lists of contractors are sorted by increasing index
+   for (size_t j = 0; j < v_.size(); ++j)
    {
-      Variable v = scop_.var(i);
-
-      for (size_t j = 0; j < v_.size(); ++j)
+      for (const auto &v : v_[j]->scope())
       {
          if (v_[j]->dependsOn(v))
          {
-            dep_[i].push_back(j);
+            dep_[scop_.index(v)].push_back(j);
+         }
+      }
+   }
+}
+
+size_t ContractorPool::makeComponents(std::vector<size_t> &comp) const
+{
+   size_t n = v_.size(), none = n, nc = 0;
+   comp.assign(n, none);
+
+   std::vector<size_t> stack;
+
+   for (size_t i = 0; i < n; ++i)
+   {
+      if (comp[i] != none)
+         continue;
+
+      // depth-first search from the i-th contractor
+      comp[i] = nc;
+      stack.push_back(i);
+
+      while (!stack.empty())
+      {
+         size_t j = stack.back();
+         stack.pop_back();
+
+         for (const auto &v : v_[j]->scope())
+         {
+            for (size_t k : dep_[scop_.index(v)])
+            {
+               if (comp[k] == none)
+               {
+                  comp[k] = nc;
+                  stack.push_back(k);
+               }
+            }
+         }
+      }
+      ++nc;
+   }
+
+   return nc;
+}
+
+void ContractorPool::makeMatching(std::vector<size_t> &match) const
+{
+   size_t n = v_.size(), m = scop_.size();
+   match.assign(n, m);
+
+   // cmatch[j] is the index of the contractor matched with the j-th variable
+   std::vector<size_t> cmatch(m, n);
+
+   // variables of the contractors
+   std::vector<std::vector<size_t>> var(n);
+   for (size_t i = 0; i < n; ++i)
+      for (const auto &v : v_[i]->scope())
+         var[i].push_back(scop_.index(v));
+
+   // greedy matching
+   for (size_t i = 0; i < n; ++i)
+   {
+      for (size_t j : var[i])
+      {
+         if (cmatch[j] == n)
+         {
+            match[i] = j;
+            cmatch[j] = i;
+            break;
+         }
+      }
+   }
+
+   // search of augmenting paths from the unmatched contractors
+   std::vector<size_t> visited(m, n), parent(m, n), stack, pos;
+
+   for (size_t i = 0; i < n; ++i)
+   {
+      if (match[i] != m)
+         continue;
+
+      // iterative depth-first search alternating between the contractors and
+      // the variables, stack contains the contractors and pos[k] is the next
+      // variable of stack[k] to be visited
+      stack.assign(1, i);
+      pos.assign(1, 0);
+      size_t found = m;
+
+      while (!stack.empty() && found == m)
+      {
+         size_t c = stack.back();
+
+         if (pos.back() == var[c].size())
+         {
+            stack.pop_back();
+            pos.pop_back();
+            continue;
+         }
+
+         size_t j = var[c][pos.back()++];
+         if (visited[j] == i)
+            continue;
+
+         visited[j] = i;
+         parent[j] = c;
+
+         if (cmatch[j] == n)
+            found = j;
+
+         else
+         {
+            stack.push_back(cmatch[j]);
+            pos.push_back(0);
          }
       }
+
+      // augmentation along the path ending at the found variable
+      while (found != m)
+      {
+         size_t c = parent[found], prev = match[c];
+         match[c] = found;
+         cmatch[found] = c;
+         found = (c == i) ? m : prev;
+      }
    }
 }
 
+size_t ContractorPool::makeBlocks(std::vector<size_t> &block) const
+{
+   size_t n = v_.size(), m = scop_.size(), none = n;
+
+   std::vector<size_t> match;
+   makeMatching(match);
+
+   // the contractor matched with each variable
+   std::vector<size_t> cmatch(m, none);
+   for (size_t i = 0; i < n; ++i)
+      if (match[i] != m)
+         cmatch[match[i]] = i;
+
+   // succ[i] is the list of contractors using the variable computed by the
+   // i-th contractor
+   std::vector<std::vector<size_t>> succ(n);
+   for (size_t i = 0; i < n; ++i)
+   {
+      for (const auto &v : v_[i]->scope())
+      {
+         size_t k = cmatch[scop_.index(v)];
+         if (k != none && k != i)
+            succ[k].push_back(i);
+      }
+   }
+
+   // iterative Tarjan's algorithm, the strongly connected components being
+   // generated in reverse topological order
+   std::vector<size_t> index(n, none), low(n, 0), scc(n, none), stack, call, pos;
+   std::vector<bool> onstack(n, false);
+   size_t next = 0, nb = 0;
+
+   for (size_t r = 0; r < n; ++r)
+   {
+      if (index[r] != none)
+         continue;
+
+      call.assign(1, r);
+      pos.assign(1, 0);
+      index[r] = low[r] = next++;
+      stack.push_back(r);
+      onstack[r] = true;
+
+      while (!call.empty())
+      {
+         size_t i = call.back();
+
+         if (pos.back() < succ[i].size())
+         {
+            size_t k = succ[i][pos.back()++];
+
+            if (index[k] == none)
+            {
+               index[k] = low[k] = next++;
+               stack.push_back(k);
+               onstack[k] = true;
+               call.push_back(k);
+               pos.push_back(0);
+            }
+            else if (onstack[k])
+               low[i] = std::min(low[i], index[k]);
+         }
+         else
+         {
+            call.pop_back();
+            pos.pop_back();
+
+            if (!call.empty())
+               low[call.back()] = std::min(low[call.back()], low[i]);
+
+            if (low[i] == index[i])
+            {
+               size_t k;
+               do
+               {
+                  k = stack.back();
+                  stack.pop_back();
+                  onstack[k] = false;
+                  scc[k] = nb;
+               } while (k != i);
+               ++nb;
+            }
+         }
+      }
+   }
+
+   block.resize(n);
+   for (size_t i = 0; i < n; ++i)
+      block[i] = nb - 1 - scc[i];
+
+   return nb;
+}
+
 size_t ContractorPool::depSize(const Variable &v) const
 {
    return dep_[scop_.index(v)].size();
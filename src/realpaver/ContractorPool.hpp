@@ -23,6 +23,7 @@
 
 #include "realpaver/Contractor.hpp"
 #include <memory>
+#include <vector>
 
 namespace realpaver {
 
@@ -32,6 +33,14 @@ namespace realpaver {
  * A pool manages a set of contractors. Its scopes is the union of the scopes
  * of those contractors. The contractors must be accessed through shared
  * pointers.
+ *
+ * The structure of the graph linking the contractors and the variables can be
+ * analyzed. Two contractors belong to the same component if they are connected
+ * by a chain of contractors sharing variables. The blocks are obtained from a
+ * maximum matching between the contractors and the variables, every matched
+ * contractor being seen as computing its matched variable from the other ones.
+ * The blocks are the strongly connected components of the resulting graph,
+ * which are ranked in a topological order.
  */
 class ContractorPool {
 public:
@@ -65,6 +74,25 @@ public:
    /// Returns the index in this pool of the i-th contractor depending on v
    size_t depAt(const Variable &v, size_t i) const;
 
+   /**
+    * @brief Calculates the connected components of this.
+    * @param comp output vector such that comp[i] is the index of the component
+    *        of the i-th contractor
+    * @return the number of components
+    */
+   size_t makeComponents(std::vector<size_t> &comp) const;
+
+   /**
+    * @brief Calculates the block-triangular structure of this.
+    * @param block output vector such that block[i] is the rank of the block
+    *        of the i-th contractor, the first block having rank 0
+    * @return the number of blocks
+    *
+    * Given two contractors in different blocks with ranks k < l, the one in
+    * block k does not use a variable computed in block l.
+    */
+   size_t makeBlocks(std::vector<size_t> &block) const;
+
    /// Output on a stream
    void print(std::ostream &os) const;
 
@@ -80,6 +108,11 @@ private:
 
    // makes the dependency relation between the variables and the contractors
    void makeDep();
+
+   // maximum matching between the contractors and the variables such that
+   // match[i] is the index of the variable matched with the i-th contractor,
+   // or scop_.size() if this contractor is not matched
+   void makeMatching(std::vector<size_t> &match) const;
 };
 
 /// Type of shared contractor pools
@@ -1052,7 +1052,11 @@ Dag::Dag()
     , fun_()
     , vmap_()
     , omap_()
+    , cmap_()
     , scop_()
+    , idv_()
+    , jvar_()
+    , hbox_(nullptr)
 {
 }
 
@@ -1141,6 +1145,7 @@ size_t Dag::insertConstNode(const Interval &x)
 
       pushNode(node);
       cnode_.push_back(node);
+      cmap_[x.hashCode()].push_back(index);
    }
 
    return node->index();
@@ -1212,9 +1217,14 @@ size_t Dag::insertOpNode(size_t hcode, DagOp *node)
 
 DagConst *Dag::findConstNode(const Interval &x) const
 {
-   for (size_t i = 0; i < cnode_.size(); ++i)
+   auto it = cmap_.find(x.hashCode());
+
+   if (it == cmap_.end())
+      return nullptr;
+
+   for (size_t i : it->second)
    {
-      DagConst *node = cnode_[i];
+      DagConst *node = static_cast<DagConst *>(node_[i]);
       if (node->getConst().isSetEq(x))
          return node;
    }
@@ -1261,6 +1271,56 @@ Scope Dag::scope() const
    return scop_;
 }
 
+void Dag::setFastEval(bool b)
+{
+   for (DagFun *f : fun_)
+      if (f->flatFunction() != nullptr)
+         f->flatFunction()->setFastEval(b);
+}
+
+size_t Dag::nbFastEvals() const
+{
+   size_t n = 0;
+   for (DagFun *f : fun_)
+      if (f->flatFunction() != nullptr)
+         n += f->flatFunction()->nbFastEvals();
+   return n;
+}
+
+size_t Dag::nbFastProofs() const
+{
+   size_t n = 0;
+   for (DagFun *f : fun_)
+      if (f->flatFunction() != nullptr)
+         n += f->flatFunction()->nbFastProofs();
+   return n;
+}
+
+void Dag::setMonotonicEval(bool b)
+{
+   for (DagFun *f : fun_)
+      if (f->flatFunction() != nullptr)
+         f->flatFunction()->setMonotonicEval(b);
+}
+
+size_t Dag::nbMonotonicEvals() const
+{
+   size_t n = 0;
+   for (DagFun *f : fun_)
+      if (f->flatFunction() != nullptr)
+         n += f->flatFunction()->nbMonotonicEvals();
+   return n;
+}
+
+size_t Dag::nbMonotonicSigns() const
+{
+   size_t n = 0;
+   for (DagFun *f : fun_)
+      if (f->flatFunction() != nullptr)
+         n += f->flatFunction()->nbMonotonicSigns();
+   return n;
+}
+
 bool Dag::iEvalNodes(const IntervalBox &B)
 {
    bool res = true;
@@ -1337,29 +1397,65 @@ void Dag::iEval(const IntervalBox &B, IntervalVector &V)
    }
 }
 
+void Dag::makeDiffSpace()
+{
+   if (idv_.size() == nbNodes() && jvar_.size() == nbFuns())
+      return;
+
+   idv_.assign(nbNodes(), Interval::zero());
+   jvar_.resize(nbFuns());
+
+   for (size_t i = 0; i < nbFuns(); ++i)
+   {
+      DagFun *f = fun_[i];
+      jvar_[i].clear();
+
+      for (size_t k = 0; k < f->nbVars(); ++k)
+      {
+         DagVar *node = f->varNode(k);
+         jvar_[i].push_back({node->index(), scop_.index(node->getVar())});
+      }
+   }
+
+   hbox_ = std::make_unique<IntervalBox>(scop_);
+}
+
 void Dag::iDiff(const IntervalBox &B, IntervalMatrix &J)
 {
    ASSERT(nbVars() == J.ncols() && nbFuns() == J.nrows(),
           "Bad dimensions of a Jacobian matrix used in a DAG");
 
+   makeDiffSpace();
+
+   // forward phase: evaluates all the nodes on B
+   iEvalNodes(B);
+
    for (size_t i = 0; i < nbFuns(); ++i)
    {
-      // differentiates the i-th function
       DagFun *f = fun_[i];
-      IntervalVector G(f->nbVars());
-      f->iDiff(B, G);
 
-      // fills the i-th row of the matrix
-      size_t j = 0;
-      for (const auto &v : scope())
-      {
-         if (f->dependsOn(v))
-            J.set(i, j, G[f->scope().index(v)]);
-         else
-            J.set(i, j, Interval::zero());
+      for (size_t j = 0; j < nbVars(); ++j)
+         J.set(i, j, Interval::zero());
 
-         ++j;
+      if (f->rootNode()->ival().isEmpty())
+      {
+         for (const auto &p : jvar_[i])
+            J.set(i, p.second, Interval::emptyset());
+         continue;
       }
+
+      // backward phase on the nodes of the i-th function
+      for (size_t k = 0; k < f->nbNodes(); ++k)
+         idv_[f->node(k)->index()] = Interval::zero();
+
+      idv_[f->rootNode()->index()] = Interval::one();
+
+      for (size_t k = f->nbNodes(); k > 0; --k)
+         iDiffNode(f->node(k - 1));
+
+      // fills the i-th row of the matrix
+      for (const auto &p : jvar_[i])
+         J.set(i, p.second, idv_[p.first]);
    }
 }
 
@@ -1368,38 +1464,364 @@ void Dag::iDiffHansen(const IntervalBox &B, const RealPoint &c, IntervalMatrix &
    ASSERT(nbVars() == H.ncols() && nbFuns() == H.nrows(),
           "Bad dimensions of a Hansen matrix used in a DAG");
 
-   ASSERT(nbVars() == nbFuns(),
-          "Hansen's derivatives can be computed only for square systems");
+   makeDiffSpace();
 
-   IntervalBox X(scop_, c);
+   // evaluates all the nodes at c
+   IntervalBox &X = *hbox_;
+   for (const auto &v : scop_)
+      X.set(v, Interval(c.get(v)));
+
+   iEvalNodes(X);
 
    size_t j = 0;
-   for (const auto &v : scope())
+   for (const auto &v : scop_)
    {
-      // assigns the domain of v
+      // assigns the domain of v and reevaluates the nodes depending on v
+      // together with their derivatives with respect to v
       X.set(v, B.get(v));
 
-      // calculates every dfi/dv and assigns it in the Jacobian matrix
-      for (size_t i = 0; i < nbFuns(); ++i)
+      for (size_t k = 0; k < nbNodes(); ++k)
       {
-         DagFun *f = fun_[i];
+         DagNode *node = node_[k];
 
-         if (f->dependsOn(v))
+         if (node->dependsOn(v))
          {
-            IntervalVector G(f->nbVars());
-            f->iDiff(X, G);
-            H.set(i, j, G[f->scope().index(v)]);
+            node->iEvalNode(X);
+            iDiffNode(node, v);
          }
          else
-         {
+            idv_[k] = Interval::zero();
+      }
+
+      // assigns the j-th column of the matrix
+      for (size_t i = 0; i < nbFuns(); ++i)
+      {
+         DagNode *root = fun_[i]->rootNode();
+
+         if (!root->dependsOn(v))
             H.set(i, j, Interval::zero());
-         }
+
+         else if (root->ival().isEmpty())
+            H.set(i, j, Interval::emptyset());
+
+         else
+            H.set(i, j, idv_[root->index()]);
       }
 
       ++j;
    }
 }
 
+void Dag::iDiffNode(DagNode *node)
+{
+   size_t i = node->index();
+   Interval d = idv_[i];
+
+   switch (node->symbol())
+   {
+   case DagSymbol::Cst:
+   case DagSymbol::Var:
+      break;
+
+   case DagSymbol::Add:
+      // d(l+r)/dl = 1, d(l+r)/dr = 1
+      idv_[node->left()->index()] += d;
+      idv_[node->right()->index()] += d;
+      break;
+
+   case DagSymbol::Sub:
+      // d(l-r)/dl = 1, d(l-r)/dr = -1
+      idv_[node->left()->index()] += d;
+      idv_[node->right()->index()] -= d;
+      break;
+
+   case DagSymbol::Mul:
+      // d(l*r)/dl = r, d(l*r)/dr = l
+      idv_[node->left()->index()] += node->right()->ival() * d;
+      idv_[node->right()->index()] += node->left()->ival() * d;
+      break;
+
+   case DagSymbol::Div:
+      // d(l/r)/dl = 1/r, d(l/r)/dr = -l/r^2
+      idv_[node->left()->index()] += d / node->right()->ival();
+      idv_[node->right()->index()] +=
+          (-d * node->left()->ival()) / sqr(node->right()->ival());
+      break;
+
+   case DagSymbol::Min:
+      if (node->left()->ival().isCertainlyLt(node->right()->ival()))
+      {
+         // d(min(l,r))/dl = 1, d(min(l,r))/dr = 0 if l < r
+         idv_[node->left()->index()] += d;
+      }
+      else if (node->right()->ival().isCertainlyLt(node->left()->ival()))
+      {
+         // d(min(l,r))/dl = 0, d(min(l,r))/dr = 1 if r < l
+         idv_[node->right()->index()] += d;
+      }
+      else
+      {
+         // d(min(l,r))/dl = d(min(l,r))/dr = [0,1] otherwise
+         Interval x = Interval(0.0, 1.0) * d;
+         idv_[node->left()->index()] += x;
+         idv_[node->right()->index()] += x;
+      }
+      break;
+
+   case DagSymbol::Max:
+      if (node->left()->ival().isCertainlyGt(node->right()->ival()))
+      {
+         // d(max(l,r))/dl = 1 and d(max(l,r))/dr = 0 if l > r
+         idv_[node->left()->index()] += d;
+      }
+      else if (node->right()->ival().isCertainlyGt(node->left()->ival()))
+      {
+         // d(max(l,r))/dl = 0 and d(max(l,r))/dr = 1 if r > l
+         idv_[node->right()->index()] += d;
+      }
+      else
+      {
+         // d(max(l,r))/dl = d(max(l,r))/dr = [0,1] otherwise
+         Interval x = Interval(0.0, 1.0) * d;
+         idv_[node->left()->index()] += x;
+         idv_[node->right()->index()] += x;
+      }
+      break;
+
+   case DagSymbol::Usb:
+      // d(-u)/du = -1
+      idv_[node->child()->index()] -= d;
+      break;
+
+   case DagSymbol::Abs:
+      // d(abs(u))/du = 1 if u>0, -1 if u<0, [-1,1] otherwise
+      if (node->child()->ival().isCertainlyGtZero())
+         idv_[node->child()->index()] += d;
+
+      else if (node->child()->ival().isCertainlyLtZero())
+         idv_[node->child()->index()] -= d;
+
+      else
+         idv_[node->child()->index()] += d | (-d);
+      break;
+
+   case DagSymbol::Sgn:
+      // d(sgn(u))/du = 0 except at 0
+      break;
+
+   case DagSymbol::Sqr:
+      // d(u^2)/du = 2u
+      idv_[node->child()->index()] += 2.0 * node->child()->ival() * d;
+      break;
+
+   case DagSymbol::Sqrt:
+      // d(sqrt(u))/du = 0.5/sqrt(u)
+      idv_[node->child()->index()] += (0.5 * d) / node->ival();
+      break;
+
+   case DagSymbol::Pow: {
+      // d(u^n)/du = n * u^(n-1)
+      int e = static_cast<DagPow *>(node)->exponent();
+      idv_[node->child()->index()] += Interval(e) * d * pow(node->child()->ival(), e - 1);
+   }
+   break;
+
+   case DagSymbol::Exp:
+      // d(exp(u))/du = exp(u)
+      idv_[node->child()->index()] += d * node->ival();
+      break;
+
+   case DagSymbol::Log:
+      // d(log(u))/du = 1/u
+      idv_[node->child()->index()] += d / node->child()->ival();
+      break;
+
+   case DagSymbol::Cos:
+      // d(cos(u))/du = -sin(u)
+      idv_[node->child()->index()] -= d * sin(node->child()->ival());
+      break;
+
+   case DagSymbol::Sin:
+      // d(sin(u))/du = cos(u)
+      idv_[node->child()->index()] += d * cos(node->child()->ival());
+      break;
+
+   case DagSymbol::Tan:
+      // d(tan(u))/du = 1+tan^2(u)
+      idv_[node->child()->index()] += d * (1.0 + sqr(node->ival()));
+      break;
+
+   case DagSymbol::Cosh:
+      // d(cosh(u))/du = sinh(u)
+      idv_[node->child()->index()] += d * sinh(node->child()->ival());
+      break;
+
+   case DagSymbol::Sinh:
+      // d(sinh(u))/du = cosh(u)
+      idv_[node->child()->index()] += d * cosh(node->child()->ival());
+      break;
+
+   case DagSymbol::Tanh:
+      // d(tanh(u))/du = 1-tanh^2(u)
+      idv_[node->child()->index()] += d * (1.0 - sqr(node->ival()));
+      break;
+
+   case DagSymbol::Lin: {
+      // d(a0 + sum_i ai*xi)/dxi = ai
+      DagLin *lin = static_cast<DagLin *>(node);
+      for (auto it = lin->begin(); it != lin->end(); ++it)
+         idv_[lin->getNodeSub(it)->index()] += lin->getCoefSub(it) * d;
+   }
+   break;
+   }
+}
+
+void Dag::iDiffNode(DagNode *node, const Variable &v)
+{
+   // the derivatives at the sub-nodes that do not depend on v are equal to 0
+   Interval &d = idv_[node->index()];
+
+   switch (node->symbol())
+   {
+   case DagSymbol::Cst:
+      d = Interval::zero();
+      break;
+
+   case DagSymbol::Var:
+      d = Interval::one();
+      break;
+
+   case DagSymbol::Add:
+      d = idv_[node->left()->index()] + idv_[node->right()->index()];
+      break;
+
+   case DagSymbol::Sub:
+      d = idv_[node->left()->index()] - idv_[node->right()->index()];
+      break;
+
+   case DagSymbol::Mul:
+      // the derivatives of the constant sub-nodes are not multiplied since
+      // 0*[-oo,+oo] may not be reduced to 0
+      d = Interval::zero();
+      if (node->left()->dependsOn(v))
+         d += idv_[node->left()->index()] * node->right()->ival();
+      if (node->right()->dependsOn(v))
+         d += node->left()->ival() * idv_[node->right()->index()];
+      break;
+
+   case DagSymbol::Div:
+      d = Interval::zero();
+      if (node->left()->dependsOn(v))
+         d += idv_[node->left()->index()] / node->right()->ival();
+      if (node->right()->dependsOn(v))
+         d += (-idv_[node->right()->index()] * node->left()->ival()) /
+              sqr(node->right()->ival());
+      break;
+
+   case DagSymbol::Min:
+      if (node->left()->ival().isCertainlyLt(node->right()->ival()))
+         d = idv_[node->left()->index()];
+
+      else if (node->right()->ival().isCertainlyLt(node->left()->ival()))
+         d = idv_[node->right()->index()];
+
+      else
+         d = Interval(0.0, 1.0) * idv_[node->left()->index()] +
+             Interval(0.0, 1.0) * idv_[node->right()->index()];
+      break;
+
+   case DagSymbol::Max:
+      if (node->left()->ival().isCertainlyGt(node->right()->ival()))
+         d = idv_[node->left()->index()];
+
+      else if (node->right()->ival().isCertainlyGt(node->left()->ival()))
+         d = idv_[node->right()->index()];
+
+      else
+         d = Interval(0.0, 1.0) * idv_[node->left()->index()] +
+             Interval(0.0, 1.0) * idv_[node->right()->index()];
+      break;
+
+   case DagSymbol::Usb:
+      d = -idv_[node->child()->index()];
+      break;
+
+   case DagSymbol::Abs: {
+      Interval x = idv_[node->child()->index()];
+
+      if (node->child()->ival().isCertainlyGtZero())
+         d = x;
+
+      else if (node->child()->ival().isCertainlyLtZero())
+         d = -x;
+
+      else
+         d = x | (-x);
+   }
+   break;
+
+   case DagSymbol::Sgn:
+      d = Interval::zero();
+      break;
+
+   case DagSymbol::Sqr:
+      d = 2.0 * node->child()->ival() * idv_[node->child()->index()];
+      break;
+
+   case DagSymbol::Sqrt:
+      d = (0.5 * idv_[node->child()->index()]) / node->ival();
+      break;
+
+   case DagSymbol::Pow: {
+      int e = static_cast<DagPow *>(node)->exponent();
+      d = Interval(e) * idv_[node->child()->index()] * pow(node->child()->ival(), e - 1);
+   }
+   break;
+
+   case DagSymbol::Exp:
+      d = idv_[node->child()->index()] * node->ival();
+      break;
+
+   case DagSymbol::Log:
+      d = idv_[node->child()->index()] / node->child()->ival();
+      break;
+
+   case DagSymbol::Cos:
+      d = -idv_[node->child()->index()] * sin(node->child()->ival());
+      break;
+
+   case DagSymbol::Sin:
+      d = idv_[node->child()->index()] * cos(node->child()->ival());
+      break;
+
+   case DagSymbol::Tan:
+      d = idv_[node->child()->index()] * (1.0 + sqr(node->ival()));
+      break;
+
+   case DagSymbol::Cosh:
+      d = idv_[node->child()->index()] * sinh(node->child()->ival());
+      break;
+
+   case DagSymbol::Sinh:
+      d = idv_[node->child()->index()] * cosh(node->child()->ival());
+      break;
+
+   case DagSymbol::Tanh:
+      d = idv_[node->child()->index()] * (1.0 - sqr(node->ival()));
+      break;
+
+   case DagSymbol::Lin: {
+      // only one variable node depends on v
+      d = Interval::zero();
+      DagLin *lin = static_cast<DagLin *>(node);
+      for (auto it = lin->begin(); it != lin->end(); ++it)
+         if (lin->getNodeSub(it)->dependsOn(v))
+            d += lin->getCoefSub(it);
+   }
+   break;
+   }
+}
+
 void Dag::rEval(const RealPoint &pt, RealVector &V)
 {
    for (size_t i = 0; i < nbFuns(); ++i)
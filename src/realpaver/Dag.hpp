@@ -940,6 +940,11 @@ public:
     *
     * J[i,k] is the partial derivative of the i-th function with respect to the
     * k-th variable of the scope of this.
+    *
+    * The nodes are evaluated once in a forward sweep over the DAG. Then the
+    * derivatives are accumulated in reverse mode function by function, hence
+    * the shared sub-expressions are evaluated only once. The interval value of
+    * each node can be obtained by the method ival() after this call.
     */
    void iDiff(const IntervalBox &B, IntervalMatrix &J);
 
@@ -950,6 +955,11 @@ public:
     * k-th variable of the scope of this.
     *
     * The point c must belong to B.
+    *
+    * The k-th column is calculated in forward mode on the box whose first k
+    * domains are taken from B and the other ones from c. Only the nodes
+    * depending on the k-th variable are reevaluated from one column to the
+    * next one.
     */
    void iDiffHansen(const IntervalBox &B, const RealPoint &c, IntervalMatrix &H);
 
@@ -968,6 +978,24 @@ public:
     */
    void rDiff(const RealPoint &pt, RealMatrix &J);
 
+   /// Enables or disables the fast path of hc4Revise in the functions
+   void setFastEval(bool b);
+
+   /// Returns the number of fast evaluations in hc4Revise
+   size_t nbFastEvals() const;
+
+   /// Returns the number of fast evaluations that have been conclusive
+   size_t nbFastProofs() const;
+
+   /// Enables or disables the monotonicity-based evaluation of hc4Revise
+   void setMonotonicEval(bool b);
+
+   /// Returns the number of monotonicity-based evaluations in hc4Revise
+   size_t nbMonotonicEvals() const;
+
+   /// Returns the number of calculations of the signs of the derivatives
+   size_t nbMonotonicSigns() const;
+
 private:
    // vector of nodes sorted by a topological ordering from the leaves
    // to the roots
@@ -993,6 +1021,9 @@ private:
    // map (hash code of an operation node -> list of node indexes)
    std::unordered_map<size_t, IndexList> omap_;
 
+   // map (hash code of a constant -> list of node indexes)
+   std::unordered_map<size_t, IndexList> cmap_;
+
    // scope
    Scope scop_;
 
@@ -1002,6 +1033,25 @@ private:
 
    // pushes a new node in the vector of nodes
    void pushNode(DagNode *node);
+
+   // workspace of the differentiation methods: derivative at each node
+   std::vector<Interval> idv_;
+
+   // workspace of the differentiation methods: for each function, list of
+   // couples (index of variable node, column in the Jacobian matrix)
+   std::vector<std::vector<std::pair<size_t, size_t>>> jvar_;
+
+   // workspace of the Hansen matrix
+   std::unique_ptr<IntervalBox> hbox_;
+
+   // allocates the workspace of the differentiation methods if necessary
+   void makeDiffSpace();
+
+   // reverse mode: propagates the derivative at node to its sub-nodes
+   void iDiffNode(DagNode *node);
+
+   // forward mode: calculates the derivative at node with respect to v
+   void iDiffNode(DagNode *node, const Variable &v);
 };
 
 /// Type of shared pointers to dags
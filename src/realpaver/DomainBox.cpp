@@ -178,6 +178,15 @@ double DomainBox::gapOnScope(const DomainBox &box, const Scope &scop) const
    return gap;
 }
 
+void DomainBox::setOnScope(const DomainBox &box, const Scope &scop)
+{
+   for (const auto &v : scop)
+   {
+      std::unique_ptr<Domain> dom(box.get(v)->clone());
+      set(v, std::move(dom));
+   }
+}
+
 void DomainBox::glue(const DomainBox &box)
 {
    glueOnScope(box, scop_);
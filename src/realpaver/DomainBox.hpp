@@ -110,6 +110,9 @@ public:
    /// Returns the gap between this and box restricted to scop
    double gapOnScope(const DomainBox &box, const Scope &scop) const;
 
+   /// Assigns in this the domains of box restricted to scop
+   void setOnScope(const DomainBox &box, const Scope &scop);
+
    /// Glues another box in this
    void glue(const DomainBox &box);
 
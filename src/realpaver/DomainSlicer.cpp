@@ -20,9 +20,17 @@
 
 #include "realpaver/DomainSlicer.hpp"
 #include "realpaver/AssertDebug.hpp"
+#include "realpaver/IntervalSlicer.hpp"
+#include <algorithm>
 
 namespace realpaver {
 
+DomainSlicer::DomainSlicer()
+    : cont_()
+    , arity_(2)
+{
+}
+
 DomainSlicer::~DomainSlicer()
 {
 }
@@ -44,6 +52,17 @@ void DomainSlicer::clear()
    cont_.clear();
 }
 
+size_t DomainSlicer::getArity() const
+{
+   return arity_;
+}
+
+void DomainSlicer::setArity(size_t k)
+{
+   ASSERT(k >= 2, "Bad arity " << k << " of a domain slicer");
+   arity_ = k;
+}
+
 void DomainSlicer::push(Domain *dom)
 {
    if (!dom->isEmpty())
@@ -197,4 +216,89 @@ void RangeUnionDomainBisecter::applyImpl(Domain *dom)
    }
 }
 
+/*----------------------------------------------------------------------------*/
+
+IntervalDomainPartitioner::IntervalDomainPartitioner(size_t k, double sip)
+    : DomainSlicer()
+    , sip_(sip)
+{
+   ASSERT(sip > 0.0 && sip < 1.0, "Bad parameter of interval partitioner");
+   setArity(k);
+}
+
+void IntervalDomainPartitioner::applyImpl(Domain *dom)
+{
+   IntervalDomain *ptr = dynamic_cast<IntervalDomain *>(dom);
+
+   ASSERT(ptr != nullptr, "Bad domain type as input of an interval domain slicer");
+
+   ASSERT(!ptr->isCanonical(), "Interval domain not splitable");
+
+   partition(ptr->getVal());
+}
+
+void IntervalDomainPartitioner::partition(const Interval &x)
+{
+   if (getArity() > 2 && !x.isInf())
+   {
+      IntervalPartitionMaker maker(getArity());
+      maker.apply(x);
+
+      for (const Interval &y : maker)
+         push(new IntervalDomain(y));
+   }
+   else
+   {
+      double m = (x.isInf()) ? x.midpoint() : x.left() + sip_ * x.width();
+
+      push(new IntervalDomain(Interval(x.left(), m)));
+      push(new IntervalDomain(Interval(m, x.right())));
+   }
+}
+
+/*----------------------------------------------------------------------------*/
+
+IntervalUnionDomainPartitioner::IntervalUnionDomainPartitioner(size_t k, double sip)
+    : DomainSlicer()
+    , sip_(sip)
+{
+   ASSERT(sip > 0.0 && sip < 1.0, "Bad parameter of interval union partitioner");
+   setArity(k);
+}
+
+void IntervalUnionDomainPartitioner::applyImpl(Domain *dom)
+{
+   IntervalUnionDomain *ptr = dynamic_cast<IntervalUnionDomain *>(dom);
+
+   ASSERT(ptr != nullptr, "Bad domain type as input of an interval union domain slicer");
+
+   ASSERT(!ptr->isCanonical(), "Interval union domain not splitable");
+
+   const IntervalUnion &u = ptr->getVal();
+   size_t n = u.size();
+
+   if (n > 1)
+   {
+      // splits u along with its holes in p parts of q or q+1 elements,
+      // the first r parts having q+1 elements
+      size_t p = std::min(n, getArity()), q = n / p, r = n % p, i = 0;
+
+      for (size_t j = 0; j < p; ++j)
+      {
+         size_t l = i + q + (j < r ? 1 : 0) - 1;
+         push(new IntervalUnionDomain(u.subUnion(i, l)));
+         i = l + 1;
+      }
+   }
+   else
+   {
+      IntervalDomainPartitioner slicer(getArity(), sip_);
+      slicer.partition(u[0]);
+
+      auto it = slicer.begin();
+      while (it != slicer.end())
+         push(slicer.next(it).release());
+   }
+}
+
 } // namespace realpaver
@@ -32,11 +32,16 @@ namespace realpaver {
  *
  * A slicer generates a list of sub-domains, i.e. the slices. The slices are
  * stored in this and they can be accessed through iterators.
+ *
+ * The arity is the number of slices requested by a splitting strategy, which
+ * is equal to 2 by default. It is only a hint since some slicers, e.g. the
+ * bisecters, always generate two slices and the number of slices may also be
+ * limited by the domain, e.g. a binary domain.
  */
 class DomainSlicer {
 public:
    /// Default constructor
-   DomainSlicer() = default;
+   DomainSlicer();
 
    /// Destructor
    virtual ~DomainSlicer();
@@ -56,6 +61,12 @@ public:
    /// Clears the container and delete the domains
    void clear();
 
+   /// Returns the arity of this
+   size_t getArity() const;
+
+   /// Assigns the arity of this (at least 2)
+   void setArity(size_t k);
+
 protected:
    /// Implements the slicing method
    virtual void applyImpl(Domain *dom) = 0;
@@ -65,7 +76,8 @@ protected:
 
 private:
    typedef std::list<std::unique_ptr<Domain>> ContainerType;
-   ContainerType cont_;
+   ContainerType cont_; // slices
+   size_t arity_;       // requested number of slices
 
 public:
    /// Iterators on the list of slices
@@ -198,6 +210,69 @@ public:
    void applyImpl(Domain *dom) override;
 };
 
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Slicer that divides an interval domain in k parts.
+ *
+ * Given an arity k > 2, an interval [a, b] is divided in k slices of equal
+ * width. If k = 2 or if the interval is unbounded, it is split in two parts
+ * at a+sip*(b-a) with 0<sip<1.
+ */
+class IntervalDomainPartitioner : public DomainSlicer {
+public:
+   /// Constructor given the arity k and the splitting point used by bisection
+   IntervalDomainPartitioner(size_t k, double sip);
+
+   /// No copy
+   IntervalDomainPartitioner(const IntervalDomainPartitioner &) = delete;
+
+   /// No assignment
+   IntervalDomainPartitioner &operator=(const IntervalDomainPartitioner &) = delete;
+
+   /// Default destructor
+   ~IntervalDomainPartitioner() = default;
+
+   void applyImpl(Domain *dom) override;
+
+   /// Divides x in k parts and inserts the slices in this
+   void partition(const Interval &x);
+
+private:
+   double sip_;
+};
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Slicer that divides an interval union domain in k parts.
+ *
+ * If the union has n > 1 elements, then it is split along with its holes in
+ * min(k, n) sub-unions having consecutive elements. The sub-unions have the
+ * same number of elements, up to one. Otherwise the interval is divided as
+ * done by an interval domain partitioner.
+ */
+class IntervalUnionDomainPartitioner : public DomainSlicer {
+public:
+   /// Constructor given the arity k and the splitting point used by bisection
+   IntervalUnionDomainPartitioner(size_t k, double sip);
+
+   /// No copy
+   IntervalUnionDomainPartitioner(const IntervalUnionDomainPartitioner &) = delete;
+
+   /// No assignment
+   IntervalUnionDomainPartitioner &
+   operator=(const IntervalUnionDomainPartitioner &) = delete;
+
+   /// Default destructor
+   ~IntervalUnionDomainPartitioner() = default;
+
+   void applyImpl(Domain *dom) override;
+
+private:
+   double sip_;
+};
+
 } // namespace realpaver
 
 #endif
@@ -50,4 +50,33 @@ std::unique_ptr<DomainSlicerMap> DomainSlicerFactory::makeBiStrategy(double sip)
    return smap;
 }
 
+std::unique_ptr<DomainSlicerMap> DomainSlicerFactory::makeKWayStrategy(size_t k,
+                                                                      double sip)
+{
+   std::unique_ptr<DomainSlicerMap> smap = std::make_unique<DomainSlicerMap>();
+   std::unique_ptr<DomainSlicer> slc;
+
+   // binary
+   slc = std::make_unique<BinaryDomainSlicer>();
+   smap->setSlicer(DomainType::Binary, std::move(slc));
+
+   // interval
+   slc = std::make_unique<IntervalDomainPartitioner>(k, sip);
+   smap->setSlicer(DomainType::Interval, std::move(slc));
+
+   // interval union
+   slc = std::make_unique<IntervalUnionDomainPartitioner>(k, sip);
+   smap->setSlicer(DomainType::IntervalUnion, std::move(slc));
+
+   // range
+   slc = std::make_unique<RangeDomainBisecter>();
+   smap->setSlicer(DomainType::Range, std::move(slc));
+
+   // range union
+   slc = std::make_unique<RangeUnionDomainBisecter>();
+   smap->setSlicer(DomainType::RangeUnion, std::move(slc));
+
+   return smap;
+}
+
 } // namespace realpaver
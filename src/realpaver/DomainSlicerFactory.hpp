@@ -45,6 +45,24 @@ public:
     * - binary: trivial
     */
    static std::unique_ptr<DomainSlicerMap> makeBiStrategy(double sip);
+
+   /**
+    * @brief Multi-way strategy.
+    *
+    * Returns a domain slicer map such that every domain is split in k parts
+    * if possible.
+    * - range: bisection
+    * - interval: k slices of equal width, bisection at a + sip*(b-a) if k = 2
+    * - interval union: split along with min(k, n) holes if n > 1 is the
+    *   number of elements, otherwise same as interval
+    * - range union split along with a hole if any, otherwise same as
+    *   range
+    * - binary: trivial
+    *
+    * The arity k of the slicers can be modified later, e.g. by a splitting
+    * strategy having an adaptive arity.
+    */
+   static std::unique_ptr<DomainSlicerMap> makeKWayStrategy(size_t k, double sip);
 };
 
 } // namespace realpaver
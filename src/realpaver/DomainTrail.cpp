@@ -0,0 +1,94 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   DomainTrail.cpp
+ * @brief  Trail of domains for backtracking
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#include "realpaver/DomainTrail.hpp"
+#include "realpaver/AssertDebug.hpp"
+
+namespace realpaver {
+
+DomainTrail::DomainTrail()
+    : box_(nullptr)
+    , trail_()
+    , maxsize_(0)
+{
+}
+
+void DomainTrail::attach(DomainBox *box)
+{
+   box_ = box;
+   trail_.clear();
+   maxsize_ = 0;
+}
+
+DomainBox *DomainTrail::box() const
+{
+   return box_;
+}
+
+size_t DomainTrail::mark() const
+{
+   return trail_.size();
+}
+
+size_t DomainTrail::maxSize() const
+{
+   return maxsize_;
+}
+
+void DomainTrail::save(const Variable &v)
+{
+   ASSERT(box_ != nullptr, "No box attached to a domain trail");
+
+   trail_.emplace_back(v, std::unique_ptr<Domain>(box_->get(v)->clone()));
+
+   if (trail_.size() > maxsize_)
+      maxsize_ = trail_.size();
+}
+
+void DomainTrail::assign(const Variable &v, std::unique_ptr<Domain> dom)
+{
+   save(v);
+   box_->set(v, std::move(dom));
+}
+
+void DomainTrail::undo(size_t mark)
+{
+   ASSERT(mark <= trail_.size(), "Bad mark " << mark << " in a domain trail");
+
+   while (trail_.size() > mark)
+   {
+      Entry &e = trail_.back();
+      box_->set(e.first, std::move(e.second));
+      trail_.pop_back();
+   }
+}
+
+void DomainTrail::restore(DomainBox &box, size_t mark) const
+{
+   ASSERT(mark <= trail_.size(), "Bad mark " << mark << " in a domain trail");
+
+   for (size_t i = trail_.size(); i > mark; --i)
+   {
+      const Entry &e = trail_[i - 1];
+      box.set(e.first, std::unique_ptr<Domain>(e.second->clone()));
+   }
+}
+
+} // namespace realpaver
@@ -0,0 +1,99 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   DomainTrail.hpp
+ * @brief  Trail of domains for backtracking
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#ifndef REALPAVER_DOMAIN_TRAIL_HPP
+#define REALPAVER_DOMAIN_TRAIL_HPP
+
+#include "realpaver/DomainBox.hpp"
+#include <utility>
+#include <vector>
+
+namespace realpaver {
+
+/**
+ * @brief Trail of domains for backtracking.
+ *
+ * A trail is attached to a domain box that is modified in place during a
+ * depth-first search. Before a domain is modified, its current value is saved
+ * on the trail. A mark is the size of the trail at some point, and undoing the
+ * trail to a mark restores the domains saved after this mark in the reverse
+ * order.
+ *
+ * The memory is then proportional to the number of modified domains along a
+ * path of the search tree instead of the number of nodes times the number of
+ * variables.
+ *
+ * The box is not owned by the trail.
+ */
+class DomainTrail {
+public:
+   /// Creates an empty trail attached to no box
+   DomainTrail();
+
+   /// Default destructor
+   ~DomainTrail() = default;
+
+   /// No copy
+   DomainTrail(const DomainTrail &) = delete;
+
+   /// No assignment
+   DomainTrail &operator=(const DomainTrail &) = delete;
+
+   /// Attaches a box to this and clears the trail
+   void attach(DomainBox *box);
+
+   /// Returns the box attached to this
+   DomainBox *box() const;
+
+   /// Returns the current mark, i.e. the size of the trail
+   size_t mark() const;
+
+   /// Returns the maximum size of the trail since the last attachment
+   size_t maxSize() const;
+
+   /// Saves the domain of v in the box
+   void save(const Variable &v);
+
+   /// Saves the domain of v and assigns it to dom in the box
+   void assign(const Variable &v, std::unique_ptr<Domain> dom);
+
+   /// Restores the domains saved after the given mark in the box
+   void undo(size_t mark);
+
+   /**
+    * @brief Restores a copy of the box at a given mark.
+    *
+    * The domains saved after the mark are assigned in the given box, which
+    * must have the same scope as the attached box, in the reverse order.
+    * This is not modified.
+    */
+   void restore(DomainBox &box, size_t mark) const;
+
+private:
+   typedef std::pair<Variable, std::unique_ptr<Domain>> Entry;
+
+   DomainBox *box_;           // box modified in place
+   std::vector<Entry> trail_; // saved domains
+   size_t maxsize_;           // maximum size of the trail
+};
+
+} // namespace realpaver
+
+#endif
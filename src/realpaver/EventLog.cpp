@@ -0,0 +1,414 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   EventLog.cpp
+ * @brief  Asynchronous binary log of events
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#include "realpaver/AssertDebug.hpp"
+#include "realpaver/Common.hpp"
+#include "realpaver/EventLog.hpp"
+#include "realpaver/Interval.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace realpaver {
+
+namespace {
+// returns the current time in nanoseconds
+uint64_t nowNanoseconds()
+{
+   auto d = std::chrono::steady_clock::now().time_since_epoch();
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+}
+} // namespace
+
+LogLevel LogEventLevel(LogEvent event)
+{
+   switch (event)
+   {
+   case LogEvent::Domain:
+      return LogLevel::low;
+   default:
+      return LogLevel::inter;
+   }
+}
+
+/*----------------------------------------------------------------------------*/
+
+const uint32_t EventLog::VERSION = 1;
+const size_t EventLog::CAPACITY = 1 << 14;
+
+EventLog EventLog::instance_;
+
+EventLog::EventLog()
+    : level_(static_cast<int>(LogLevel::none))
+    , ofs_()
+    , path_("")
+    , ring_()
+    , names_()
+    , mtx_()
+    , drainer_()
+    , stop_(false)
+    , gen_(0)
+    , busy_(0)
+    , nbrec_(0)
+    , start_(0)
+{
+}
+
+EventLog::~EventLog()
+{
+   if (ofs_.is_open())
+      close();
+}
+
+EventLog *EventLog::getInstance()
+{
+   return &instance_;
+}
+
+void EventLog::open(LogLevel level, const std::string &path)
+{
+   THROW_IF(instance_.ofs_.is_open(), "The event log is already open");
+
+   instance_.ofs_.open(path, std::ios::out | std::ios::binary);
+
+   THROW_IF(!instance_.ofs_.is_open(), "The event log file cannot be open");
+
+   instance_.ofs_.write("RPEL", 4);
+   instance_.ofs_.write(reinterpret_cast<const char *>(&VERSION), sizeof(VERSION));
+
+   instance_.path_ = path;
+   instance_.start_ = nowNanoseconds();
+   instance_.nbrec_ = 0;
+   instance_.stop_ = false;
+
+   // the buffers of a previous opening are no more used
+   ++instance_.gen_;
+
+   instance_.drainer_ = std::thread(&EventLog::work, &instance_);
+   instance_.level_ = static_cast<int>(level);
+}
+
+void EventLog::close()
+{
+   if (!instance_.ofs_.is_open())
+      return;
+
+   // the next calls of push() return at once and the pending ones are
+   // completed by the drainer, which is still active
+   instance_.level_ = static_cast<int>(LogLevel::none);
+   while (instance_.busy_ > 0)
+      std::this_thread::yield();
+
+   instance_.stop_ = true;
+   instance_.drainer_.join();
+
+   instance_.ofs_.close();
+   instance_.ring_.clear();
+   instance_.names_.clear();
+}
+
+LogLevel EventLog::getLogLevel() const
+{
+   return static_cast<LogLevel>(level_.load(std::memory_order_relaxed));
+}
+
+std::string EventLog::getPath() const
+{
+   return path_;
+}
+
+uint64_t EventLog::nbRecords() const
+{
+   return nbrec_;
+}
+
+void EventLog::defineVar(uint32_t id, const std::string &name)
+{
+   uint32_t n = name.size();
+
+   std::lock_guard<std::mutex> lock(mtx_);
+   names_.push_back('N');
+   names_.append(reinterpret_cast<const char *>(&id), sizeof(id));
+   names_.append(reinterpret_cast<const char *>(&n), sizeof(n));
+   names_.append(name);
+}
+
+EventLog::Ring *EventLog::getRing()
+{
+   thread_local Ring *ring = nullptr;
+   thread_local uint64_t gen = 0;
+
+   if (ring == nullptr || gen != gen_.load())
+   {
+      std::lock_guard<std::mutex> lock(mtx_);
+
+      std::unique_ptr<Ring> r = std::make_unique<Ring>();
+      r->buf = std::make_unique<LogRecord[]>(CAPACITY);
+      r->head = 0;
+      r->tail = 0;
+      r->thread = ring_.size();
+
+      ring = r.get();
+      gen = gen_;
+      ring_.push_back(std::move(r));
+   }
+   return ring;
+}
+
+void EventLog::push(LogEvent event, int64_t node, uint32_t aux, double lo, double up)
+{
+   // the log level is checked again after the registration of this call in
+   // order to synchronize with close(), both being sequentially consistent
+   ++busy_;
+   if (level_ == static_cast<int>(LogLevel::none))
+   {
+      --busy_;
+      return;
+   }
+
+   Ring *ring = getRing();
+
+   uint64_t h = ring->head.load(std::memory_order_relaxed);
+
+   // waits for the drainer if the buffer is full
+   while (h - ring->tail.load(std::memory_order_acquire) == CAPACITY)
+      std::this_thread::yield();
+
+   LogRecord &rec = ring->buf[h % CAPACITY];
+   rec.event = static_cast<uint16_t>(event);
+   rec.thread = ring->thread;
+   rec.aux = aux;
+   rec.node = node;
+   rec.time = nowNanoseconds() - start_;
+   rec.lo = lo;
+   rec.up = up;
+
+   ring->head.store(h + 1, std::memory_order_release);
+   --busy_;
+}
+
+bool EventLog::drain()
+{
+   std::vector<Ring *> rings;
+   bool any = false;
+   {
+      std::lock_guard<std::mutex> lock(mtx_);
+
+      // the names are written before the records that refer to them
+      if (!names_.empty())
+      {
+         ofs_.write(names_.data(), names_.size());
+         names_.clear();
+         any = true;
+      }
+
+      for (auto &r : ring_)
+         rings.push_back(r.get());
+   }
+
+   for (Ring *ring : rings)
+   {
+      uint64_t t = ring->tail.load(std::memory_order_relaxed),
+               h = ring->head.load(std::memory_order_acquire);
+
+      for (; t < h; ++t)
+      {
+         ofs_.put('R');
+         ofs_.write(reinterpret_cast<const char *>(&ring->buf[t % CAPACITY]),
+                    sizeof(LogRecord));
+         ++nbrec_;
+         any = true;
+      }
+
+      ring->tail.store(h, std::memory_order_release);
+   }
+
+   return any;
+}
+
+void EventLog::work()
+{
+   while (!stop_)
+   {
+      if (!drain())
+         std::this_thread::sleep_for(std::chrono::milliseconds(1));
+   }
+
+   // the producers are no more active
+   drain();
+}
+
+/*----------------------------------------------------------------------------*/
+
+void EventLogReader::read(const std::string &path)
+{
+   std::ifstream f(path, std::ios::in | std::ios::binary);
+   THROW_IF(!f.is_open(), "Open error of the event log file " << path);
+
+   std::string buf((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+   const char *cur = buf.data(), *end = buf.data() + buf.size();
+
+   auto check = [&](size_t n)
+   { THROW_IF((size_t)(end - cur) < n, "Truncated event log file " << path); };
+
+   uint32_t version;
+   check(4 + sizeof(version));
+   THROW_IF(std::memcmp(cur, "RPEL", 4) != 0, "Bad format of event log file " << path);
+   std::memcpy(&version, cur + 4, sizeof(version));
+   THROW_IF(version != EventLog::VERSION, "Bad version of event log file " << path);
+   cur += 4 + sizeof(version);
+
+   rec_.clear();
+   name_.clear();
+
+   while (cur != end)
+   {
+      char tag = *cur++;
+
+      if (tag == 'R')
+      {
+         LogRecord rec;
+         check(sizeof(rec));
+         std::memcpy(&rec, cur, sizeof(rec));
+         cur += sizeof(rec);
+         rec_.push_back(rec);
+      }
+      else if (tag == 'N')
+      {
+         uint32_t id, n;
+         check(2 * sizeof(uint32_t));
+         std::memcpy(&id, cur, sizeof(id));
+         std::memcpy(&n, cur + sizeof(id), sizeof(n));
+         cur += 2 * sizeof(uint32_t);
+         check(n);
+         name_[id] = std::string(cur, n);
+         cur += n;
+      }
+      else
+         THROW("Bad entry in event log file " << path);
+   }
+
+   std::stable_sort(rec_.begin(), rec_.end(), [](const LogRecord &a, const LogRecord &b)
+                    { return a.time < b.time; });
+}
+
+size_t EventLogReader::nbRecords() const
+{
+   return rec_.size();
+}
+
+const LogRecord &EventLogReader::record(size_t i) const
+{
+   ASSERT(i < rec_.size(), "Bad access to a record of an event log @ " << i);
+   return rec_[i];
+}
+
+std::string EventLogReader::varName(uint32_t id) const
+{
+   auto it = name_.find(id);
+   return (it == name_.end()) ? "_v" + std::to_string(id) : it->second;
+}
+
+void EventLogReader::render(std::ostream &os, std::streamsize prec, bool stamps) const
+{
+   std::ostringstream line;
+   line.precision(prec);
+
+   // writes one line given its level
+   auto write = [&](const LogRecord &rec, LogLevel level)
+   {
+      if (stamps)
+         os << std::fixed << std::setprecision(6) << (rec.time * 1.0e-9)
+            << std::defaultfloat << " #" << rec.thread << " ";
+
+      std::string s = LogLevelToString(level) + ".";
+      os << std::setw(7) << std::left << s << line.str() << std::endl;
+      line.str("");
+   };
+
+   size_t i = 0;
+   while (i < rec_.size())
+   {
+      const LogRecord &rec = rec_[i];
+      LogEvent event = static_cast<LogEvent>(rec.event);
+
+      switch (event)
+      {
+      case LogEvent::Extract:
+         os << std::endl;
+         line << "Extracts node " << rec.node << " (depth " << rec.aux << ")";
+         break;
+
+      case LogEvent::Domain: {
+         // consecutive domains of the same node in the same thread
+         line << "Node: (";
+         size_t j = i;
+         while (j < rec_.size() && rec_[j].event == rec.event &&
+                rec_[j].node == rec.node && rec_[j].thread == rec.thread)
+         {
+            if (j != i)
+               line << ", ";
+            line << varName(rec_[j].aux) << " = " << Interval(rec_[j].lo, rec_[j].up);
+            ++j;
+         }
+         line << ")";
+         i = j - 1;
+         break;
+      }
+
+      case LogEvent::Contract:
+         line << "Contraction -> " << static_cast<Proof>(rec.aux);
+         break;
+
+      case LogEvent::Inner:
+         line << "Node " << rec.node << " contains an inner box";
+         break;
+
+      case LogEvent::DepthLimit:
+         line << "Node fathomed due to the depth limit";
+         break;
+
+      case LogEvent::Solution:
+         line << "Node " << rec.node << " is a solution";
+         break;
+
+      case LogEvent::Split:
+         line << "Node " << rec.node << " is split into " << rec.aux << " sub-nodes";
+         break;
+
+      case LogEvent::Insert:
+         line << "Inserts node " << rec.node << " in the space";
+         break;
+
+      case LogEvent::Certify:
+         line << "Certification of node " << rec.node << " -> "
+              << static_cast<Proof>(rec.aux);
+         break;
+
+      default:
+         line << "Unknown event " << rec.event;
+      }
+
+      write(rec, LogEventLevel(event));
+      ++i;
+   }
+}
+
+} // namespace realpaver
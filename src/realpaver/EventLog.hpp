@@ -0,0 +1,216 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   EventLog.hpp
+ * @brief  Asynchronous binary log of events
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#ifndef REALPAVER_EVENT_LOG_HPP
+#define REALPAVER_EVENT_LOG_HPP
+
+#include "realpaver/Logger.hpp"
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace realpaver {
+
+/// Events of the binary log
+enum class LogEvent : uint16_t {
+   Extract = 1, ///< node extracted from the space (aux: depth)
+   Domain,      ///< domain of a variable in a node (aux: variable id)
+   Contract,    ///< contraction of a node (aux: proof)
+   Inner,       ///< node that contains an inner box
+   DepthLimit,  ///< node fathomed due to the depth limit
+   Solution,    ///< solution node
+   Split,       ///< split of a node (aux: number of sub-nodes)
+   Insert,      ///< sub-node inserted in the space
+   Certify      ///< certification of a solution node (aux: proof)
+};
+
+/// Returns the log level of an event
+LogLevel LogEventLevel(LogEvent event);
+
+/**
+ * @brief Record of the binary log.
+ *
+ * The meaning of the field aux depends on the event. The time is the number
+ * of nanoseconds elapsed since the opening of the log. The bounds define an
+ * interval, which is relevant for the Domain events only.
+ */
+struct LogRecord {
+   uint16_t event;  ///< event
+   uint16_t thread; ///< index of the thread in the log
+   uint32_t aux;    ///< auxiliary data
+   int64_t node;    ///< index of a node
+   uint64_t time;   ///< timestamp in nanoseconds
+   double lo;       ///< left bound of an interval
+   double up;       ///< right bound of an interval
+};
+
+/**
+ * @brief Asynchronous binary log of events.
+ *
+ * This is a logging backend that is much faster than the text Logger and
+ * that can be used by several threads. Every thread writes compact records
+ * in its own lock-free ring buffer that is drained by a background thread
+ * into a binary file. A thread waits only if its buffer is full. The binary
+ * file is rendered in the text format of the Logger by the tool
+ * rp_log_decoder.
+ *
+ * The file starts with the magic string "RPEL" and the version of the format.
+ * It is followed by tagged entries, 'R' followed by a record or 'N' followed
+ * by the identifier of a variable, the length of its name and its name.
+ * Numbers are stored in the byte order of the host.
+ *
+ * close() may be called while other threads are recording events. The log
+ * level is set to none, hence the next events are ignored, and close() waits
+ * for the termination of the pending calls of push() before draining and
+ * freeing the buffers.
+ *
+ * The design of this class follows the singleton design pattern.
+ * LOG_EVENT(event, node, aux, lo, up) records an event if its level is enabled,
+ * the last three arguments being optional.
+ */
+class EventLog {
+public:
+   /// Version of the format
+   static const uint32_t VERSION;
+
+   /// Capacity of the buffer of a thread, i.e. number of records
+   static const size_t CAPACITY;
+
+   /// Opens a binary log file given a log level and a filename
+   static void open(LogLevel level, const std::string &path);
+
+   /// Waits for the producers, drains all the buffers and closes the file
+   static void close();
+
+   /// Returns the instance
+   static EventLog *getInstance();
+
+   /// Returns the log level, none if the log is closed
+   LogLevel getLogLevel() const;
+
+   /// Returns the path of the log file
+   std::string getPath() const;
+
+   /// Writes the name of a variable identified by id
+   void defineVar(uint32_t id, const std::string &name);
+
+   /// Records an event in the buffer of the calling thread
+   void push(LogEvent event, int64_t node, uint32_t aux = 0, double lo = 0.0,
+             double up = 0.0);
+
+   /// Returns the number of records written in the file
+   uint64_t nbRecords() const;
+
+private:
+   // single-producer single-consumer ring buffer
+   struct Ring {
+      std::unique_ptr<LogRecord[]> buf; // records
+      std::atomic<uint64_t> head;       // next record written by the producer
+      std::atomic<uint64_t> tail;       // next record read by the consumer
+      uint16_t thread;                  // index of the owner
+   };
+
+   static EventLog instance_;                // the instance
+   std::atomic<int> level_;                  // current log level
+   std::ofstream ofs_;                       // log file
+   std::string path_;                        // path of the log file
+   std::vector<std::unique_ptr<Ring>> ring_; // one buffer per thread
+   std::string names_;                       // pending entries of names
+   std::mutex mtx_;                          // protection of ring_ and names_
+   std::thread drainer_;                     // background thread
+   std::atomic<bool> stop_;                  // true if the drainer stops
+   std::atomic<uint64_t> gen_;               // number of openings
+   std::atomic<int> busy_;                   // number of pending pushes
+   std::atomic<uint64_t> nbrec_;             // number of records written
+   uint64_t start_;                          // time of opening
+
+   EventLog();
+   ~EventLog();
+   EventLog(const EventLog &) = delete;
+   EventLog &operator=(const EventLog &) = delete;
+
+   // returns the buffer of the calling thread
+   Ring *getRing();
+
+   // writes the pending entries in the file, returns true if any
+   bool drain();
+
+   // loop of the background thread
+   void work();
+};
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Reader of binary logs.
+ *
+ * The records are sorted by increasing timestamps, the records of one thread
+ * keeping their order. They can be rendered in the text format of the Logger.
+ */
+class EventLogReader {
+public:
+   /// Constructor
+   EventLogReader() = default;
+
+   /// Reads a binary log, throws an exception in case of failure
+   void read(const std::string &path);
+
+   /// Returns the number of records
+   size_t nbRecords() const;
+
+   /// Returns the i-th record
+   const LogRecord &record(size_t i) const;
+
+   /// Returns the name of a variable given its identifier
+   std::string varName(uint32_t id) const;
+
+   /**
+    * @brief Renders the records in the text format of the Logger.
+    *
+    * The consecutive Domain records of a node are rendered as one box. If
+    * stamps is true then every line starts with the time in seconds and the
+    * index of the thread.
+    */
+   void render(std::ostream &os, std::streamsize prec = 8, bool stamps = false) const;
+
+private:
+   std::vector<LogRecord> rec_;                     // records
+   std::unordered_map<uint32_t, std::string> name_; // names of variables
+};
+
+#if LOG_ON
+#define LOG_EVENT(event, ...)                                                            \
+   if (LogEventLevel(event) <= EventLog::getInstance()->getLogLevel())                   \
+   {                                                                                     \
+      EventLog::getInstance()->push(event, __VA_ARGS__);                                 \
+   }
+#else
+#define LOG_EVENT(event, ...)
+#endif
+
+} // namespace realpaver
+
+#endif
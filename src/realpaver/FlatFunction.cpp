@@ -20,6 +20,8 @@
 
 #include "realpaver/Dag.hpp"
 #include "realpaver/FlatFunction.hpp"
+#include <cmath>
+#include <limits>
 
 namespace realpaver {
 
@@ -95,20 +97,28 @@ std::ostream &operator<<(std::ostream &os, FlatSymbol op)
 
 /*----------------------------------------------------------------------------*/
 
+const size_t FlatFunction::MONOTONIC_NARROW_ITER = 8;
+
 FlatFunction::FlatFunction(const Term &t, const Interval &img)
     : scop_()
     , img_(img)
+    , fast_(false)
+    , nbfast_(0)
+    , nbfproof_(0)
+    , mono_(false)
+    , multi_(false)
+    , osgn_()
+    , vsgn_()
+    , nocc_()
+    , gdom_()
+    , nbmono_(0)
+    , nbsgn_(0)
     , cst_()
     , var_()
 {
    t.makeScope(scop_);
    capa_ = t.nbNodes();
-   symb_ = new FlatSymbol[capa_];
-   arg_ = new size_t *[capa_];
-   ival_ = new Interval[capa_];
-   idv_ = new Interval[capa_];
-   rval_ = new double[capa_];
-   rdv_ = new double[capa_];
+   allocate();
    nb_ = 0;
 
    FlatFunTermCreator creator(this);
@@ -118,25 +128,43 @@ FlatFunction::FlatFunction(const Term &t, const Interval &img)
 FlatFunction::FlatFunction(const DagFun *f)
     : scop_(f->scope())
     , img_(f->getImage())
+    , fast_(false)
+    , nbfast_(0)
+    , nbfproof_(0)
+    , mono_(false)
+    , multi_(false)
+    , osgn_()
+    , vsgn_()
+    , nocc_()
+    , gdom_()
+    , nbmono_(0)
+    , nbsgn_(0)
     , cst_()
     , var_()
 {
    capa_ = 8;
-   symb_ = new FlatSymbol[capa_];
-   arg_ = new size_t *[capa_];
-   ival_ = new Interval[capa_];
-   idv_ = new Interval[capa_];
-   rval_ = new double[capa_];
-   rdv_ = new double[capa_];
+   allocate();
    nb_ = 0;
 
    FlatFunDagCreator creator(this);
    f->rootNode()->acceptVisitor(creator);
 }
 
-FlatFunction::FlatFunction(const DagFun *f, const IntervalBox &B, Variable v)
+FlatFunction::FlatFunction(const DagFun *f, const IntervalBox &B, Variable v,
+                           std::vector<std::pair<size_t, const DagNode *>> *cnodes)
     : scop_()
     , img_(f->getImage())
+    , fast_(false)
+    , nbfast_(0)
+    , nbfproof_(0)
+    , mono_(false)
+    , multi_(false)
+    , osgn_()
+    , vsgn_()
+    , nocc_()
+    , gdom_()
+    , nbmono_(0)
+    , nbsgn_(0)
     , cst_()
     , var_()
 {
@@ -145,16 +173,24 @@ FlatFunction::FlatFunction(const DagFun *f, const IntervalBox &B, Variable v)
    scop_.insert(v);
 
    capa_ = 8;
+   allocate();
+   nb_ = 0;
+
+   FlatFunUniCreator creator(this, B, v, cnodes);
+   f->rootNode()->acceptVisitor(creator);
+}
+
+void FlatFunction::allocate()
+{
    symb_ = new FlatSymbol[capa_];
    arg_ = new size_t *[capa_];
    ival_ = new Interval[capa_];
    idv_ = new Interval[capa_];
    rval_ = new double[capa_];
    rdv_ = new double[capa_];
-   nb_ = 0;
-
-   FlatFunUniCreator creator(this, B, v);
-   f->rootNode()->acceptVisitor(creator);
+   flo_ = new double[capa_];
+   fup_ = new double[capa_];
+   ferr_ = new double[capa_];
 }
 
 void FlatFunction::extendCapacity()
@@ -169,6 +205,9 @@ void FlatFunction::extendCapacity()
       Interval *idv2 = new Interval[capa_];
       double *rval2 = new double[capa_];
       double *rdv2 = new double[capa_];
+      double *flo2 = new double[capa_];
+      double *fup2 = new double[capa_];
+      double *ferr2 = new double[capa_];
 
       // copy of data
       for (size_t i = 0; i < nb_; ++i)
@@ -203,6 +242,9 @@ void FlatFunction::extendCapacity()
       idv_ = idv2;
       rval_ = rval2;
       rdv_ = rdv2;
+      flo_ = flo2;
+      fup_ = fup2;
+      ferr_ = ferr2;
    }
 }
 
@@ -213,6 +255,9 @@ void FlatFunction::destroy()
    delete[] idv_;
    delete[] rval_;
    delete[] rdv_;
+   delete[] flo_;
+   delete[] fup_;
+   delete[] ferr_;
 
    for (size_t i = 0; i < nb_; ++i)
       if (arg_[i] != nullptr)
@@ -239,6 +284,13 @@ size_t FlatFunction::insertCst(const Interval &val)
    return i;
 }
 
+void FlatFunction::setCst(size_t i, const Interval &val)
+{
+   ASSERT(i < nb_ && symb_[i] == FlatSymbol::Cst, "Bad access to a constant node @ " << i);
+
+   cst_[arg_[i][1]] = val;
+}
+
 size_t FlatFunction::insertVar(const Variable &v)
 {
    extendCapacity();
@@ -804,8 +856,268 @@ double FlatFunction::rEval(const RealPoint &pt)
    return rval_[nb_ - 1];
 }
 
+void FlatFunction::setFastEval(bool b)
+{
+   fast_ = b;
+}
+
+bool FlatFunction::isFastEval() const
+{
+   return fast_;
+}
+
+size_t FlatFunction::nbFastEvals() const
+{
+   return nbfast_;
+}
+
+size_t FlatFunction::nbFastProofs() const
+{
+   return nbfproof_;
+}
+
+Interval FlatFunction::fInterval(size_t i) const
+{
+   if (!std::isfinite(ferr_[i]))
+      return Interval::universe();
+
+   return Interval(Double::prevDouble(flo_[i] - ferr_[i]),
+                   Double::nextDouble(fup_[i] + ferr_[i]));
+}
+
+void FlatFunction::fAssign(size_t i, const Interval &x)
+{
+   if (x.isFinite() && !x.isEmpty())
+   {
+      flo_[i] = x.left();
+      fup_[i] = x.right();
+      ferr_[i] = 0.0;
+   }
+   else
+   {
+      flo_[i] = Double::neginf();
+      fup_[i] = Double::inf();
+      ferr_[i] = Double::inf();
+   }
+}
+
+bool FlatFunction::fEval(const IntervalBox &B, Interval &e)
+{
+   // an operation rounded to the nearest or in a directed way returns the
+   // exact result x up to one ulp, i.e. 2^-52*|x| plus the smallest
+   // subnormal number
+   static constexpr double ulp = std::numeric_limits<double>::epsilon();
+   static constexpr double eta = std::numeric_limits<double>::denorm_min();
+
+   bool vec = B.isVectorizable();
+   const IntervalVector &V = static_cast<const IntervalVector &>(B);
+
+   // the error bound of a node encloses the difference between the exact
+   // interval value of this node and its fast value, the error bounds of
+   // the arguments being taken into account as perturbations
+   for (size_t i = 0; i < nb_; ++i)
+   {
+      size_t l = arg_[i][1], r = (arg_[i][0] > 2) ? arg_[i][2] : 0;
+
+      switch (symb_[i])
+      {
+      case FlatSymbol::Cst:
+         fAssign(i, cst_[l]);
+         break;
+
+      case FlatSymbol::Var:
+         fAssign(i, vec ? V[l] : B.get(var_[r]));
+         break;
+
+      case FlatSymbol::Add:
+      case FlatSymbol::AddL:
+      case FlatSymbol::AddR:
+      {
+         flo_[i] = flo_[l] + flo_[r];
+         fup_[i] = fup_[l] + fup_[r];
+         double m = std::max(std::abs(flo_[i]), std::abs(fup_[i]));
+         ferr_[i] = ferr_[l] + ferr_[r] + ulp * m + eta;
+         break;
+      }
+
+      case FlatSymbol::Sub:
+      case FlatSymbol::SubL:
+      case FlatSymbol::SubR:
+      {
+         flo_[i] = flo_[l] - fup_[r];
+         fup_[i] = fup_[l] - flo_[r];
+         double m = std::max(std::abs(flo_[i]), std::abs(fup_[i]));
+         ferr_[i] = ferr_[l] + ferr_[r] + ulp * m + eta;
+         break;
+      }
+
+      case FlatSymbol::Mul:
+      case FlatSymbol::MulL:
+      case FlatSymbol::MulR:
+      {
+         double a = flo_[l] * flo_[r], b = flo_[l] * fup_[r], c = fup_[l] * flo_[r],
+                d = fup_[l] * fup_[r];
+         flo_[i] = std::min(std::min(a, b), std::min(c, d));
+         fup_[i] = std::max(std::max(a, b), std::max(c, d));
+         double ml = std::max(std::abs(flo_[l]), std::abs(fup_[l])),
+                mr = std::max(std::abs(flo_[r]), std::abs(fup_[r])),
+                m = std::max(std::abs(flo_[i]), std::abs(fup_[i]));
+         ferr_[i] = ml * ferr_[r] + mr * ferr_[l] + ferr_[l] * ferr_[r] + ulp * m + eta;
+         break;
+      }
+
+      case FlatSymbol::Min:
+         flo_[i] = std::min(flo_[l], flo_[r]);
+         fup_[i] = std::min(fup_[l], fup_[r]);
+         ferr_[i] = ferr_[l] + ferr_[r];
+         break;
+
+      case FlatSymbol::Max:
+         flo_[i] = std::max(flo_[l], flo_[r]);
+         fup_[i] = std::max(fup_[l], fup_[r]);
+         ferr_[i] = ferr_[l] + ferr_[r];
+         break;
+
+      case FlatSymbol::Usb:
+         flo_[i] = -fup_[l];
+         fup_[i] = -flo_[l];
+         ferr_[i] = ferr_[l];
+         break;
+
+      case FlatSymbol::Abs:
+         if (flo_[l] >= 0.0)
+         {
+            flo_[i] = flo_[l];
+            fup_[i] = fup_[l];
+         }
+         else if (fup_[l] <= 0.0)
+         {
+            flo_[i] = -fup_[l];
+            fup_[i] = -flo_[l];
+         }
+         else
+         {
+            flo_[i] = 0.0;
+            fup_[i] = std::max(-flo_[l], fup_[l]);
+         }
+         ferr_[i] = ferr_[l];
+         break;
+
+      case FlatSymbol::Sqr:
+      {
+         double a = flo_[l] * flo_[l], b = fup_[l] * fup_[l];
+         if (flo_[l] >= 0.0)
+         {
+            flo_[i] = a;
+            fup_[i] = b;
+         }
+         else if (fup_[l] <= 0.0)
+         {
+            flo_[i] = b;
+            fup_[i] = a;
+         }
+         else
+         {
+            flo_[i] = 0.0;
+            fup_[i] = std::max(a, b);
+         }
+         double ml = std::max(std::abs(flo_[l]), std::abs(fup_[l]));
+         ferr_[i] = (2.0 * ml + ferr_[l]) * ferr_[l] + ulp * fup_[i] + eta;
+         break;
+      }
+
+      case FlatSymbol::Div:
+      case FlatSymbol::DivL:
+      case FlatSymbol::DivR:
+         fAssign(i, fInterval(l) / fInterval(r));
+         break;
+
+      case FlatSymbol::Sgn:
+         fAssign(i, sgn(fInterval(l)));
+         break;
+
+      case FlatSymbol::Sqrt:
+         fAssign(i, sqrt(fInterval(l)));
+         break;
+
+      case FlatSymbol::Pow:
+         fAssign(i, pow(fInterval(l), r));
+         break;
+
+      case FlatSymbol::Exp:
+         fAssign(i, exp(fInterval(l)));
+         break;
+
+      case FlatSymbol::Log:
+         fAssign(i, log(fInterval(l)));
+         break;
+
+      case FlatSymbol::Cos:
+         fAssign(i, cos(fInterval(l)));
+         break;
+
+      case FlatSymbol::Sin:
+         fAssign(i, sin(fInterval(l)));
+         break;
+
+      case FlatSymbol::Tan:
+         fAssign(i, tan(fInterval(l)));
+         break;
+
+      case FlatSymbol::Cosh:
+         fAssign(i, cosh(fInterval(l)));
+         break;
+
+      case FlatSymbol::Sinh:
+         fAssign(i, sinh(fInterval(l)));
+         break;
+
+      case FlatSymbol::Tanh:
+         fAssign(i, tanh(fInterval(l)));
+         break;
+      }
+   }
+
+   // an infinite or NaN value results from an overflow or an unbounded
+   // domain, the same holds for the error bounds that are sums and products
+   // of non-negative numbers
+   size_t k = nb_ - 1;
+   if (!(std::isfinite(flo_[k]) && std::isfinite(fup_[k]) && std::isfinite(ferr_[k])))
+      return false;
+
+   // the error bounds are themselves rounded, which is compensated by a
+   // relative increase far larger than the accumulation of these errors
+   ferr_[k] *= 1.0 + 1.0e-6;
+
+   e = fInterval(k);
+   return true;
+}
+
 Proof FlatFunction::hc4Revise(IntervalBox &B)
 {
+   if (fast_)
+   {
+      ++nbfast_;
+      Interval e;
+      if (fEval(B, e))
+      {
+         if (img_.isDisjoint(e))
+         {
+            ++nbfproof_;
+            return Proof::Empty;
+         }
+
+         if (img_.contains(e))
+         {
+            ++nbfproof_;
+            return Proof::Inner;
+         }
+      }
+   }
+
+   if (mono_ && multi_)
+      return hc4ReviseMono(B);
+
    if (B.isVectorizable())
    {
       IntervalVector &V = static_cast<IntervalVector &>(B);
@@ -837,6 +1149,26 @@ Proof FlatFunction::hc4Revise(IntervalBox &B)
 
 Proof FlatFunction::hc4ReviseNeg(IntervalBox &B)
 {
+   if (fast_)
+   {
+      ++nbfast_;
+      Interval e;
+      if (fEval(B, e))
+      {
+         if (img_.contains(e))
+         {
+            ++nbfproof_;
+            return Proof::Empty;
+         }
+
+         if (img_.isDisjoint(e))
+         {
+            ++nbfproof_;
+            return Proof::Inner;
+         }
+      }
+   }
+
    Interval e = iEval(B);
 
    if (e.isEmpty())
@@ -928,6 +1260,354 @@ Proof FlatFunction::hc4ReviseNeg(IntervalBox &B)
    }
 }
 
+void FlatFunction::setMonotonicEval(bool b)
+{
+   mono_ = b;
+
+   // counts the occurrences of the variables
+   nocc_.assign(scop_.size(), 0);
+   for (size_t i = 0; i < nb_; ++i)
+      if (symb_[i] == FlatSymbol::Var)
+         ++nocc_[arg_[i][3]];
+
+   multi_ = false;
+   for (size_t n : nocc_)
+      if (n > 1)
+         multi_ = true;
+
+   osgn_.assign(nb_, 0);
+   vsgn_.assign(scop_.size(), 0);
+   gdom_.clear();
+}
+
+bool FlatFunction::isMonotonicEval() const
+{
+   return mono_;
+}
+
+size_t FlatFunction::nbMonotonicEvals() const
+{
+   return nbmono_;
+}
+
+size_t FlatFunction::nbMonotonicSigns() const
+{
+   return nbsgn_;
+}
+
+void FlatFunction::iEvalOp(size_t i)
+{
+   switch (symb_[i])
+   {
+   case FlatSymbol::Add:
+   case FlatSymbol::AddL:
+   case FlatSymbol::AddR:
+      ival_[i] = ival_[arg_[i][1]] + ival_[arg_[i][2]];
+      break;
+
+   case FlatSymbol::Sub:
+   case FlatSymbol::SubL:
+   case FlatSymbol::SubR:
+      ival_[i] = ival_[arg_[i][1]] - ival_[arg_[i][2]];
+      break;
+
+   case FlatSymbol::Mul:
+   case FlatSymbol::MulL:
+   case FlatSymbol::MulR:
+      ival_[i] = ival_[arg_[i][1]] * ival_[arg_[i][2]];
+      break;
+
+   case FlatSymbol::Div:
+   case FlatSymbol::DivL:
+   case FlatSymbol::DivR:
+      ival_[i] = ival_[arg_[i][1]] / ival_[arg_[i][2]];
+      break;
+
+   case FlatSymbol::Min:
+      ival_[i] = min(ival_[arg_[i][1]], ival_[arg_[i][2]]);
+      break;
+
+   case FlatSymbol::Max:
+      ival_[i] = max(ival_[arg_[i][1]], ival_[arg_[i][2]]);
+      break;
+
+   case FlatSymbol::Usb:
+      ival_[i] = -ival_[arg_[i][1]];
+      break;
+
+   case FlatSymbol::Abs:
+      ival_[i] = abs(ival_[arg_[i][1]]);
+      break;
+
+   case FlatSymbol::Sgn:
+      ival_[i] = sgn(ival_[arg_[i][1]]);
+      break;
+
+   case FlatSymbol::Sqr:
+      ival_[i] = sqr(ival_[arg_[i][1]]);
+      break;
+
+   case FlatSymbol::Sqrt:
+      ival_[i] = sqrt(ival_[arg_[i][1]]);
+      break;
+
+   case FlatSymbol::Pow:
+      ival_[i] = pow(ival_[arg_[i][1]], arg_[i][2]);
+      break;
+
+   case FlatSymbol::Exp:
+      ival_[i] = exp(ival_[arg_[i][1]]);
+      break;
+
+   case FlatSymbol::Log:
+      ival_[i] = log(ival_[arg_[i][1]]);
+      break;
+
+   case FlatSymbol::Cos:
+      ival_[i] = cos(ival_[arg_[i][1]]);
+      break;
+
+   case FlatSymbol::Sin:
+      ival_[i] = sin(ival_[arg_[i][1]]);
+      break;
+
+   case FlatSymbol::Tan:
+      ival_[i] = tan(ival_[arg_[i][1]]);
+      break;
+
+   case FlatSymbol::Cosh:
+      ival_[i] = cosh(ival_[arg_[i][1]]);
+      break;
+
+   case FlatSymbol::Sinh:
+      ival_[i] = sinh(ival_[arg_[i][1]]);
+      break;
+
+   case FlatSymbol::Tanh:
+      ival_[i] = tanh(ival_[arg_[i][1]]);
+      break;
+
+   default:
+      break;
+   }
+}
+
+bool FlatFunction::hasMonotonicSigns(const IntervalBox &B) const
+{
+   if (gdom_.empty())
+      return false;
+
+   for (size_t j = 0; j < scop_.size(); ++j)
+   {
+      Interval x = B.get(scop_.var(j));
+
+      // the signs are valid in every sub-box but they are calculated again
+      // if a domain has been halved, e.g. in a new node of the search tree
+      if (!gdom_[j].contains(x) || x.width() < 0.5 * gdom_[j].width())
+         return false;
+   }
+
+   return true;
+}
+
+void FlatFunction::makeMonotonicSigns(const IntervalBox &B)
+{
+   ++nbsgn_;
+
+   gdom_.clear();
+   osgn_.assign(nb_, 0);
+   vsgn_.assign(scop_.size(), 0);
+
+   Interval e = iEval(B);
+   if (e.isEmpty())
+      return;
+
+   // derivatives with respect to all the occurrences in idv_
+   iDiff();
+
+   std::vector<Interval> G(scop_.size(), Interval::zero());
+
+   for (size_t i = 0; i < nb_; ++i)
+   {
+      if (symb_[i] == FlatSymbol::Var)
+      {
+         Interval d = idv_[i];
+
+         if (d.isPositive())
+            osgn_[i] = 1;
+
+         else if (d.isNegative())
+            osgn_[i] = -1;
+
+         G[arg_[i][3]] += d;
+      }
+   }
+
+   for (size_t j = 0; j < scop_.size(); ++j)
+   {
+      if (G[j].isPositive())
+         vsgn_[j] = 1;
+
+      else if (G[j].isNegative())
+         vsgn_[j] = -1;
+
+      gdom_.push_back(B.get(scop_.var(j)));
+   }
+
+   // the occurrences of a variable with respect to which this is monotonic
+   // are all replaced by the same bound, otherwise they are grouped by sign
+   for (size_t i = 0; i < nb_; ++i)
+      if (symb_[i] == FlatSymbol::Var && vsgn_[arg_[i][3]] != 0)
+         osgn_[i] = vsgn_[arg_[i][3]];
+}
+
+Interval FlatFunction::mEval(const IntervalBox &B, bool up)
+{
+   for (size_t i = 0; i < nb_; ++i)
+   {
+      switch (symb_[i])
+      {
+      case FlatSymbol::Cst:
+         ival_[i] = cst_[arg_[i][1]];
+         break;
+
+      case FlatSymbol::Var:
+      {
+         Interval x = B.get(var_[arg_[i][2]]);
+         int sg = up ? osgn_[i] : -osgn_[i];
+
+         // the function is maximized at the right bound of an increasing
+         // occurrence and at the left bound of a decreasing occurrence
+         if (sg > 0 && !x.isInfRight())
+            ival_[i] = Interval(x.right());
+
+         else if (sg < 0 && !x.isInfLeft())
+            ival_[i] = Interval(x.left());
+
+         else
+            ival_[i] = x;
+         break;
+      }
+
+      default:
+         iEvalOp(i);
+      }
+   }
+
+   return ival_[nb_ - 1];
+}
+
+bool FlatFunction::mEmpty(IntervalBox &B, const Variable &v, const Interval &x, bool up)
+{
+   Interval dom = B.get(v);
+   B.set(v, x);
+   Interval e = mEval(B, up);
+   B.set(v, dom);
+
+   if (e.isEmpty())
+      return false;
+
+   return up ? e.right() < img_.left() : e.left() > img_.right();
+}
+
+Proof FlatFunction::mNarrow(IntervalBox &B, const Variable &v, bool left, bool up)
+{
+   Interval x = B.get(v);
+
+   // nothing to do if the bound is consistent
+   Interval bound = left ? Interval(x.left()) : Interval(x.right());
+   if (!mEmpty(B, v, bound, up))
+      return Proof::Maybe;
+
+   if (mEmpty(B, v, x, up))
+      return Proof::Empty;
+
+   // dichotomic search such that [x.left(), lo] (resp. [hi, x.right()]) has
+   // no solution and [lo, hi] is the search interval
+   double lo = x.left(), hi = x.right();
+
+   for (size_t k = 0; k < MONOTONIC_NARROW_ITER; ++k)
+   {
+      double c = Interval(lo, hi).midpoint();
+      Interval part = left ? Interval(lo, c) : Interval(c, hi);
+
+      if (mEmpty(B, v, part, up))
+      {
+         if (left)
+            lo = c;
+         else
+            hi = c;
+      }
+      else
+      {
+         if (left)
+            hi = c;
+         else
+            lo = c;
+      }
+   }
+
+   B.set(v, left ? Interval(lo, x.right()) : Interval(x.left(), hi));
+   return Proof::Maybe;
+}
+
+Proof FlatFunction::hc4ReviseMono(IntervalBox &B)
+{
+   if (!hasMonotonicSigns(B))
+      makeMonotonicSigns(B);
+
+   ++nbmono_;
+
+   // monotonicity-based evaluation, then natural evaluation that assigns the
+   // values of the nodes for the backward phase
+   Interval lb = mEval(B, false), ub = mEval(B, true);
+   Interval e = iEval(B);
+
+   if (e.isEmpty() || img_.isDisjoint(e))
+      return Proof::Empty;
+
+   if (!lb.isEmpty() && lb.left() > e.left())
+      e.setLeft(lb.left());
+
+   if (!ub.isEmpty() && ub.right() < e.right())
+      e.setRight(ub.right());
+
+   if (e.isEmpty() || img_.isDisjoint(e))
+      return Proof::Empty;
+
+   if (img_.contains(e))
+      return Proof::Inner;
+
+   ival_[nb_ - 1] = e & img_;
+   Proof proof = hc4ReviseBackward(B);
+
+   if (proof == Proof::Empty)
+      return proof;
+
+   // monotonic narrowing of the variables with multiple occurrences, the
+   // left bound of an increasing variable being tested with the upper
+   // bound of the function and its right bound with the lower bound
+   for (size_t j = 0; j < scop_.size(); ++j)
+   {
+      if (nocc_[j] < 2 || vsgn_[j] == 0)
+         continue;
+
+      Variable v = scop_.var(j);
+      if (B.get(v).isInf())
+         continue;
+
+      bool inc = (vsgn_[j] > 0);
+
+      if (!img_.isInfLeft() && mNarrow(B, v, inc, true) == Proof::Empty)
+         return Proof::Empty;
+
+      if (!img_.isInfRight() && mNarrow(B, v, !inc, false) == Proof::Empty)
+         return Proof::Empty;
+   }
+
+   return proof;
+}
+
 Proof FlatFunction::hc4ReviseBackward(IntervalBox &B)
 {
    for (int i = (int)nb_ - 1; i >= 0; --i)
@@ -2175,13 +2855,40 @@ void FlatFunDagCreator::apply(const DagLin *d)
 
 /*----------------------------------------------------------------------------*/
 
-FlatFunUniCreator::FlatFunUniCreator(FlatFunction *f, const IntervalBox &B, Variable v)
+FlatFunUniCreator::FlatFunUniCreator(
+    FlatFunction *f, const IntervalBox &B, Variable v,
+    std::vector<std::pair<size_t, const DagNode *>> *cnodes)
     : f_(f)
     , B_(B)
     , v_(v)
+    , cnodes_(cnodes)
 {
 }
 
+size_t FlatFunUniCreator::insertFixed(DagNode *d)
+{
+   if (d->symbol() == DagSymbol::Cst)
+      return f_->insertCst(static_cast<const DagConst *>(d)->getConst());
+
+   d->iEvalTree(B_);
+   size_t i = f_->insertCst(d->ival());
+
+   if (cnodes_ != nullptr)
+      cnodes_->push_back(std::make_pair(i, d));
+
+   return i;
+}
+
+size_t FlatFunUniCreator::visit(DagNode *d)
+{
+   if (!d->dependsOn(v_))
+      return insertFixed(d);
+
+   FlatFunUniCreator vis(f_, B_, v_, cnodes_);
+   d->acceptVisitor(vis);
+   return vis.idx_;
+}
+
 void FlatFunUniCreator::apply(const DagConst *d)
 {
    idx_ = f_->insertCst(d->getConst());
@@ -2194,193 +2901,49 @@ void FlatFunUniCreator::apply(const DagVar *d)
 
 void FlatFunUniCreator::apply(const DagAdd *d)
 {
-   size_t idxl, idxr;
-
-   if (d->left()->dependsOn(v_))
-   {
-      FlatFunUniCreator vl(f_, B_, v_);
-      d->left()->acceptVisitor(vl);
-      idxl = vl.idx_;
-   }
-   else
-   {
-      d->left()->iEvalTree(B_);
-      idxl = f_->insertCst(d->left()->ival());
-   }
-
-   if (d->right()->dependsOn(v_))
-   {
-      FlatFunUniCreator vr(f_, B_, v_);
-      d->right()->acceptVisitor(vr);
-      idxr = vr.idx_;
-   }
-   else
-   {
-      d->right()->iEvalTree(B_);
-      idxr = f_->insertCst(d->right()->ival());
-   }
+   size_t idxl = visit(d->left()), idxr = visit(d->right());
 
    idx_ = f_->insertBinary(FlatSymbol::Add, idxl, idxr);
 }
 
 void FlatFunUniCreator::apply(const DagSub *d)
 {
-   size_t idxl, idxr;
-
-   if (d->left()->dependsOn(v_))
-   {
-      FlatFunUniCreator vl(f_, B_, v_);
-      d->left()->acceptVisitor(vl);
-      idxl = vl.idx_;
-   }
-   else
-   {
-      d->left()->iEvalTree(B_);
-      idxl = f_->insertCst(d->left()->ival());
-   }
-
-   if (d->right()->dependsOn(v_))
-   {
-      FlatFunUniCreator vr(f_, B_, v_);
-      d->right()->acceptVisitor(vr);
-      idxr = vr.idx_;
-   }
-   else
-   {
-      d->right()->iEvalTree(B_);
-      idxr = f_->insertCst(d->right()->ival());
-   }
+   size_t idxl = visit(d->left()), idxr = visit(d->right());
 
    idx_ = f_->insertBinary(FlatSymbol::Sub, idxl, idxr);
 }
 
 void FlatFunUniCreator::apply(const DagMul *d)
 {
-   size_t idxl, idxr;
-
-   if (d->left()->dependsOn(v_))
-   {
-      FlatFunUniCreator vl(f_, B_, v_);
-      d->left()->acceptVisitor(vl);
-      idxl = vl.idx_;
-   }
-   else
-   {
-      d->left()->iEvalTree(B_);
-      idxl = f_->insertCst(d->left()->ival());
-   }
-
-   if (d->right()->dependsOn(v_))
-   {
-      FlatFunUniCreator vr(f_, B_, v_);
-      d->right()->acceptVisitor(vr);
-      idxr = vr.idx_;
-   }
-   else
-   {
-      d->right()->iEvalTree(B_);
-      idxr = f_->insertCst(d->right()->ival());
-   }
+   size_t idxl = visit(d->left()), idxr = visit(d->right());
 
    idx_ = f_->insertBinary(FlatSymbol::Mul, idxl, idxr);
 }
 
 void FlatFunUniCreator::apply(const DagDiv *d)
 {
-   size_t idxl, idxr;
-
-   if (d->left()->dependsOn(v_))
-   {
-      FlatFunUniCreator vl(f_, B_, v_);
-      d->left()->acceptVisitor(vl);
-      idxl = vl.idx_;
-   }
-   else
-   {
-      d->left()->iEvalTree(B_);
-      idxl = f_->insertCst(d->left()->ival());
-   }
-
-   if (d->right()->dependsOn(v_))
-   {
-      FlatFunUniCreator vr(f_, B_, v_);
-      d->right()->acceptVisitor(vr);
-      idxr = vr.idx_;
-   }
-   else
-   {
-      d->right()->iEvalTree(B_);
-      idxr = f_->insertCst(d->right()->ival());
-   }
+   size_t idxl = visit(d->left()), idxr = visit(d->right());
 
    idx_ = f_->insertBinary(FlatSymbol::Div, idxl, idxr);
 }
 
 void FlatFunUniCreator::apply(const DagMin *d)
 {
-   size_t idxl, idxr;
-
-   if (d->left()->dependsOn(v_))
-   {
-      FlatFunUniCreator vl(f_, B_, v_);
-      d->left()->acceptVisitor(vl);
-      idxl = vl.idx_;
-   }
-   else
-   {
-      d->left()->iEvalTree(B_);
-      idxl = f_->insertCst(d->left()->ival());
-   }
-
-   if (d->right()->dependsOn(v_))
-   {
-      FlatFunUniCreator vr(f_, B_, v_);
-      d->right()->acceptVisitor(vr);
-      idxr = vr.idx_;
-   }
-   else
-   {
-      d->right()->iEvalTree(B_);
-      idxr = f_->insertCst(d->right()->ival());
-   }
+   size_t idxl = visit(d->left()), idxr = visit(d->right());
 
    idx_ = f_->insertBinary(FlatSymbol::Min, idxl, idxr);
 }
 
 void FlatFunUniCreator::apply(const DagMax *d)
 {
-   size_t idxl, idxr;
-
-   if (d->left()->dependsOn(v_))
-   {
-      FlatFunUniCreator vl(f_, B_, v_);
-      d->left()->acceptVisitor(vl);
-      idxl = vl.idx_;
-   }
-   else
-   {
-      d->left()->iEvalTree(B_);
-      idxl = f_->insertCst(d->left()->ival());
-   }
-
-   if (d->right()->dependsOn(v_))
-   {
-      FlatFunUniCreator vr(f_, B_, v_);
-      d->right()->acceptVisitor(vr);
-      idxr = vr.idx_;
-   }
-   else
-   {
-      d->right()->iEvalTree(B_);
-      idxr = f_->insertCst(d->right()->ival());
-   }
+   size_t idxl = visit(d->left()), idxr = visit(d->right());
 
    idx_ = f_->insertBinary(FlatSymbol::Max, idxl, idxr);
 }
 
 void FlatFunUniCreator::apply(const DagUsb *d)
 {
-   FlatFunUniCreator vc(f_, B_, v_);
+   FlatFunUniCreator vc(f_, B_, v_, cnodes_);
    d->child()->acceptVisitor(vc);
 
    idx_ = f_->insertUnary(FlatSymbol::Usb, vc.idx_);
@@ -2388,7 +2951,7 @@ void FlatFunUniCreator::apply(const DagUsb *d)
 
 void FlatFunUniCreator::apply(const DagAbs *d)
 {
-   FlatFunUniCreator vc(f_, B_, v_);
+   FlatFunUniCreator vc(f_, B_, v_, cnodes_);
    d->child()->acceptVisitor(vc);
 
    idx_ = f_->insertUnary(FlatSymbol::Abs, vc.idx_);
@@ -2396,7 +2959,7 @@ void FlatFunUniCreator::apply(const DagAbs *d)
 
 void FlatFunUniCreator::apply(const DagSgn *d)
 {
-   FlatFunUniCreator vc(f_, B_, v_);
+   FlatFunUniCreator vc(f_, B_, v_, cnodes_);
    d->child()->acceptVisitor(vc);
 
    idx_ = f_->insertUnary(FlatSymbol::Sgn, vc.idx_);
@@ -2404,7 +2967,7 @@ void FlatFunUniCreator::apply(const DagSgn *d)
 
 void FlatFunUniCreator::apply(const DagSqr *d)
 {
-   FlatFunUniCreator vc(f_, B_, v_);
+   FlatFunUniCreator vc(f_, B_, v_, cnodes_);
    d->child()->acceptVisitor(vc);
 
    idx_ = f_->insertUnary(FlatSymbol::Sqr, vc.idx_);
@@ -2412,7 +2975,7 @@ void FlatFunUniCreator::apply(const DagSqr *d)
 
 void FlatFunUniCreator::apply(const DagSqrt *d)
 {
-   FlatFunUniCreator vc(f_, B_, v_);
+   FlatFunUniCreator vc(f_, B_, v_, cnodes_);
    d->child()->acceptVisitor(vc);
 
    idx_ = f_->insertUnary(FlatSymbol::Sqrt, vc.idx_);
@@ -2420,7 +2983,7 @@ void FlatFunUniCreator::apply(const DagSqrt *d)
 
 void FlatFunUniCreator::apply(const DagPow *d)
 {
-   FlatFunUniCreator vc(f_, B_, v_);
+   FlatFunUniCreator vc(f_, B_, v_, cnodes_);
    d->child()->acceptVisitor(vc);
 
    idx_ = f_->insertPow(FlatSymbol::Pow, vc.idx_, d->exponent());
@@ -2428,7 +2991,7 @@ void FlatFunUniCreator::apply(const DagPow *d)
 
 void FlatFunUniCreator::apply(const DagExp *d)
 {
-   FlatFunUniCreator vc(f_, B_, v_);
+   FlatFunUniCreator vc(f_, B_, v_, cnodes_);
    d->child()->acceptVisitor(vc);
 
    idx_ = f_->insertUnary(FlatSymbol::Exp, vc.idx_);
@@ -2436,7 +2999,7 @@ void FlatFunUniCreator::apply(const DagExp *d)
 
 void FlatFunUniCreator::apply(const DagLog *d)
 {
-   FlatFunUniCreator vc(f_, B_, v_);
+   FlatFunUniCreator vc(f_, B_, v_, cnodes_);
    d->child()->acceptVisitor(vc);
 
    idx_ = f_->insertUnary(FlatSymbol::Log, vc.idx_);
@@ -2444,7 +3007,7 @@ void FlatFunUniCreator::apply(const DagLog *d)
 
 void FlatFunUniCreator::apply(const DagCos *d)
 {
-   FlatFunUniCreator vc(f_, B_, v_);
+   FlatFunUniCreator vc(f_, B_, v_, cnodes_);
    d->child()->acceptVisitor(vc);
 
    idx_ = f_->insertUnary(FlatSymbol::Cos, vc.idx_);
@@ -2452,7 +3015,7 @@ void FlatFunUniCreator::apply(const DagCos *d)
 
 void FlatFunUniCreator::apply(const DagSin *d)
 {
-   FlatFunUniCreator vc(f_, B_, v_);
+   FlatFunUniCreator vc(f_, B_, v_, cnodes_);
    d->child()->acceptVisitor(vc);
 
    idx_ = f_->insertUnary(FlatSymbol::Sin, vc.idx_);
@@ -2460,7 +3023,7 @@ void FlatFunUniCreator::apply(const DagSin *d)
 
 void FlatFunUniCreator::apply(const DagTan *d)
 {
-   FlatFunUniCreator vc(f_, B_, v_);
+   FlatFunUniCreator vc(f_, B_, v_, cnodes_);
    d->child()->acceptVisitor(vc);
 
    idx_ = f_->insertUnary(FlatSymbol::Tan, vc.idx_);
@@ -2468,7 +3031,7 @@ void FlatFunUniCreator::apply(const DagTan *d)
 
 void FlatFunUniCreator::apply(const DagCosh *d)
 {
-   FlatFunUniCreator vc(f_, B_, v_);
+   FlatFunUniCreator vc(f_, B_, v_, cnodes_);
    d->child()->acceptVisitor(vc);
 
    idx_ = f_->insertUnary(FlatSymbol::Cosh, vc.idx_);
@@ -2476,7 +3039,7 @@ void FlatFunUniCreator::apply(const DagCosh *d)
 
 void FlatFunUniCreator::apply(const DagSinh *d)
 {
-   FlatFunUniCreator vc(f_, B_, v_);
+   FlatFunUniCreator vc(f_, B_, v_, cnodes_);
    d->child()->acceptVisitor(vc);
 
    idx_ = f_->insertUnary(FlatSymbol::Sinh, vc.idx_);
@@ -2484,7 +3047,7 @@ void FlatFunUniCreator::apply(const DagSinh *d)
 
 void FlatFunUniCreator::apply(const DagTanh *d)
 {
-   FlatFunUniCreator vc(f_, B_, v_);
+   FlatFunUniCreator vc(f_, B_, v_, cnodes_);
    d->child()->acceptVisitor(vc);
 
    idx_ = f_->insertUnary(FlatSymbol::Tanh, vc.idx_);
@@ -2519,7 +3082,9 @@ void FlatFunUniCreator::apply(const DagLin *d)
    // creates b*v
    size_t idxm = f_->insertBinary(FlatSymbol::Mul, idxb, idxv);
 
-   if (a.isZero())
+   // the structure must not depend on B, hence a is created if it is not
+   // reduced to a null constant independently of the values in B
+   if (d->nbTerms() == 1 && d->getCst().isZero())
    {
       idx_ = idxm;
    }
@@ -2528,6 +3093,9 @@ void FlatFunUniCreator::apply(const DagLin *d)
       // creates a
       size_t idxa = f_->insertCst(a);
 
+      if (cnodes_ != nullptr)
+         cnodes_->push_back(std::make_pair(idxa, d));
+
       // creates a + b*x
       idx_ = f_->insertBinary(FlatSymbol::Add, idxa, idxm);
    }
@@ -97,6 +97,33 @@ std::ostream &operator<<(std::ostream &os, FlatSymbol op);
  * The symbol AddR means that we have an addition between a left-hand non
  * constant expression and a right-hand constant expression (value 1). The
  * advantage is to save projection operations on constant nodes.
+ *
+ * A fast path can be enabled in hc4Revise. The function is first evaluated
+ * with bounds in floating-point arithmetic without outward rounding, and an
+ * upper bound of the rounding errors is propagated along the nodes. The
+ * result enlarged by this bound encloses the interval evaluation, hence it
+ * can be used to prove that a box is clearly outside or clearly inside the
+ * constraint. The rigorous interval evaluation is performed only when this
+ * test is inconclusive. The nodes that are not arithmetic operations (e.g.
+ * division, elementary functions) are evaluated in interval arithmetic on
+ * the enlarged arguments.
+ *
+ * A monotonicity-based evaluation can also be enabled in hc4Revise for the
+ * functions having multiple occurrences of some variable. The signs of the
+ * derivatives with respect to all the occurrences of the variables are
+ * calculated by interval differentiation. An occurrence such that the
+ * function is increasing (resp. decreasing) with respect to it is replaced
+ * by the right bound (resp. left bound) of its domain to calculate an upper
+ * bound of the function, and conversely for the lower bound. All the
+ * occurrences of a variable are replaced by the same bound if the function
+ * is monotonic with respect to this variable, otherwise the occurrences are
+ * grouped according to their signs. The signs remain valid in every
+ * sub-box, hence they are reused by the successive calls of hc4Revise
+ * during a propagation until the box is no longer included in the box of
+ * their computation or has been halved in some dimension. After the
+ * backward phase, a variable with multiple occurrences such that the
+ * function is monotonic with respect to it is narrowed by a dichotomic
+ * search of its consistent bounds.
  */
 class FlatFunction {
 public:
@@ -111,8 +138,17 @@ public:
     *
     * It represents f where all the variables but v are replaced with their
     * domains in B.
+    *
+    * If cnodes is not null, then it is filled with the pairs (i, d) such
+    * that the constant node of index i in this is obtained from the DAG node
+    * d and B. The structure of this does not depend on B, hence the function
+    * can be adapted to another box by assigning these constants (see setCst).
+    * Given such a pair, if d does not depend on v then the constant is the
+    * interval value of d, otherwise d is a linear expression and the constant
+    * is its constant term plus its linear terms in the other variables.
     */
-   FlatFunction(const DagFun *f, const IntervalBox &B, Variable v);
+   FlatFunction(const DagFun *f, const IntervalBox &B, Variable v,
+                std::vector<std::pair<size_t, const DagNode *>> *cnodes = nullptr);
 
    /// Destructor
    ~FlatFunction();
@@ -135,6 +171,35 @@ public:
    /// Contracts B with respect to the negation of this using hc4Revise
    Proof hc4ReviseNeg(IntervalBox &B);
 
+   /// Enables or disables the fast path of hc4Revise
+   void setFastEval(bool b);
+
+   /// Returns true if the fast path of hc4Revise is enabled
+   bool isFastEval() const;
+
+   /// Returns the number of fast evaluations since the creation of this
+   size_t nbFastEvals() const;
+
+   /// Returns the number of fast evaluations that have been conclusive
+   size_t nbFastProofs() const;
+
+   /**
+    * @brief Enables or disables the monotonicity-based evaluation of hc4Revise.
+    *
+    * It is effective only if some variable has multiple occurrences. This
+    * method must be called after the creation of all the nodes.
+    */
+   void setMonotonicEval(bool b);
+
+   /// Returns true if the monotonicity-based evaluation is enabled
+   bool isMonotonicEval() const;
+
+   /// Returns the number of monotonicity-based evaluations
+   size_t nbMonotonicEvals() const;
+
+   /// Returns the number of calculations of the signs of the derivatives
+   size_t nbMonotonicSigns() const;
+
    /**
     * @brief Interval differentiation method.
     *
@@ -187,6 +252,9 @@ public:
 
    /// Inserts a linear term x*v
    size_t insertLin(const Interval &x, Variable v);
+
+   /// Assigns the value of the constant node of index i
+   void setCst(size_t i, const Interval &val);
    ///@}
 
    /// Returns the scope of this
@@ -216,6 +284,26 @@ private:
    double *rval_; // used for real evaluation
    double *rdv_;  // used for real differentiation
 
+   double *flo_;  // left bounds in the fast evaluation
+   double *fup_;  // right bounds in the fast evaluation
+   double *ferr_; // bounds on the rounding errors in the fast evaluation
+
+   bool fast_;        // true if the fast path is enabled
+   size_t nbfast_;    // number of fast evaluations
+   size_t nbfproof_;  // number of conclusive fast evaluations
+
+   bool mono_;                  // true if the monotonicity is exploited
+   bool multi_;                 // true if some variable has several occurrences
+   std::vector<int> osgn_;      // sign of the derivative of each variable node
+   std::vector<int> vsgn_;      // sign of the derivative of each variable
+   std::vector<size_t> nocc_;   // number of occurrences of each variable
+   std::vector<Interval> gdom_; // domains used to calculate the signs
+   size_t nbmono_;              // number of monotonicity-based evaluations
+   size_t nbsgn_;               // number of calculations of the signs
+
+   // number of bisection steps in the monotonic narrowing of one bound
+   static const size_t MONOTONIC_NARROW_ITER;
+
    std::vector<Interval> cst_; // list of constants
    std::vector<Variable> var_; // list of variables (with multi-occurrences)
 
@@ -243,6 +331,44 @@ private:
 
    // backward phase of real differentiation in reverse mode
    bool rDiff();
+
+   // allocates the arrays of nodes given capa_
+   void allocate();
+
+   // fast evaluation of this on B, returns false if it is inconclusive,
+   // otherwise assigns e to an enclosure of the interval evaluation
+   bool fEval(const IntervalBox &B, Interval &e);
+
+   // interval node for a fast evaluation of an argument node enlarged by
+   // its error bound
+   Interval fInterval(size_t i) const;
+
+   // assigns the bounds of node i from an interval value
+   void fAssign(size_t i, const Interval &x);
+
+   // interval evaluation of the operation node i from its child nodes
+   void iEvalOp(size_t i);
+
+   // returns true if the signs of the derivatives are valid in B and
+   // need not be calculated again
+   bool hasMonotonicSigns(const IntervalBox &B) const;
+
+   // calculates the signs of the derivatives in B
+   void makeMonotonicSigns(const IntervalBox &B);
+
+   // monotonicity-based evaluation of a lower bound (up = false) or an
+   // upper bound (up = true) of this in B
+   Interval mEval(const IntervalBox &B, bool up);
+
+   // returns true if this has no solution in B where v is assigned to x,
+   // using the upper bound (up = true) or the lower bound of this
+   bool mEmpty(IntervalBox &B, const Variable &v, const Interval &x, bool up);
+
+   // narrows one bound of v (left = true for the left bound) in B
+   Proof mNarrow(IntervalBox &B, const Variable &v, bool left, bool up);
+
+   // hc4Revise using the monotonicity
+   Proof hc4ReviseMono(IntervalBox &B);
 };
 
 /// Output on a stream
@@ -335,8 +461,14 @@ private:
  */
 class FlatFunUniCreator : public DagVisitor {
 public:
-   /// Constructor
-   FlatFunUniCreator(FlatFunction *f, const IntervalBox &B, Variable v);
+   /**
+    * @brief Constructor.
+    *
+    * If cnodes is not null, the constant nodes that depend on B are recorded
+    * in it (see the univariate constructor of FlatFunction).
+    */
+   FlatFunUniCreator(FlatFunction *f, const IntervalBox &B, Variable v,
+                     std::vector<std::pair<size_t, const DagNode *>> *cnodes = nullptr);
 
    /// @name Visit methods
    ///@{
@@ -370,6 +502,14 @@ private:
    const IntervalBox &B_; // box used to fix all the variables but one
    Variable v_;           // the variable of the target function
    size_t idx_;           // index of node in f_ resulting from a visit
+   std::vector<std::pair<size_t, const DagNode *>> *cnodes_; // constant nodes
+
+   // inserts the constant node obtained from a sub-dag that does not depend
+   // on v and returns its index
+   size_t insertFixed(DagNode *d);
+
+   // visits a sub-dag and returns the index of the resulting node
+   size_t visit(DagNode *d);
 };
 
 } // namespace realpaver
@@ -28,6 +28,16 @@ namespace realpaver {
 IntervalGaussSeidel::IntervalGaussSeidel()
     : maxiter_(Params::GetIntParam("GAUSS_SEIDEL_ITER_LIMIT"))
     , tol_(Params::GetDblParam("GAUSS_SEIDEL_TOL"))
+    , mid_(0, 0)
+    , lu_(0, 0)
+    , P_(0, 0)
+    , PA_(0, 0)
+    , Pb_(0)
+    , nzr_()
+    , nzc_()
+    , cached_(false)
+    , inv_(false)
+    , nbinv_(0)
 {
 }
 
@@ -54,18 +64,99 @@ void IntervalGaussSeidel::setTol(const double &tol)
    tol_ = tol;
 }
 
+size_t IntervalGaussSeidel::nbInversions() const
+{
+   return nbinv_;
+}
+
+void IntervalGaussSeidel::makeWorkspace(size_t n)
+{
+   mid_ = RealMatrix(n, n);
+   lu_ = RealMatrix(n, n);
+   P_ = RealMatrix(n, n);
+   PA_ = IntervalMatrix(n, n);
+   Pb_ = IntervalVector(n);
+   nzr_.resize(n + 1);
+   nzc_.reserve(n * n);
+   cached_ = false;
+}
+
 Proof IntervalGaussSeidel::contractPrecond(const IntervalMatrix &A, IntervalVector &x,
                                            const IntervalVector &b)
 {
-   int dim = A.ncols();
-   RealMatrix M = A.midpoint();
-   RealMatrix P(dim, dim);
+   ASSERT(A.nrows() == A.ncols() && A.nrows() == b.size(),
+          "Bad interval linear system as input of the Gauss Seidel method");
+
+   size_t n = A.nrows();
+   if (mid_.nrows() != n)
+      makeWorkspace(n);
+
+   // midpoint matrix compared with the one of the previous call and
+   // sparsity pattern of A
+   bool same = cached_;
+   nzc_.clear();
+
+   for (size_t i = 0; i < n; ++i)
+   {
+      nzr_[i] = nzc_.size();
+
+      for (size_t j = 0; j < n; ++j)
+      {
+         Interval a = A(i, j);
+         double m = a.midpoint();
+
+         if (m != mid_(i, j))
+         {
+            same = false;
+            mid_(i, j) = m;
+         }
 
-   bool inv = M.inverse(P);
-   if (!inv)
+         if (!a.isZero())
+            nzc_.push_back(j);
+      }
+   }
+   nzr_[n] = nzc_.size();
+
+   if (!same)
+   {
+      lu_ = mid_;
+      inv_ = lu_.inverse(P_);
+      cached_ = true;
+      ++nbinv_;
+   }
+
+   if (!inv_)
       return Proof::Maybe;
 
-   return contract(P * A, x, P * b);
+   // PA := P*A and Pb := P*b, the nonzero coefficients of the rows of A
+   // being scanned in sequence
+   for (size_t i = 0; i < n; ++i)
+   {
+      for (size_t j = 0; j < n; ++j)
+         PA_(i, j) = Interval::zero();
+
+      Interval z = Interval::zero();
+
+      for (size_t k = 0; k < n; ++k)
+      {
+         double p = P_(i, k);
+         if (p == 0.0)
+            continue;
+
+         Interval ip(p);
+         for (size_t l = nzr_[k]; l < nzr_[k + 1]; ++l)
+         {
+            size_t j = nzc_[l];
+            PA_(i, j) += ip * A(k, j);
+         }
+
+         z += ip * b[k];
+      }
+
+      Pb_[i] = z;
+   }
+
+   return contract(PA_, x, Pb_);
 }
 
 Proof IntervalGaussSeidel::contract(const IntervalMatrix &A, IntervalVector &x,
@@ -23,6 +23,7 @@
 
 #include "realpaver/IntervalMatrix.hpp"
 #include "realpaver/IntervalVector.hpp"
+#include <vector>
 
 namespace realpaver {
 
@@ -44,6 +45,13 @@ namespace realpaver {
  *
  * The improvement factor is given as a tolerance which represents a percentage
  * of reduction of the width of an interval.
+ *
+ * The preconditioned method uses a workspace that is allocated once for a
+ * given dimension and reused in the next calls. The inverse of the midpoint
+ * matrix is kept and it is not calculated again if the midpoint matrix of the
+ * next system is the same, e.g. if the system is linear. The product of
+ * the inverse and the interval matrix only considers the nonzero
+ * coefficients of the latter, which is efficient for sparse Jacobian matrices.
  */
 class IntervalGaussSeidel {
 public:
@@ -83,10 +91,30 @@ public:
    /// Sets the improvement factor
    void setTol(const double &tol);
 
+   /// Returns the number of inversions of midpoint matrices
+   size_t nbInversions() const;
+
 private:
    size_t maxiter_; // maximum number of iterations
    double tol_;     // improvement factor
 
+   // workspace of the preconditioned method
+   RealMatrix mid_;    // midpoint of the last matrix A
+   RealMatrix lu_;     // copy of mid_ modified by the inversion
+   RealMatrix P_;      // inverse of mid_
+   IntervalMatrix PA_; // P * A
+   IntervalVector Pb_; // P * b
+
+   std::vector<size_t> nzr_; // nzc_[nzr_[k]] ... nzc_[nzr_[k+1]-1] are the
+   std::vector<size_t> nzc_; // columns of the nonzero coefficients in the
+                             // k-th row of A
+   bool cached_;       // true if mid_ and inv_ are assigned
+   bool inv_;          // true if mid_ is invertible
+   size_t nbinv_;      // number of inversions
+
+   // allocates the workspace for systems of dimension n
+   void makeWorkspace(size_t n);
+
    // inner step
    // returns 0 if the system is not satisfiable; 1 if the system is satisfiable
    // but x is not improved enough, 2 otherwise
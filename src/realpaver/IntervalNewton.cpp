@@ -57,6 +57,7 @@ IntervalNewton::IntervalNewton(const IntervalNewton &N)
     , gs_(nullptr)
     , maxiter_(N.maxiter_)
     , tol_(N.tol_)
+    , wlim_(N.wlim_)
     , delta_(N.delta_)
     , chi_(N.chi_)
     , cmaxiter_(N.cmaxiter_)
@@ -153,8 +154,8 @@ Proof IntervalNewton::contract(IntervalBox &X)
          continue;
       }
 
-      makeY(X);   // y := X - c
-      b_ = -val_; // b := -F(c)
+      makeY(X); // y := X - c
+      makeB();  // b := -F(c)
 
       // calculates the Hansen's matrix
       F_.diffHansen(X, c_, jac_);
@@ -229,6 +230,13 @@ void IntervalNewton::makeY(IntervalBox &X)
    }
 }
 
+void IntervalNewton::makeB()
+{
+   // b := -F(c)
+   for (size_t i = 0; i < b_.size(); ++i)
+      b_[i] = -val_[i];
+}
+
 void IntervalNewton::makeC(IntervalBox &X)
 {
    for (const auto &v : scope())
@@ -312,8 +320,8 @@ Proof IntervalNewton::certify(IntervalBox &box)
          continue;
       }
 
-      makeY(X);   // y := X - c
-      b_ = -val_; // b := -F(c)
+      makeY(X); // y := X - c
+      makeB();  // b := -F(c)
 
       // calculates the Hansen's matrix
       F_.diffHansen(X, c_, jac_);
@@ -128,6 +128,7 @@ private:
    size_t cmaxiter_; // maximum number of iterations
 
    void makeY(IntervalBox &X);
+   void makeB();
    void makeC(IntervalBox &X);
    Proof reduceX(IntervalBox &X, bool &improved);
    Proof certifyX(IntervalBox &X);
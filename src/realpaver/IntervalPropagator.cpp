@@ -22,7 +22,11 @@
 #include "realpaver/Bitset.hpp"
 #include "realpaver/IntervalPropagator.hpp"
 #include "realpaver/Logger.hpp"
+#include "realpaver/Parallel.hpp"
 #include "realpaver/Param.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <queue>
 
 namespace realpaver {
@@ -32,6 +36,17 @@ IntervalPropagator::IntervalPropagator(SharedContractorPool pool)
     , pool_(pool)
     , tol_(Params::GetDblParam("PROPAGATION_TOL"))
     , certif_()
+    , sch_(PropagationScheduling::FIFO)
+    , stat_()
+    , nbcalls_(0)
+    , nbskipped_(0)
+    , rand_(0)
+    , block_()
+    , nblocks_(0)
+    , comp_()
+    , ncomp_(0)
+    , nbt_(1)
+    , workers_(nullptr)
 {
    if (pool == nullptr)
    {
@@ -39,6 +54,25 @@ IntervalPropagator::IntervalPropagator(SharedContractorPool pool)
    }
 }
 
+IntervalPropagator::IntervalPropagator(const IntervalPropagator &other)
+    : Contractor(other)
+    , pool_(other.pool_)
+    , tol_(other.tol_)
+    , certif_(other.certif_)
+    , sch_(other.sch_)
+    , stat_(other.stat_)
+    , nbcalls_(other.nbcalls_)
+    , nbskipped_(other.nbskipped_)
+    , rand_(other.rand_)
+    , block_(other.block_)
+    , nblocks_(other.nblocks_)
+    , comp_(other.comp_)
+    , ncomp_(other.ncomp_)
+    , nbt_(other.nbt_)
+    , workers_(nullptr)
+{
+}
+
 double IntervalPropagator::getTol() const
 {
    return tol_;
@@ -58,6 +92,8 @@ size_t IntervalPropagator::poolSize() const
 void IntervalPropagator::push(SharedContractor op)
 {
    pool_->push(op);
+   block_.clear();
+   comp_.clear();
 }
 
 Proof IntervalPropagator::proofAt(size_t i) const
@@ -73,6 +109,8 @@ SharedContractorPool IntervalPropagator::getPool() const
 void IntervalPropagator::setPool(SharedContractorPool pool)
 {
    pool_ = pool;
+   block_.clear();
+   comp_.clear();
 }
 
 Scope IntervalPropagator::scope() const
@@ -80,38 +118,270 @@ Scope IntervalPropagator::scope() const
    return pool_->scope();
 }
 
+PropagationScheduling IntervalPropagator::getScheduling() const
+{
+   return sch_;
+}
+
+void IntervalPropagator::setScheduling(PropagationScheduling s)
+{
+   sch_ = s;
+}
+
+size_t IntervalPropagator::nbCalls() const
+{
+   return nbcalls_;
+}
+
+size_t IntervalPropagator::nbSkipped() const
+{
+   return nbskipped_;
+}
+
+size_t IntervalPropagator::nbCallsAt(size_t i) const
+{
+   return (i < stat_.size()) ? stat_[i].nbcalls : 0;
+}
+
+size_t IntervalPropagator::nbReductionsAt(size_t i) const
+{
+   return (i < stat_.size()) ? stat_[i].nbred : 0;
+}
+
+void IntervalPropagator::resetStatistics()
+{
+   stat_.clear();
+   nbcalls_ = nbskipped_ = 0;
+}
+
+size_t IntervalPropagator::getNbThreads() const
+{
+   return nbt_;
+}
+
+void IntervalPropagator::setNbThreads(size_t n)
+{
+   ASSERT(n > 0, "Bad number of threads in a propagator: " << n);
+   nbt_ = n;
+}
+
+double IntervalPropagator::score(size_t i) const
+{
+   // the cost is smoothed in order to avoid divisions by zero
+   return stat_[i].gain / (stat_[i].cost + 1.0e-2);
+}
+
+bool IntervalPropagator::skip(size_t i)
+{
+   // number of consecutive useless calls before skipping
+   static constexpr size_t IDLE = 50;
+
+   if (sch_ != PropagationScheduling::AdaptiveSkip || stat_[i].idle < IDLE)
+      return false;
+
+   // activation with probability IDLE / idle, at least 1%
+   int p = std::max(100, (int)((10000 * IDLE) / stat_[i].idle));
+   return rand_.next(0, 9999) >= p;
+}
+
+void IntervalPropagator::update(size_t i, Proof proof, const IntervalBox &prev,
+                                const IntervalBox &B, double cost)
+{
+   // weight of the last call in the moving averages
+   static constexpr double ALPHA = 0.2;
+
+   Stat &st = stat_[i];
+   double g = 0.0;
+
+   if (proof == Proof::Empty)
+      g = 1.0;
+
+   else
+   {
+      for (const auto &v : pool_->contractorAt(i)->scope())
+      {
+         double wp = prev.get(v).width(), wc = B.get(v).width();
+
+         if (std::isinf(wp))
+         {
+            if (!std::isinf(wc))
+               g = 1.0;
+         }
+         else if (wp > 0.0)
+            g = std::max(g, 1.0 - wc / wp);
+      }
+   }
+
+   if (g > tol_)
+   {
+      ++st.nbred;
+      st.idle = 0;
+   }
+   else
+      ++st.idle;
+
+   if (st.nbcalls == 0)
+   {
+      st.gain = g;
+      st.cost = cost;
+   }
+   else
+   {
+      st.gain = (1.0 - ALPHA) * st.gain + ALPHA * g;
+      st.cost = (1.0 - ALPHA) * st.cost + ALPHA * cost;
+   }
+
+   ++st.nbcalls;
+}
+
 Proof IntervalPropagator::contract(IntervalBox &B)
 {
    ASSERT(pool_ != nullptr, "No pool is assigned in a propagator");
 
-   // initialization: activates all contractors
+   const bool adaptive = (sch_ == PropagationScheduling::Adaptive ||
+                          sch_ == PropagationScheduling::AdaptiveSkip);
    size_t N = pool_->poolSize();
 
-   // propagation queue
-   std::queue<size_t> queue;
-   for (size_t i = 0; i < N; ++i)
-      queue.push(i);
+   // statistics of new contractors, whose score is maximal
+   if (adaptive && stat_.size() != N)
+      stat_.resize(N, Stat{0, 0, 0, 1.0, 0.0});
+
+   // structure of the pool, calculated again if it has changed
+   if (sch_ == PropagationScheduling::Blocks && block_.size() != N)
+      nblocks_ = pool_->makeBlocks(block_);
 
    // vector of proof certificates
    certif_.resize(N);
 
-   Bitset active(N);
-   active.setAllOne();
+   // initialization: activates all contractors
+   std::vector<size_t> init;
+   for (size_t i = 0; i < N; ++i)
+   {
+      if (adaptive && skip(i))
+      {
+         certif_[i] = Proof::Maybe;
+         ++nbskipped_;
+      }
+      else
+         init.push_back(i);
+   }
+
+   if (nbt_ > 1 && Logger::getInstance()->getLogLevel() < LogLevel::inter)
+   {
+      if (comp_.size() != N)
+         ncomp_ = pool_->makeComponents(comp_);
+
+      if (ncomp_ > 1)
+         return propagateComponents(B, init);
+   }
+
+   return propagate(B, init, nbcalls_);
+}
+
+Proof IntervalPropagator::propagate(IntervalBox &B, const std::vector<size_t> &init,
+                                    size_t &nbcalls)
+{
+   using Clock = std::chrono::steady_clock;
+
+   const bool adaptive = (sch_ == PropagationScheduling::Adaptive ||
+                          sch_ == PropagationScheduling::AdaptiveSkip);
+   const bool blocks = (sch_ == PropagationScheduling::Blocks);
+
+   // propagation queue in the FIFO mode
+   std::queue<size_t> queue;
+
+   // in the adaptive modes, the contractors are applied by rounds, the ones
+   // activated during a round being applied in the next round
+   std::priority_queue<std::pair<double, size_t>> pqueue, pnext;
+
+   // in the block mode, one queue per block and bmin is the first block that
+   // may have active contractors
+   std::vector<std::queue<size_t>> bqueue(blocks ? nblocks_ : 0);
+   size_t bmin = nblocks_;
+
+   // number of active contractors
+   size_t nactive = 0;
+
+   Bitset active(pool_->poolSize());
+
+   // activation of the i-th contractor during the round given by next
+   auto activate = [&](size_t i, bool next)
+   {
+      if (adaptive)
+      {
+         if (next)
+            pnext.push(std::make_pair(score(i), i));
+         else
+            pqueue.push(std::make_pair(score(i), i));
+      }
+      else if (blocks)
+      {
+         bqueue[block_[i]].push(i);
+         bmin = std::min(bmin, block_[i]);
+      }
+      else
+         queue.push(i);
+
+      active.setOne(i);
+      ++nactive;
+   };
+
+   // selection of the next contractor
+   auto select = [&]()
+   {
+      size_t i;
+      if (adaptive)
+      {
+         if (pqueue.empty())
+            std::swap(pqueue, pnext);
+
+         i = pqueue.top().second;
+         pqueue.pop();
+      }
+      else if (blocks)
+      {
+         while (bqueue[bmin].empty())
+            ++bmin;
+
+         i = bqueue[bmin].front();
+         bqueue[bmin].pop();
+      }
+      else
+      {
+         i = queue.front();
+         queue.pop();
+      }
+
+      active.setZero(i);
+      --nactive;
+      return i;
+   };
+
+   for (size_t i : init)
+      activate(i, false);
 
    Proof proof = Proof::Maybe;
    IntervalBox copy(B);
 
-   while ((proof != Proof::Empty) && (queue.size() > 0))
+   while ((proof != Proof::Empty) && (nactive > 0))
    {
-      size_t j = queue.front();
-      queue.pop();
+      size_t j = select();
       SharedContractor op = pool_->contractorAt(j);
 
       copy.setOnScope(B, op->scope());
 
-      proof = op->contract(B);
+      if (adaptive)
+      {
+         Clock::time_point t = Clock::now();
+         proof = op->contract(B);
+         double cost = std::chrono::duration<double, std::micro>(Clock::now() - t).count();
+         update(j, proof, copy, B, cost);
+      }
+      else
+         proof = op->contract(B);
+
+      ++nbcalls;
       certif_[j] = proof;
-      active.setZero(j);
 
       if (proof != Proof::Empty)
       {
@@ -132,10 +402,7 @@ Proof IntervalPropagator::contract(IntervalBox &B)
                {
                   size_t l = pool_->depAt(v, k);
                   if (!active.get(l) && (l != j))
-                  {
-                     queue.push(l);
-                     active.setOne(l);
-                  }
+                     activate(l, true);
                }
             }
          }
@@ -144,9 +411,77 @@ Proof IntervalPropagator::contract(IntervalBox &B)
    return proof;
 }
 
+Proof IntervalPropagator::propagateComponents(IntervalBox &B,
+                                              const std::vector<size_t> &init)
+{
+   // minimum number of active contractors per task, below which the
+   // synchronization of the threads costs more than the propagation
+   static constexpr size_t MIN_TASK_SIZE = 32;
+
+   // the components are distributed among the tasks, each task propagating
+   // its components sequentially on its own copy of the box
+   size_t nbt = std::min({nbt_, ncomp_, init.size() / MIN_TASK_SIZE});
+   if (nbt <= 1)
+      return propagate(B, init, nbcalls_);
+
+   if (workers_ == nullptr || workers_->nbWorkers() + 1 != nbt_)
+      workers_ = std::make_unique<WorkerPool>(nbt_ - 1);
+
+   std::vector<std::vector<size_t>> tinit(nbt);
+   for (size_t i : init)
+      tinit[comp_[i] % nbt].push_back(i);
+
+   std::vector<IntervalBox> boxes(nbt, B);
+   std::vector<Proof> proofs(nbt, Proof::Maybe);
+   std::vector<size_t> calls(nbt, 0);
+
+   workers_->run(nbt, [&](size_t t)
+                 { proofs[t] = propagate(boxes[t], tinit[t], calls[t]); });
+
+   Proof proof = Proof::Maybe;
+   for (size_t t = 0; t < nbt; ++t)
+   {
+      nbcalls_ += calls[t];
+      if (proofs[t] == Proof::Empty)
+         proof = Proof::Empty;
+   }
+
+   if (proof != Proof::Empty)
+   {
+      // copies the domains reduced by the contractors of every task
+      for (size_t i = 0; i < pool_->poolSize(); ++i)
+      {
+         SharedContractor op = pool_->contractorAt(i);
+         B.setOnScope(boxes[comp_[i] % nbt], op->scope());
+      }
+   }
+
+   return proof;
+}
+
 void IntervalPropagator::print(std::ostream &os) const
 {
    os << "IntervalPropagator on " << pool_->poolSize() << " contractors";
 }
 
+std::ostream &operator<<(std::ostream &os, PropagationScheduling s)
+{
+   switch (s)
+   {
+   case PropagationScheduling::FIFO:
+      os << "FIFO";
+      break;
+   case PropagationScheduling::Adaptive:
+      os << "ADAPTIVE";
+      break;
+   case PropagationScheduling::AdaptiveSkip:
+      os << "ADAPTIVE_SKIP";
+      break;
+   case PropagationScheduling::Blocks:
+      os << "BLOCKS";
+      break;
+   }
+   return os;
+}
+
 } // namespace realpaver
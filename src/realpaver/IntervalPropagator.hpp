@@ -22,17 +22,72 @@
 #define REALPAVER_INTERVAL_PROPAGATOR_HPP
 
 #include "realpaver/ContractorPool.hpp"
+#include "realpaver/IntRandom.hpp"
+#include "realpaver/Parallel.hpp"
+#include <iostream>
+#include <memory>
 #include <vector>
 
 namespace realpaver {
 
+/// Scheduling strategies of the contractors in a propagator
+enum class PropagationScheduling {
+   FIFO,         ///< first-in first-out queue
+   Adaptive,     ///< rounds ordered by the expected gain per unit cost
+   AdaptiveSkip, ///< adaptive with probabilistic skipping of useless contractors
+   Blocks        ///< blocks of the block-triangular structure in order
+};
+
+/// Output on a stream
+std::ostream &operator<<(std::ostream &os, PropagationScheduling s);
+
+/**
+ * @brief Constraint propagation algorithm over a pool of contractors.
+ *
+ * All the contractors are activated at the beginning of a propagation step.
+ * A contractor is re-activated when the domain of one of its variables is
+ * reduced enough with respect to the tolerance by another contractor.
+ *
+ * In the FIFO mode, the active contractors are stored in a queue.
+ *
+ * In the adaptive modes, this keeps statistics about the contractors from one
+ * call to the next one: the number of calls, the number of calls that reduce
+ * the box, and moving averages of the gain and of the cost. The gain of a call
+ * is the largest relative reduction of the width of a domain in its scope,
+ * 1 if the box is proved empty, and the cost is its computation time. The
+ * contractors are applied by rounds, the ones re-activated during a round being
+ * applied in the next round, and the active contractors of a round are ordered
+ * by their expected gain per unit cost.
+ *
+ * In the skipping mode, a contractor that has not reduced the box for a
+ * number of consecutive calls is activated at the beginning of a propagation
+ * step with a probability that decreases with this number, but it is always
+ * activated when one of its domains is reduced. The filtering power may then
+ * be weaker than in the other modes.
+ *
+ * In the block mode, the contractors are grouped into the blocks of the
+ * block-triangular structure of the pool. An active contractor of the first
+ * block having active contractors is always applied, which propagates every
+ * block to a fixed-point before the next ones. A contractor is re-activated
+ * as usual, even in a previous block.
+ *
+ * Given more than one thread, the connected components of the pool, which
+ * do not share variables, are propagated concurrently on copies of the box.
+ * The contractors of different components must not share a mutable state,
+ * which holds for the contractors created from the functions of a DAG. The
+ * propagation is sequential if the log level is greater than or equal to
+ * LogLevel::inter, or if there are not enough active contractors per thread
+ * to amortize the synchronization. The threads are created once and they
+ * are reused by the next propagations. They are not shared by the copies of
+ * a propagator.
+ */
 class IntervalPropagator : public Contractor {
 public:
    /// Constructor given a pool of contractors
    IntervalPropagator(SharedContractorPool pool = nullptr);
 
-   /// Default copy constructor
-   IntervalPropagator(const IntervalPropagator &) = default;
+   /// Copy constructor, the threads being not copied
+   IntervalPropagator(const IntervalPropagator &other);
 
    /// No assignment
    IntervalPropagator &operator=(const IntervalPropagator &) = delete;
@@ -71,10 +126,74 @@ public:
    /// Gets the proof returned by the i-th contractor of this
    Proof proofAt(size_t i) const;
 
+   /// Returns the scheduling strategy
+   PropagationScheduling getScheduling() const;
+
+   /// Sets the scheduling strategy
+   void setScheduling(PropagationScheduling s);
+
+   /// Returns the number of calls of contractors since the last reset
+   size_t nbCalls() const;
+
+   /// Returns the number of contractors skipped since the last reset
+   size_t nbSkipped() const;
+
+   /// Returns the number of calls of the i-th contractor since the last reset
+   size_t nbCallsAt(size_t i) const;
+
+   /// Returns the number of reductions of the i-th contractor since the last reset
+   size_t nbReductionsAt(size_t i) const;
+
+   /// Resets the statistics of the contractors
+   void resetStatistics();
+
+   /// Returns the number of threads used to propagate the components
+   size_t getNbThreads() const;
+
+   /// Sets the number of threads used to propagate the components
+   void setNbThreads(size_t n);
+
 private:
+   // statistics about one contractor
+   struct Stat {
+      size_t nbcalls; // number of calls
+      size_t nbred;   // number of calls that reduce the box
+      size_t idle;    // number of consecutive calls without reduction
+      double gain;    // moving average of the gain
+      double cost;    // moving average of the cost in microseconds
+   };
+
    SharedContractorPool pool_; // pool of contractors
    double tol_;                // tolerance used for propagation
    std::vector<Proof> certif_; // proof certificates of contractors
+   PropagationScheduling sch_; // scheduling strategy
+   std::vector<Stat> stat_;    // statistics of contractors
+   size_t nbcalls_;            // number of calls of contractors
+   size_t nbskipped_;          // number of contractors skipped
+   IntRandom rand_;            // generator used to skip contractors
+   std::vector<size_t> block_; // block of every contractor
+   size_t nblocks_;            // number of blocks
+   std::vector<size_t> comp_;  // component of every contractor
+   size_t ncomp_;              // number of components
+   size_t nbt_;                // number of threads
+   std::unique_ptr<WorkerPool> workers_; // threads propagating the components
+
+   // returns true if the i-th contractor is skipped at activation time
+   bool skip(size_t i);
+
+   // returns the expected gain per unit cost of the i-th contractor
+   double score(size_t i) const;
+
+   // propagation given the list of contractors initially active, returns
+   // the proof of the last contractor and increments nbcalls
+   Proof propagate(IntervalBox &B, const std::vector<size_t> &init, size_t &nbcalls);
+
+   // concurrent propagation of the components
+   Proof propagateComponents(IntervalBox &B, const std::vector<size_t> &init);
+
+   // updates the statistics of the i-th contractor after a call
+   void update(size_t i, Proof proof, const IntervalBox &prev, const IntervalBox &B,
+               double cost);
 };
 
 } // namespace realpaver
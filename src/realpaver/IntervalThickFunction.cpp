@@ -30,6 +30,8 @@ IntervalThickFunction::IntervalThickFunction(SharedDag dag, size_t i, Variable v
     , flat_(nullptr)
     , B_({v})
     , G_(1)
+    , fix_()
+    , cnodes_()
 {
 }
 
@@ -54,9 +56,47 @@ Interval IntervalThickFunction::diff(const Interval &x)
 
 void IntervalThickFunction::update(const IntervalBox &B)
 {
-   if (flat_ != nullptr)
-      delete flat_;
-   flat_ = new FlatFunction(f_, B, v_);
+   if (flat_ == nullptr)
+   {
+      flat_ = new FlatFunction(f_, B, v_, &cnodes_);
+
+      for (size_t i = 0; i < f_->nbNodes(); ++i)
+      {
+         DagNode *node = f_->node(i);
+         if (!node->dependsOn(v_))
+            fix_.push_back(node);
+      }
+      return;
+   }
+
+   // partial forward evaluation of the sub-dags that do not depend on v_
+   for (DagNode *node : fix_)
+      node->iEvalNode(B);
+
+   // refreshes the constants of the flat function
+   for (const auto &p : cnodes_)
+   {
+      const DagNode *node = p.second;
+
+      if (node->dependsOn(v_))
+         flat_->setCst(p.first, linCst(static_cast<const DagLin *>(node), B));
+      else
+         flat_->setCst(p.first, node->ival());
+   }
+}
+
+Interval IntervalThickFunction::linCst(const DagLin *d, const IntervalBox &B) const
+{
+   Interval a = d->getCst();
+
+   for (auto it = d->begin(); it != d->end(); ++it)
+   {
+      Variable v = d->getNodeSub(it)->getVar();
+      if (v != v_)
+         a += d->getCoefSub(it) * B.get(v);
+   }
+
+   return a;
 }
 
 Variable IntervalThickFunction::getVar() const
@@ -36,6 +36,12 @@ namespace realpaver {
  *
  * The update method must be called first. Then the evaluation and
  * differentiation methods can be called.
+ *
+ * The univariate function is compiled once as a flat function at the first
+ * call of update. Its structure does not depend on the box, the sub-dags that
+ * do not depend on the variable being represented by constant nodes. The
+ * next calls of update only refresh these constants by a forward evaluation
+ * of the sub-dags that do not depend on the variable.
  */
 class IntervalThickFunction : public IntervalFunctionUni {
 public:
@@ -47,8 +53,8 @@ public:
     */
    IntervalThickFunction(SharedDag dag, size_t i, Variable v);
 
-   /// Default copy constructor
-   IntervalThickFunction(const IntervalThickFunction &) = default;
+   /// No copy
+   IntervalThickFunction(const IntervalThickFunction &) = delete;
 
    /// No assignment
    IntervalThickFunction &operator=(const IntervalThickFunction &) = delete;
@@ -57,10 +63,10 @@ public:
    ~IntervalThickFunction();
 
    /**
-    * @brief Creates the univariate function.
+    * @brief Creates or updates the univariate function.
     *
-    * A flat function is created such that the sub-terms that do not depend on
-    * the variable enclosed in this are evaluated once.
+    * The sub-terms that do not depend on the variable enclosed in this are
+    * evaluated once in B.
     */
    void update(const IntervalBox &B);
 
@@ -77,11 +83,19 @@ public:
    DagFun *getFun() const;
 
 private:
-   DagFun *f_;          // function in the dag
-   Variable v_;         // variable of this univariate function
-   FlatFunction *flat_; // flat function
-   IntervalBox B_;      // auxiliary box used to evaluate the function
-   IntervalVector G_;   // auxiliary gradient vector
+   DagFun *f_;                  // function in the dag
+   Variable v_;                 // variable of this univariate function
+   FlatFunction *flat_;         // flat function
+   IntervalBox B_;              // auxiliary box used to evaluate the function
+   IntervalVector G_;           // auxiliary gradient vector
+   std::vector<DagNode *> fix_; // nodes of f_ that do not depend on v_
+                                // sorted from the leaves to the root
+   std::vector<std::pair<size_t, const DagNode *>> cnodes_;
+   // constant nodes of flat_ that depend on the box
+
+   // constant term of a linear expression plus its linear terms
+   // in the variables different from v_
+   Interval linCst(const DagLin *d, const IntervalBox &B) const;
 };
 
 } // namespace realpaver
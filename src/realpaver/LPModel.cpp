@@ -492,6 +492,27 @@ LPModel::~LPModel()
 {
 }
 
+void LPModel::copyModel(const LPModel &model)
+{
+   ASSERT(vars_.empty() && ctrs_.empty(), "A LP model must be empty to be assigned");
+
+   for (const auto &v : model.vars_)
+   {
+      LinVar w = makeVar(v.getLB(), v.getUB(), v.getName());
+      if (v.isInteger())
+         w.setInteger();
+   }
+
+   for (const auto &c : model.ctrs_)
+      addCtr(LinCtr(c.getLB(), c.getExpr(), c.getUB()));
+
+   cost_ = model.cost_;
+   sense_ = model.sense_;
+   maxseconds_ = model.maxseconds_;
+   maxiter_ = model.maxiter_;
+   tol_ = model.tol_;
+}
+
 LinVar LPModel::makeVar(double lb, double ub, const std::string &name)
 {
    int index = vars_.size();
@@ -489,6 +489,15 @@ public:
    /// No assignment
    LPModel &operator=(const LPModel &) = delete;
 
+   /**
+    * @brief Copies a model in this.
+    *
+    * The variables, the constraints, the cost function, the optimization sense
+    * and the parameters of the given model are copied in this, which must be
+    * empty. The constraints share their linear expressions with the given model.
+    */
+   void copyModel(const LPModel &model);
+
    /// Creates a new linear variable in this given two bounds and a name
    LinVar makeVar(double lb, double ub, const std::string &name = "");
 
@@ -18,7 +18,6 @@
  * @date   2025-fev-11
  */
 
-#include "realpaver/AffineCreator.hpp"
 #include "realpaver/AssertDebug.hpp"
 #include "realpaver/Linearizer.hpp"
 #include "realpaver/Param.hpp"
@@ -120,6 +119,9 @@ LinearizerTaylor::LinearizerTaylor(SharedDag dag, bool hansen, CornerStyle style
     , style_(style)
     , corner_(scope().size())
     , gen_()
+    , c_(dag->scope())
+    , fc_(dag->nbFuns())
+    , J_(dag->nbFuns(), dag->nbVars())
 {
    if (seed == 0)
       gen_ = IntRandom();
@@ -134,6 +136,9 @@ LinearizerTaylor::LinearizerTaylor(SharedDag dag, const IndexList &lfun, bool ha
     , style_(style)
     , corner_(scope().size())
     , gen_()
+    , c_(dag->scope())
+    , fc_(dag->nbFuns())
+    , J_(dag->nbFuns(), dag->nbVars())
 {
    if (seed == 0)
       gen_ = IntRandom();
@@ -194,28 +199,32 @@ void LinearizerTaylor::makeVars(LPModel &lpm, const IntervalBox &B)
 
 bool LinearizerTaylor::makeOne(LPModel &lpm, const IntervalBox &B, const Bitset &corner)
 {
-   // makes the corner of the box
-   RealPoint c(scop_);
-   for (const auto &v : scop_)
+   // makes the corner of the box, the variables of the DAG that do not
+   // occur in the linearized functions being fixed at their left bounds
+   for (const auto &v : dag_->scope())
    {
       Interval dom = B.get(v);
-      if (corner.get(scop_.index(v)))
-         c.set(v, dom.right());
+      if (scop_.contains(v) && corner.get(scop_.index(v)))
+         c_.set(v, dom.right());
       else
-         c.set(v, dom.left());
+         c_.set(v, dom.left());
    }
 
    // evaluates the functions at c
-   IntervalVector fc(lfun_.size());
    for (size_t i : lfun_)
    {
       DagFun *f = dag_->fun(i);
-      Interval x = f->iEval(c);
+      Interval x = f->iEval(c_);
       if (x.isEmpty())
          return false;
-      fc.set(i, x);
+      fc_.set(i, x);
    }
 
+   // calculates the Hansen matrix at c, the Jacobian matrix being calculated
+   // once for both corners in makeCtrs
+   if (hansen_)
+      dag_->iDiffHansen(B, c_, J_);
+
    // generates the constraints
    for (size_t i : lfun_)
    {
@@ -226,24 +235,27 @@ bool LinearizerTaylor::makeOne(LPModel &lpm, const IntervalBox &B, const Bitset
       if (img.isSingleton())
          img += Interval(-tol_, tol_);
 
-      // differentiates the function
-      IntervalVector G(f->nbVars());
-      if (hansen_)
-         f->iDiffHansen(B, c, G);
-      else
-         f->iDiff(B, G);
+      // checks the derivatives of the function
+      bool inf = false;
+      for (const auto &v : f->scope())
+      {
+         Interval z = J_.get(i, dag_->scope().index(v));
 
-      if (G.isEmpty())
-         return false;
+         if (z.isEmpty())
+            return false;
+
+         if (z.isInf())
+            inf = true;
+      }
 
-      if (G.isInf())
+      if (inf)
          continue;
 
       // lower bounding constraint of the form lo <= u generated if the right
       // bound of the image of the function is finite
       if (!Double::isInf(img.right()))
       {
-         Interval u = img.right() - fc.get(i);
+         Interval u = img.right() - fc_.get(i);
          LinExpr lo;
 
          for (const auto &v : f->scope())
@@ -251,21 +263,21 @@ bool LinearizerTaylor::makeOne(LPModel &lpm, const IntervalBox &B, const Bitset
             LinVar lv = lpm.getLinVar(linVarIndex(v));
 
             // derivative of f wrt. v
-            Interval z = G[f->scope().index(v)];
+            Interval z = J_.get(i, dag_->scope().index(v));
 
             if (corner.get(scop_.index(v)))
             {
                // right bound used for this variable (bit = 1)
                // => right bound of the derivative
                lo.addTerm(z.right(), lv);
-               u += z.right() * Interval(c.get(v));
+               u += z.right() * Interval(c_.get(v));
             }
             else
             {
                // left bound used for this variable (bit = 0)
                // => left bound of the derivative
                lo.addTerm(z.left(), lv);
-               u += z.left() * Interval(c.get(v));
+               u += z.left() * Interval(c_.get(v));
             }
          }
          lpm.addCtr(lo, u.right());
@@ -275,7 +287,7 @@ bool LinearizerTaylor::makeOne(LPModel &lpm, const IntervalBox &B, const Bitset
       // bound of the image of the function is finite
       if (!Double::isInf(img.left()))
       {
-         Interval l = img.left() - fc.get(i);
+         Interval l = img.left() - fc_.get(i);
 
          LinExpr up;
 
@@ -284,21 +296,21 @@ bool LinearizerTaylor::makeOne(LPModel &lpm, const IntervalBox &B, const Bitset
             LinVar lv = lpm.getLinVar(linVarIndex(v));
 
             // derivative of f wrt. v
-            Interval z = G[f->scope().index(v)];
+            Interval z = J_.get(i, dag_->scope().index(v));
 
             if (corner.get(scop_.index(v)))
             {
                // right bound used for this variable (bit = 1)
                // => left bound of the derivative
                up.addTerm(z.left(), lv);
-               l += z.left() * Interval(c.get(v));
+               l += z.left() * Interval(c_.get(v));
             }
             else
             {
                // left bound used for this variable (bit = 1)
                // => right bound of the derivative
                up.addTerm(z.right(), lv);
-               l += z.right() * Interval(c.get(v));
+               l += z.right() * Interval(c_.get(v));
             }
          }
          lpm.addCtr(l.left(), up);
@@ -312,6 +324,10 @@ bool LinearizerTaylor::makeCtrs(LPModel &lpm, const IntervalBox &B)
    // selects the first corner
    selectCorner(B);
 
+   // calculates the Jacobian matrix which does not depend on the corner
+   if (!hansen_)
+      dag_->iDiff(B, J_);
+
    // generates the constraints for this corner
    bool b = makeOne(lpm, B, corner_);
    if (!b)
@@ -337,26 +353,32 @@ bool LinearizerTaylor::make(LPModel &lpm, const IntervalBox &B)
 
 LinearizerAffine::LinearizerAffine(SharedDag dag, bool minrange)
     : Linearizer(dag)
-    , minrange_(minrange)
+    , creator_(dag, minrange)
 {
+   creator_.useIncremental(true);
 }
 
 LinearizerAffine::LinearizerAffine(SharedDag dag, const IndexList &lfun, bool minrange)
     : Linearizer(dag, lfun)
-    , minrange_(minrange)
+    , creator_(dag, lfun, minrange)
 {
+   creator_.useIncremental(true);
 }
 
 void LinearizerAffine::useMinrange(bool minrange)
 {
-   minrange_ = minrange;
+   creator_.useMinrange(minrange);
+}
+
+void LinearizerAffine::useIncremental(bool incremental)
+{
+   creator_.useIncremental(incremental);
 }
 
 bool LinearizerAffine::make(LPModel &lpm, const IntervalBox &B)
 {
    // creates the affine forms
-   AffineCreator creator(dag_, lfun_, minrange_);
-   creator.create(B);
+   creator_.create(B);
 
    // creates the linear variables for the variables of the DAG
    for (const auto &v : scop_)
@@ -375,7 +397,7 @@ bool LinearizerAffine::make(LPModel &lpm, const IntervalBox &B)
       ev.setName("e!" + v.getName());
 
       // inserts the constraint v = m + r*ev <=> v - r*ev = m
-      const AffineForm &f = creator.fun(v);
+      const AffineForm &f = creator_.fun(v);
       double r = AffineForm::itv(f.cbegin()).left();
       Interval m = f.constantTerm() + Interval(-tol_, tol_);
 
@@ -384,9 +406,9 @@ bool LinearizerAffine::make(LPModel &lpm, const IntervalBox &B)
    }
 
    // inserts the affine forms as constraints in the linear model
-   for (int i = 0; i < creator.nbFuns(); ++i)
+   for (int i = 0; i < creator_.nbFuns(); ++i)
    {
-      const AffineForm &f = creator.fun(i);
+      const AffineForm &f = creator_.fun(i);
 
       if (f.isEmpty())
          return false;
@@ -462,4 +484,244 @@ bool LinearizerAffineTaylor::make(LPModel &lpm, const IntervalBox &B)
    return b;
 }
 
+/*----------------------------------------------------------------------------*/
+
+LinearizerQuadratic::LinearizerQuadratic(SharedDag dag, const std::vector<Term> &terms)
+    : Linearizer(dag)
+    , prod_()
+    , qfun_()
+    , lquad_()
+    , lother_()
+    , taylor_(nullptr)
+{
+   ASSERT(terms.size() == dag->nbFuns(),
+          "Bad number of terms in a linearizer of quadratic functions");
+
+   for (size_t i : lfun_)
+   {
+      TermQuadratic tq;
+      TermQuadraticCreator creator(&tq);
+      terms[i].acceptVisitor(creator);
+
+      if (!creator.visitSuccessfull() ||
+          (tq.squares().empty() && tq.bilins().empty() && tq.lins().empty()))
+      {
+         lother_.push_back(i);
+         continue;
+      }
+
+      QuadFun f;
+      f.index = i;
+      f.cst = tq.getConstant();
+
+      for (const auto &l : tq.lins())
+         f.lin.push_back(std::make_pair(l.coef, l.v));
+
+      for (const auto &q : tq.squares())
+         f.prod.push_back(std::make_pair(q.coef, insertProduct(q.v, q.v)));
+
+      for (const auto &b : tq.bilins())
+         f.prod.push_back(std::make_pair(b.coef, insertProduct(b.v1, b.v2)));
+
+      qfun_.push_back(f);
+      lquad_.push_back(i);
+   }
+}
+
+const Linearizer::IndexList &LinearizerQuadratic::quadraticFuns() const
+{
+   return lquad_;
+}
+
+const Linearizer::IndexList &LinearizerQuadratic::otherFuns() const
+{
+   return lother_;
+}
+
+size_t LinearizerQuadratic::nbProducts() const
+{
+   return prod_.size();
+}
+
+void LinearizerQuadratic::setTaylor(std::unique_ptr<LinearizerTaylor> taylor)
+{
+   taylor_ = std::move(taylor);
+}
+
+size_t LinearizerQuadratic::insertProduct(Variable x, Variable y)
+{
+   for (size_t k = 0; k < prod_.size(); ++k)
+      if (prod_[k].x.id() == x.id() && prod_[k].y.id() == y.id())
+         return k;
+
+   prod_.push_back({x, y});
+   return prod_.size() - 1;
+}
+
+void LinearizerQuadratic::addCtr(LPModel &lpm, const Interval &lo,
+                                 const std::vector<Interval> &a,
+                                 const std::vector<LinVar> &v,
+                                 const std::vector<Interval> &dom, const Interval &up)
+{
+   // lo <= sum_i a_i*v_i <= up
+   // => lo - sum_i (a_i - m_i)*dom_i <= sum_i m_i*v_i <= up - sum_i (a_i - m_i)*dom_i
+   // where m_i is the midpoint of a_i
+   LinExpr e;
+   Interval err(0.0);
+
+   for (size_t i = 0; i < a.size(); ++i)
+   {
+      double m = a[i].midpoint();
+      if (m != 0.0)
+         e.addTerm(m, v[i]);
+      err += (a[i] - m) * dom[i];
+   }
+
+   if (e.getNbTerms() == 0 || err.isInf())
+      return;
+
+   double l = (lo - err).left(), u = (up - err).right();
+   bool linf = Double::isInf(l), uinf = Double::isInf(u);
+
+   if (linf && !uinf)
+      lpm.addCtr(e, u);
+
+   else if (!linf && uinf)
+      lpm.addCtr(l, e);
+
+   else if (!linf && !uinf)
+      lpm.addCtr(l, e, u);
+}
+
+void LinearizerQuadratic::makeEnvelope(LPModel &lpm, const IntervalBox &B, size_t k,
+                                       const LinVar &w)
+{
+   const Product &p = prod_[k];
+   LinVar lx = lpm.getLinVar(linVarIndex(p.x));
+   Interval X = B.get(p.x), W(w.getLB(), w.getUB());
+   Interval one(1.0), inf = Interval::universe();
+
+   if (p.x.id() == p.y.id())
+   {
+      // w = x^2 on [a, b]: tangents at a, b and the midpoint of [a, b]
+      // w >= 2*t*x - t^2 <=> w - 2*t*x >= -t^2
+      std::vector<double> pts;
+      if (!X.isInfLeft())
+         pts.push_back(X.left());
+      if (!X.isInfRight())
+         pts.push_back(X.right());
+      if (X.isFinite() && !X.isSingleton())
+         pts.push_back(X.midpoint());
+
+      for (double t : pts)
+      {
+         Interval T(t);
+         addCtr(lpm, -sqr(T), {one, -2.0 * T}, {w, lx}, {W, X}, inf);
+      }
+
+      // secant: w <= (a+b)*x - a*b <=> w - (a+b)*x <= -a*b
+      if (X.isFinite() && !X.isSingleton())
+      {
+         Interval a(X.left()), b(X.right());
+         addCtr(lpm, -inf, {one, -(a + b)}, {w, lx}, {W, X}, -(a * b));
+      }
+   }
+   else
+   {
+      // McCormick inequalities of w = x*y on [xl, xu] x [yl, yu]
+      LinVar ly = lpm.getLinVar(linVarIndex(p.y));
+      Interval Y = B.get(p.y);
+      Interval xl(X.left()), xu(X.right()), yl(Y.left()), yu(Y.right());
+
+      // (x - xl)*(y - yl) >= 0 => w - yl*x - xl*y >= -xl*yl
+      if (!X.isInfLeft() && !Y.isInfLeft())
+         addCtr(lpm, -(xl * yl), {one, -yl, -xl}, {w, lx, ly}, {W, X, Y}, inf);
+
+      // (xu - x)*(yu - y) >= 0 => w - yu*x - xu*y >= -xu*yu
+      if (!X.isInfRight() && !Y.isInfRight())
+         addCtr(lpm, -(xu * yu), {one, -yu, -xu}, {w, lx, ly}, {W, X, Y}, inf);
+
+      // (xu - x)*(y - yl) >= 0 => w - yl*x - xu*y <= -xu*yl
+      if (!X.isInfRight() && !Y.isInfLeft())
+         addCtr(lpm, -inf, {one, -yl, -xu}, {w, lx, ly}, {W, X, Y}, -(xu * yl));
+
+      // (x - xl)*(yu - y) >= 0 => w - yu*x - xl*y <= -xl*yu
+      if (!X.isInfLeft() && !Y.isInfRight())
+         addCtr(lpm, -inf, {one, -yu, -xl}, {w, lx, ly}, {W, X, Y}, -(xl * yu));
+   }
+}
+
+bool LinearizerQuadratic::make(LPModel &lpm, const IntervalBox &B)
+{
+   // creates the linear variables for the variables of the DAG
+   for (const auto &v : scop_)
+   {
+      Interval val = B.get(v);
+      LinVar lv = lpm.makeVar(val.left(), val.right());
+      lv.setName(v.getName());
+      setLinVarIndex(v.id(), lv.getIndex());
+   }
+
+   // creates the linear variables for the products and their envelopes
+   std::vector<LinVar> w;
+   std::vector<Interval> dw;
+   for (size_t k = 0; k < prod_.size(); ++k)
+   {
+      const Product &p = prod_[k];
+      Interval X = B.get(p.x);
+      Interval z = (p.x.id() == p.y.id()) ? sqr(X) : X * B.get(p.y);
+
+      if (z.isEmpty())
+         return false;
+
+      LinVar lw = lpm.makeVar(z.left(), z.right());
+      lw.setName(p.x.id() == p.y.id() ? "w!" + p.x.getName() + "^2"
+                                       : "w!" + p.x.getName() + "*" + p.y.getName());
+      w.push_back(lw);
+      dw.push_back(z);
+
+      makeEnvelope(lpm, B, k, lw);
+   }
+
+   // inserts the quadratic functions as linear constraints
+   for (const QuadFun &f : qfun_)
+   {
+      Interval img = dag_->fun(f.index)->getImage();
+
+      // transforms an equation into an inequality
+      if (img.isSingleton())
+         img += Interval(-tol_, tol_);
+
+      std::vector<Interval> a, dom;
+      std::vector<LinVar> v;
+
+      for (const auto &l : f.lin)
+      {
+         a.push_back(l.first);
+         v.push_back(lpm.getLinVar(linVarIndex(l.second)));
+         dom.push_back(B.get(l.second));
+      }
+
+      for (const auto &q : f.prod)
+      {
+         a.push_back(q.first);
+         v.push_back(w[q.second]);
+         dom.push_back(dw[q.second]);
+      }
+
+      addCtr(lpm, Interval(img.left()) - f.cst, a, v, dom, Interval(img.right()) - f.cst);
+   }
+
+   // linearizes the other functions
+   if (taylor_ != nullptr)
+   {
+      for (const auto &v : scop_)
+         taylor_->setLinVarIndex(v.id(), linVarIndex(v.id()));
+
+      taylor_->makeCtrs(lpm, B);
+   }
+
+   return true;
+}
+
 } // namespace realpaver
@@ -21,9 +21,13 @@
 #ifndef REALPAVER_LINEARIZER_HPP
 #define REALPAVER_LINEARIZER_HPP
 
+#include "realpaver/AffineCreator.hpp"
 #include "realpaver/Dag.hpp"
 #include "realpaver/IntRandom.hpp"
 #include "realpaver/LPModel.hpp"
+#include "realpaver/TermQuadratic.hpp"
+#include <memory>
+#include <vector>
 
 namespace realpaver {
 
@@ -167,6 +171,9 @@ private:
    CornerStyle style_; // selection method of corners
    Bitset corner_;     // one bit per variable: 0 left bound, 1 right bound
    IntRandom gen_;     // generator of pseudo-random numbers
+   RealPoint c_;       // corner of the box on the scope of the DAG
+   IntervalVector fc_; // values of the functions of the DAG at c_
+   IntervalMatrix J_;  // Jacobian or Hansen matrix of the DAG
 
    // Selects the first corner of B before solving and assigns corner_
    void selectCorner(const IntervalBox &B);
@@ -182,6 +189,10 @@ private:
  *
  * The elementary functions can be approximated by means of the Minrange
  * method or the Chebyshev method.
+ *
+ * The affine forms are kept from one box to the next one in the incremental
+ * mode, which is the default one, and only the affine forms of the nodes
+ * depending on modified domains are recreated (see AffineCreator).
  */
 class LinearizerAffine : public Linearizer {
 public:
@@ -203,10 +214,13 @@ public:
    /// Uses the Minrange approximation (true) or Chebyshev (false)
    void useMinrange(bool minrange = true);
 
+   /// Enables or disables the incremental creation of the affine forms
+   void useIncremental(bool incremental = true);
+
    bool make(LPModel &lpm, const IntervalBox &B) override;
 
 private:
-   bool minrange_; // true: Minrange, false: Chebyshev
+   AffineCreator creator_; // creator of affine forms
 };
 
 /*----------------------------------------------------------------------------*/
@@ -234,6 +248,99 @@ private:
    std::unique_ptr<LinearizerTaylor> taylor_;
 };
 
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Linearizer of quadratic functions.
+ *
+ * The quadratic forms of the functions of the DAG are extracted once at
+ * construction time from the terms that define the functions (see
+ * TermQuadratic). A linear variable is introduced for every square and every
+ * bilinear term, which is shared by all the functions in which it occurs,
+ * hence every quadratic function becomes a linear constraint. The square
+ * and bilinear terms are enclosed in the domains of the variables by linear
+ * inequalities in the style of the reformulation-linearization technique:
+ * - a square x^2 with x in [a, b] is bounded below by the tangents at a, b
+ *   and the midpoint, and bounded above by the secant;
+ * - a product x*y is enclosed by the four McCormick inequalities.
+ *
+ * Only these inequalities and the bounds of the linear variables depend on
+ * the box. The functions that are not quadratic are linearized by a Taylor
+ * linearizer if one is assigned.
+ *
+ * The interval coefficients are rounded safely: each coefficient is replaced
+ * by its midpoint and the rounding error times the domain of the variable is
+ * moved to the bounds of the constraint.
+ */
+class LinearizerQuadratic : public Linearizer {
+public:
+   /**
+    * @brief Creates a linearizer of a DAG.
+    *
+    * terms[i] is the term defining the i-th function of the DAG, whose image
+    * is taken from the DAG.
+    */
+   LinearizerQuadratic(SharedDag dag, const std::vector<Term> &terms);
+
+   /// No copy
+   LinearizerQuadratic(const LinearizerQuadratic &) = delete;
+
+   /// No assignment
+   LinearizerQuadratic &operator=(const LinearizerQuadratic &) = delete;
+
+   /// Default destructor
+   ~LinearizerQuadratic() = default;
+
+   /// Returns the list of indexes of the quadratic functions
+   const IndexList &quadraticFuns() const;
+
+   /// Returns the list of indexes of the functions that are not quadratic
+   const IndexList &otherFuns() const;
+
+   /// Returns the number of square and bilinear terms
+   size_t nbProducts() const;
+
+   /**
+    * @brief Assigns the linearizer of the functions that are not quadratic.
+    *
+    * It must be defined on the list of functions given by otherFuns().
+    */
+   void setTaylor(std::unique_ptr<LinearizerTaylor> taylor);
+
+   bool make(LPModel &lpm, const IntervalBox &B) override;
+
+private:
+   // product x*y, which is a square if x and y are the same variable
+   struct Product {
+      Variable x, y;
+   };
+
+   // quadratic function cst + sum_i a_i*x_i + sum_j b_j*p_j
+   struct QuadFun {
+      size_t index;                                  // index in the DAG
+      Interval cst;                                  // constant term
+      std::vector<std::pair<Interval, Variable>> lin; // linear terms
+      std::vector<std::pair<Interval, size_t>> prod; // terms over products
+   };
+
+   std::vector<Product> prod_;               // square and bilinear terms
+   std::vector<QuadFun> qfun_;               // quadratic functions
+   IndexList lquad_;                         // indexes of quadratic functions
+   IndexList lother_;                        // indexes of the other functions
+   std::unique_ptr<LinearizerTaylor> taylor_; // linearizer of the other functions
+
+   // index of the product x*y in prod_, created if necessary
+   size_t insertProduct(Variable x, Variable y);
+
+   // makes the envelope of a product in the linear model
+   void makeEnvelope(LPModel &lpm, const IntervalBox &B, size_t k, const LinVar &w);
+
+   // adds the constraint lo <= sum_i a_i*v_i <= up where v_i is in dom_i
+   static void addCtr(LPModel &lpm, const Interval &lo, const std::vector<Interval> &a,
+                      const std::vector<LinVar> &v, const std::vector<Interval> &dom,
+                      const Interval &up);
+};
+
 } // namespace realpaver
 
 #endif
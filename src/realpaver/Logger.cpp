@@ -19,6 +19,7 @@
  */
 
 #include "realpaver/Logger.hpp"
+#include <algorithm>
 #include <ctime>
 #include <limits>
 
@@ -32,7 +33,9 @@ Logger::Logger()
     , ofs_()
     , path_("")
     , maxsize_(std::numeric_limits<unsigned long>::max())
+    , size_(0)
     , fprec_(8)
+    , mtx_()
 {
 }
 
@@ -59,9 +62,7 @@ void Logger::setLogLevel(LogLevel level)
 
 unsigned long Logger::getSize() const
 {
-   std::ifstream f(path_, std::ios::in | std::ios::binary);
-   f.seekg(0, std::ios::end);
-   return f.tellg();
+   return size_;
 }
 
 unsigned long Logger::getMaxSize() const
@@ -94,16 +95,22 @@ void Logger::init(LogLevel level, const std::string &path)
    std::time_t now = time(nullptr);
    instance_.ofs_ << "Log file " << REALPAVER_STRING << " @ "
                   << std::asctime(std::localtime(&now)) << std::endl;
+
+   instance_.size_ = instance_.ofs_.tellp();
 }
 
 void Logger::log(LogLevel level, const std::string &msg)
 {
    THROW_IF(!instance_.connected_, "The logger is not connected");
 
-   if (getSize() < getMaxSize())
+   std::lock_guard<std::mutex> lock(mtx_);
+
+   // the size is counted instead of being read from the file system
+   if (size_ < maxsize_)
    {
       std::string s = LogLevelToString(level) + ".";
-      instance_.ofs_ << std::setw(7) << std::left << s << msg << std::endl;
+      ofs_ << std::setw(7) << std::left << s << msg << '\n';
+      size_ += std::max<size_t>(s.size(), 7) + msg.size() + 1;
    }
 }
 
@@ -121,7 +128,9 @@ std::streamsize Logger::setFloatPrecision(std::streamsize n)
 
 void Logger::newline()
 {
-   ofs_ << std::endl;
+   std::lock_guard<std::mutex> lock(mtx_);
+   ofs_ << '\n';
+   ++size_;
 }
 
 std::string LogLevelToString(LogLevel level)
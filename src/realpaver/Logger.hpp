@@ -26,6 +26,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <string>
 
@@ -54,7 +55,9 @@ LogLevel StringToLogLevel(const std::string &s);
  * A logger can write log messages to a log file.
  * The design of this class follows the singleton design pattern.
  *
- * LOG(msg) writes a log.
+ * LOG(msg) writes a log. The messages are formatted by the calling thread
+ * and written under a lock, hence several threads can log messages. The
+ * binary EventLog is a faster backend for the events of the search.
  */
 class Logger {
 public:
@@ -101,7 +104,9 @@ private:
    std::ofstream ofs_;      // log file
    std::string path_;       // path of the log file
    unsigned long maxsize_;  // maximum size of a log file in bytes
+   unsigned long size_;     // number of bytes written
    std::streamsize fprec_;  // float precision (number of digits)
+   std::mutex mtx_;         // protection of the log file
 
    Logger();
    ~Logger();
@@ -0,0 +1,193 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   Parallel.cpp
+ * @brief  Parallel loops over ranges of indexes
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#include "realpaver/Parallel.hpp"
+#include <algorithm>
+
+namespace realpaver {
+
+size_t nbHardwareThreads()
+{
+   unsigned n = std::thread::hardware_concurrency();
+   return (n == 0) ? 1 : n;
+}
+
+void parallelFor(size_t n, size_t nbt, const std::function<void(size_t)> &f)
+{
+   if (nbt <= 1 || n <= 1)
+   {
+      for (size_t i = 0; i < n; ++i)
+         f(i);
+      return;
+   }
+
+   std::atomic<size_t> next(0);
+   std::atomic<bool> stop(false);
+   std::exception_ptr eptr = nullptr;
+   std::mutex mtx;
+
+   auto work = [&]()
+   {
+      size_t i;
+      while (!stop && (i = next++) < n)
+      {
+         try
+         {
+            f(i);
+         }
+         catch (...)
+         {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (eptr == nullptr)
+               eptr = std::current_exception();
+            stop = true;
+         }
+      }
+   };
+
+   std::vector<std::thread> threads;
+   size_t nw = std::min(nbt, n) - 1;
+   for (size_t k = 0; k < nw; ++k)
+      threads.push_back(std::thread(work));
+
+   // the calling thread participates
+   work();
+
+   for (auto &t : threads)
+      t.join();
+
+   if (eptr != nullptr)
+      std::rethrow_exception(eptr);
+}
+
+/*----------------------------------------------------------------------------*/
+
+WorkerPool::WorkerPool(size_t nbw)
+    : threads_()
+    , mtx_()
+    , start_()
+    , done_()
+    , job_(nullptr)
+    , n_(0)
+    , gen_(0)
+    , busy_(0)
+    , stop_(false)
+    , eptr_(nullptr)
+    , next_(0)
+    , abort_(false)
+{
+   for (size_t k = 0; k < nbw; ++k)
+      threads_.push_back(std::thread(&WorkerPool::loop, this));
+}
+
+WorkerPool::~WorkerPool()
+{
+   {
+      std::lock_guard<std::mutex> lock(mtx_);
+      stop_ = true;
+   }
+   start_.notify_all();
+
+   for (auto &t : threads_)
+      t.join();
+}
+
+size_t WorkerPool::nbWorkers() const
+{
+   return threads_.size();
+}
+
+void WorkerPool::run(size_t n, const std::function<void(size_t)> &f)
+{
+   if (threads_.empty() || n <= 1)
+   {
+      for (size_t i = 0; i < n; ++i)
+         f(i);
+      return;
+   }
+
+   {
+      std::lock_guard<std::mutex> lock(mtx_);
+      job_ = &f;
+      n_ = n;
+      next_ = 0;
+      abort_ = false;
+      eptr_ = nullptr;
+      busy_ = threads_.size();
+      ++gen_;
+   }
+   start_.notify_all();
+
+   // the calling thread participates
+   work();
+
+   std::exception_ptr eptr;
+   {
+      std::unique_lock<std::mutex> lock(mtx_);
+      done_.wait(lock, [&]() { return busy_ == 0; });
+      job_ = nullptr;
+      eptr = eptr_;
+   }
+
+   if (eptr != nullptr)
+      std::rethrow_exception(eptr);
+}
+
+void WorkerPool::loop()
+{
+   size_t seen = 0;
+   for (;;)
+   {
+      {
+         std::unique_lock<std::mutex> lock(mtx_);
+         start_.wait(lock, [&]() { return stop_ || gen_ != seen; });
+         if (stop_)
+            return;
+         seen = gen_;
+      }
+
+      work();
+
+      std::lock_guard<std::mutex> lock(mtx_);
+      if (--busy_ == 0)
+         done_.notify_one();
+   }
+}
+
+void WorkerPool::work()
+{
+   size_t i;
+   while (!abort_ && (i = next_++) < n_)
+   {
+      try
+      {
+         (*job_)(i);
+      }
+      catch (...)
+      {
+         std::lock_guard<std::mutex> lock(mtx_);
+         if (eptr_ == nullptr)
+            eptr_ = std::current_exception();
+         abort_ = true;
+      }
+   }
+}
+
+} // namespace realpaver
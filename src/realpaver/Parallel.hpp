@@ -0,0 +1,109 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   Parallel.hpp
+ * @brief  Parallel loops over ranges of indexes
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#ifndef REALPAVER_PARALLEL_HPP
+#define REALPAVER_PARALLEL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace realpaver {
+
+/// Returns the number of threads supported by the machine (at least 1)
+size_t nbHardwareThreads();
+
+/**
+ * @brief Applies a function to every index of a range using several threads.
+ *
+ * f(i) is called once for every i in 0 .. n-1. The indexes are dispatched
+ * dynamically to nbt threads including the calling thread, hence the order
+ * of the calls is not specified. The loop is sequential if nbt <= 1 or n <= 1.
+ *
+ * f must not modify a data structure shared with another call. In particular,
+ * it must not log messages.
+ *
+ * If a call throws an exception then the remaining indexes are not processed
+ * and the first exception is rethrown by this function once all the threads
+ * have terminated.
+ */
+void parallelFor(size_t n, size_t nbt, const std::function<void(size_t)> &f);
+
+/**
+ * @brief Persistent threads applying a function to a range of indexes.
+ *
+ * The worker threads are created once by the constructor and they wait for
+ * jobs until the destruction of this, which avoids creating threads at each
+ * parallel loop when the loops are short and frequent, e.g. in a propagation
+ * step.
+ *
+ * run(n, f) has the same semantics as parallelFor(n, nbWorkers() + 1, f). The
+ * calling thread participates. Two jobs must not be run concurrently by the
+ * same pool.
+ */
+class WorkerPool {
+public:
+   /// Creates a pool having nbw worker threads
+   WorkerPool(size_t nbw);
+
+   /// No copy
+   WorkerPool(const WorkerPool &) = delete;
+
+   /// No assignment
+   WorkerPool &operator=(const WorkerPool &) = delete;
+
+   /// Destructor, which waits for the termination of the workers
+   ~WorkerPool();
+
+   /// Returns the number of worker threads
+   size_t nbWorkers() const;
+
+   /// Calls f(i) for every i in 0 .. n-1
+   void run(size_t n, const std::function<void(size_t)> &f);
+
+private:
+   std::vector<std::thread> threads_;       // worker threads
+   std::mutex mtx_;                         // protects the fields below
+   std::condition_variable start_;          // signals a new job or the end
+   std::condition_variable done_;           // signals the end of a job
+   const std::function<void(size_t)> *job_; // current job
+   size_t n_;                               // size of the current job
+   size_t gen_;                             // number of jobs submitted
+   size_t busy_;                            // workers in the current job
+   bool stop_;                              // true if the workers must stop
+   std::exception_ptr eptr_;                // first exception of a job
+   std::atomic<size_t> next_;               // next index to be processed
+   std::atomic<bool> abort_;                // true if a call has thrown
+
+   // loop of a worker thread
+   void loop();
+
+   // processes the indexes of the current job
+   void work();
+};
+
+} // namespace realpaver
+
+#endif
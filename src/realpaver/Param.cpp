@@ -964,6 +964,20 @@ void Params::makeGeneral()
        .setMaxValue(16);
    add(float_prec);
 
+   ////////////////////
+   ParamInt nb_threads;
+   str = std::string("Number of threads used by the parallel stages of the solving ") +
+         "process, e.g. the rewriting of the constraints at preprocessing time, " +
+         "the propagation of independent components in HC4 and BC4 and the " +
+         "certification of the solutions";
+   nb_threads.setName("NB_THREADS")
+       .setCat(cat)
+       .setWhat(str)
+       .setValue(1)
+       .setMinValue(1)
+       .setMaxValue(1024);
+   add(nb_threads);
+
    ////////////////////
    ParamStr trace;
    trace.setName("TRACE")
@@ -983,6 +997,20 @@ void Params::makeGeneral()
        .setMinValue(1.0);
    add(trace_f);
 
+   ////////////////////
+   ParamStr log_format;
+   str = std::string("binary file of the events of the search written ") +
+         "asynchronously, which can be rendered as text by rp_log_decoder, " +
+         "the messages of the main level being written in the text file and " +
+         "the other messages that are not events of the search being lost";
+   log_format.setName("LOG_FORMAT")
+       .setCat(cat)
+       .setWhat("Format of the log file")
+       .addChoice("TEXT", "text file of messages")
+       .addChoice("BINARY", str)
+       .setValue("TEXT");
+   add(log_format);
+
    ////////////////////
    ParamStr log_level;
    log_level.setName("LOG_LEVEL")
@@ -1006,12 +1034,42 @@ void Params::makeGeneral()
        .setValue("YES");
    add(prepro);
 
+   ////////////////////
+   ParamStr search_trace;
+   str = std::string("binary file of the nodes of the search tree and of the ") +
+         "effect of the propagators, which can be summarized by rp_trace_summary";
+   search_trace.setName("SEARCH_TRACE")
+       .setCat(cat)
+       .setWhat("Trace of the search tree written by rp_solver")
+       .addChoice("YES", str)
+       .addChoice("NO", "no trace")
+       .setValue("NO");
+   add(search_trace);
+
+   ////////////////////
+   ParamStr sol_format;
+   str = std::string("binary file of fixed-size records containing the proof ") +
+         "certificates and the bounds of the solutions, which can be loaded by " +
+         "the class SolutionReader";
+   sol_format.setName("SOLUTION_FORMAT")
+       .setCat(cat)
+       .setWhat("Format of the solutions written by rp_solver")
+       .addChoice("TEXT", "solutions written in the text output file")
+       .addChoice("BINARY", str)
+       .addChoice("CSV", "CSV file with one line per solution")
+       .setValue("TEXT");
+   add(sol_format);
+
    ////////////////////
    ParamStr postpro;
+   std::string eager = std::string("certifies the solution nodes in background ") +
+                       "threads during the search if there is no clustering " +
+                       "(SOLUTION_CLUSTER_GAP < 0), and as YES otherwise";
    postpro.setName("CERTIFICATION")
        .setCat(cat)
        .setWhat("Postprocessing of solution nodes")
        .addChoice("YES", "handles clusters and provides certificate of proofs")
+       .addChoice("EAGER", eager)
        .addChoice("NO", "no certification")
        .setValue("YES");
    add(postpro);
@@ -1121,6 +1179,38 @@ void Params::makeBranch()
        .setValue("DFS")
        .setText(text);
    add(node_sel);
+   ////////////////////
+   ParamStr decomp;
+   str = std::string("Decomposition of the problem resulting from preprocessing ") +
+         "into independent sub-problems that are solved separately, the solutions " +
+         "being the elements of the Cartesian product of the solution sets of the " +
+         "sub-problems";
+   std::string product = std::string("the solutions of every sub-problem are written ") +
+                         "in the solution file, a binary or CSV file of solutions " +
+                         "receiving the elements of the product as in EXPANDED";
+   std::string expanded = std::string("the elements of the product are written in the ") +
+                          "solution file, at most SOLUTION_LIMIT of them";
+   decomp.setName("BP_DECOMPOSITION")
+       .setCat(cat)
+       .setWhat(str)
+       .addChoice("NO", "no decomposition")
+       .addChoice("PRODUCT", product)
+       .addChoice("EXPANDED", expanded)
+       .setValue("NO");
+   add(decomp);
+
+   ////////////////////
+   ParamStr trail;
+   str = std::string("Trail-based storage of domains in the DFS strategy of ") +
+         "branch-and-prune algorithms: the sub-nodes only store the domain of the " +
+         "split variable and the modified domains are restored on backtrack";
+   trail.setName("BP_DOMAIN_TRAIL")
+       .setCat(cat)
+       .setWhat(str)
+       .addChoice("YES", "trail-based storage")
+       .addChoice("NO", "each node stores a copy of the domains")
+       .setValue("NO");
+   add(trail);
 }
 
 void Params::makeSplit()
@@ -1176,9 +1266,26 @@ void Params::makeSplit()
        .setCat(cat)
        .setWhat("Domain splitting strategy")
        .addChoice("BI", "divides a domain in two parts")
+       .addChoice("KWAY", "divides a domain in SPLIT_ARITY parts")
+       .addChoice("ADAPTIVE", "divides a domain in 2 up to SPLIT_ARITY parts")
        .setValue("BI");
    add(split_sl);
 
+   ////////////////////
+   ParamInt split_arity;
+   str = std::string("Number of parts of a domain divided by the KWAY slicing ") +
+         "strategy, or maximum number of parts for the ADAPTIVE strategy. " +
+         "The ADAPTIVE strategy depends on the share of the selected variable " +
+         "in the smear sum rel values, hence it requires SPLIT_SELECTION = SSR, " +
+         "otherwise domains are bisected.";
+   split_arity.setName("SPLIT_ARITY")
+       .setCat(cat)
+       .setWhat(str)
+       .setValue(3)
+       .setMinValue(2)
+       .setMaxValue(16);
+   add(split_arity);
+
    ////////////////////
    ParamDbl split_point;
    str = std::string("An interval [a, b] is split in two parts at a+sip*(b-a) ") +
@@ -1222,6 +1329,68 @@ void Params::makeContract()
        .setMaxValue(1.0);
    add(propag_tol);
 
+   ////////////////////
+   ParamStr affine_inc;
+   str = std::string("Incremental creation of the affine forms in the AFFINE ") +
+         "contractor and the affine relaxations: the affine forms of the nodes " +
+         "of the DAG are kept from one box to the next one and only the nodes " +
+         "depending on modified domains are recreated";
+   affine_inc.setName("AFFINE_INCREMENTAL")
+       .setCat(cat)
+       .setWhat(str)
+       .addChoice("YES", "incremental creation")
+       .addChoice("NO", "creation from scratch for each box")
+       .setValue("YES");
+   add(affine_inc);
+
+   ////////////////////
+   ParamStr hc4_fast;
+   str = std::string("Fast path of the HC4Revise contractors: the functions are ") +
+         "first evaluated in floating-point arithmetic with a bound on the " +
+         "rounding errors in order to detect the boxes that are clearly outside " +
+         "or inside the constraints, and the interval evaluation is performed " +
+         "only if this test is inconclusive";
+   hc4_fast.setName("HC4_FAST_EVAL")
+       .setCat(cat)
+       .setWhat(str)
+       .addChoice("YES", "fast evaluation before the interval evaluation")
+       .addChoice("NO", "interval evaluation only")
+       .setValue("NO");
+   add(hc4_fast);
+
+   ////////////////////
+   ParamStr hc4_mono;
+   str = std::string("Monotonicity-based evaluation in the HC4Revise contractors ") +
+         "of the functions with multiple occurrences of some variable: the " +
+         "occurrences are grouped according to the signs of the derivatives, " +
+         "the monotonic occurrences are replaced by the bounds of their domains " +
+         "and the variables with respect to which the functions are monotonic " +
+         "are narrowed";
+   hc4_mono.setName("HC4_MONOTONIC_EVAL")
+       .setCat(cat)
+       .setWhat(str)
+       .addChoice("YES", "monotonicity-based evaluation and narrowing")
+       .addChoice("NO", "natural interval evaluation only")
+       .setValue("NO");
+   add(hc4_mono);
+
+   ////////////////////
+   ParamStr propag_sch;
+   std::string skip = std::string("adaptive strategy such that the contractors ") +
+                      "that do not reduce the box for many calls may be skipped";
+   str = std::string("Scheduling of the contractors in the propagation algorithms ") +
+         "of HC4, BC4 and AFFINE. The adaptive strategies learn the gain and the " +
+         "cost of the contractors during the search.";
+   propag_sch.setName("PROPAGATION_SCHEDULING")
+       .setCat(cat)
+       .setWhat(str)
+       .addChoice("FIFO", "first-in first-out queue")
+       .addChoice("ADAPTIVE", "rounds ordered by the expected gain per unit cost")
+       .addChoice("ADAPTIVE_SKIP", skip)
+       .addChoice("BLOCKS", "blocks of the block-triangular structure in order")
+       .setValue("FIFO");
+   add(propag_sch);
+
    ////////////////////
    ParamDbl bc3_peel;
    str = std::string("Peel factor for the BC3 contractor\nGiven an interval ") +
@@ -1247,8 +1416,26 @@ void Params::makeContract()
        .setMinValue(1);
    add(bc3_iter);
 
+   ////////////////////
+   ParamInt poly_bern;
+   str = std::string("Maximum number of Bernstein coefficients of a polynomial ") +
+         "constraint in the POLYNOMIAL propagation strategy: when its Horner " +
+         "form does not permit to conclude, the range of the polynomial is " +
+         "enclosed by its Bernstein form if the product of the degrees plus " +
+         "one of its variables does not exceed this number, the value 0 " +
+         "disabling the Bernstein form";
+   poly_bern.setName("POLYNOMIAL_BERNSTEIN_LIMIT")
+       .setCat(cat)
+       .setWhat(str)
+       .setValue(0)
+       .setMinValue(0);
+   add(poly_bern);
+
    ////////////////////
    ParamStr propag_base;
+   std::string polynomial = std::string("HC4 contractor combined with contractors ") +
+                            "of the polynomial constraints based on their Horner " +
+                            "and Bernstein forms";
    str = std::string("Propagation strategy: the default one is a classical ") +
          "propagation algorithm that uses one contractor per constraint";
    propag_base.setName("PROPAGATION_BASE")
@@ -1256,6 +1443,7 @@ void Params::makeContract()
        .setWhat(str)
        .addChoice("HC4", "HC4 contractor")
        .addChoice("BC4", "BC4 contractor")
+       .addChoice("POLYNOMIAL", polynomial)
        .addChoice("AFFINE", "contractor based on affine forms")
        .setValue("HC4");
    add(propag_base);
@@ -1322,12 +1510,16 @@ void Params::makePolytope()
 
    ////////////////////
    ParamStr relax;
+   str = std::string("use of McCormick relaxations of the square and bilinear ") +
+         "terms of the quadratic functions and Taylor (mean value) forms for the " +
+         "other functions";
    relax.setName("POLYTOPE_HULL_RELAXATION")
        .setCat(cat)
        .setWhat("Relaxation method for the polytope hull contractor")
        .addChoice("AFFINE", "use of affine forms")
        .addChoice("TAYLOR", "use of Taylor (mean value) forms")
        .addChoice("AFFINE_TAYLOR", "use of affine and Taylor (mean value) forms")
+       .addChoice("QUADRATIC", str)
        .setValue("AFFINE");
    add(relax);
 
@@ -1397,6 +1589,18 @@ void Params::makePolytope()
        .addChoice("CHEBYSHEV", "Chebyshev approximation")
        .setValue("CHEBYSHEV");
    add(approx);
+
+   ////////////////////
+   ParamInt threads;
+   str = std::string("Number of threads solving the LPs of the polytope hull ") +
+         "contractor concurrently on copies of the linear relaxation";
+   threads.setName("POLYTOPE_HULL_THREADS")
+       .setCat(cat)
+       .setWhat(str)
+       .setValue(1)
+       .setMinValue(1)
+       .setMaxValue(1024);
+   add(threads);
 }
 
 void Params::makeAcid()
@@ -32,6 +32,7 @@ extern void realpaver_flex_cleanup_file(void);
 extern void realpaver_flex_cleanup_str(void);
 extern int realpaver_bison_parse(void);
 extern std::string realpaver_parse_error;
+extern size_t realpaver_bison_nbytes;
 
 /*----------------------------------------------------------------------------*/
 
@@ -48,11 +49,16 @@ static std::vector<std::string> keywords = {
 Parser::Parser()
     : symtab_()
     , params_()
+    , timer_()
+    , nbytes_(0)
 {
 }
 
 Parser::Parser(const Params &params)
-    : params_(params)
+    : symtab_()
+    , params_(params)
+    , timer_()
+    , nbytes_(0)
 {
 }
 
@@ -73,12 +79,31 @@ std::string Parser::getParseError() const
    return realpaver_parse_error;
 }
 
+double Parser::getParseTime() const
+{
+   return timer_.elapsedTime();
+}
+
+size_t Parser::getInputSize() const
+{
+   return nbytes_;
+}
+
+double Parser::getThroughput() const
+{
+   double t = timer_.elapsedTime();
+   return (t > 0.0) ? (nbytes_ / 1.0e6) / t : 0.0;
+}
+
 bool Parser::parseFile(const std::string &filename, Problem &problem)
 {
+   timer_.reset();
+   timer_.start();
    initSymbolTable();
 
    // initializes the lexical analyzer
    int res = realpaver_flex_init_file(&problem, &symtab_, &params_, filename.c_str());
+   nbytes_ = realpaver_bison_nbytes;
 
    // parses the input file
    if (res == 0)
@@ -89,16 +114,20 @@ bool Parser::parseFile(const std::string &filename, Problem &problem)
 
    realpaver_flex_cleanup_file();
    symtab_.clear();
+   timer_.stop();
 
    return res == 0;
 }
 
 bool Parser::parseStr(const std::string &realpaver_str, Problem &problem)
 {
+   timer_.reset();
+   timer_.start();
    initSymbolTable();
 
    // initializes the lexical analyzer
    realpaver_flex_init_str(&problem, &symtab_, &params_, realpaver_str.c_str());
+   nbytes_ = realpaver_bison_nbytes;
 
    // parses the input file
    int res = realpaver_bison_parse();
@@ -108,6 +137,7 @@ bool Parser::parseStr(const std::string &realpaver_str, Problem &problem)
 
    realpaver_flex_cleanup_str();
    symtab_.clear();
+   timer_.stop();
 
    return res == 0;
 }
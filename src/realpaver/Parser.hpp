@@ -24,10 +24,21 @@
 #include "realpaver/Param.hpp"
 #include "realpaver/Problem.hpp"
 #include "realpaver/SymbolTable.hpp"
+#include "realpaver/Timer.hpp"
 
 namespace realpaver {
 
-/// Wrapper for the parser of the modelling language
+/**
+ * @brief Wrapper for the parser of the modelling language.
+ *
+ * On POSIX systems a regular input file is mapped in memory and scanned in
+ * place, which avoids the copies of a stream-based reading. The grammar is
+ * left-recursive on the lists of definitions, hence the parser stack does not
+ * grow with the size of the model.
+ *
+ * The parsing time and the size of the input are recorded so that the parse
+ * throughput can be reported.
+ */
 class Parser {
 public:
    /// Constructor
@@ -57,9 +68,20 @@ public:
    /// Returns the parse error in case of failure
    std::string getParseError() const;
 
+   /// Returns the time spent in the last parsing in seconds
+   double getParseTime() const;
+
+   /// Returns the number of bytes of the last parsed input
+   size_t getInputSize() const;
+
+   /// Returns the throughput of the last parsing in MB/s
+   double getThroughput() const;
+
 private:
    SymbolTable symtab_; // table of symbols
    Params params_;      // parameters
+   Timer timer_;        // parsing time
+   size_t nbytes_;      // size of the input
 
    void initSymbolTable();
 };
@@ -0,0 +1,592 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   Polynomial.cpp
+ * @brief  Sparse multivariate polynomials with Horner and Bernstein forms
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#include "realpaver/AssertDebug.hpp"
+#include "realpaver/Polynomial.hpp"
+#include <limits>
+
+namespace realpaver {
+
+const size_t Polynomial::MAX_MONOMIALS = 10000;
+
+Polynomial::Polynomial(const DagFun *f)
+    : scop_(f->scope())
+    , var_()
+    , coef_()
+    , expo_()
+    , deg_()
+    , prog_()
+    , uni_()
+    , stack_()
+    , bsize_(0)
+    , bstride_()
+    , bpos_()
+    , bratio_()
+    , tensor_()
+    , aux_()
+{
+   for (const auto &v : scop_)
+      var_.push_back(v);
+
+   PolynomialCreator creator(scop_);
+   f->rootNode()->acceptVisitor(creator);
+
+   // table of monomials sorted by the lexicographic ordering of the exponents
+   size_t k = var_.size();
+   deg_.resize(k, 0);
+   for (const auto &m : creator.expansion())
+   {
+      coef_.push_back(m.second);
+      for (size_t i = 0; i < k; ++i)
+      {
+         expo_.push_back(m.first[i]);
+         deg_[i] = std::max(deg_[i], m.first[i]);
+      }
+   }
+
+   // null polynomial
+   if (coef_.empty())
+   {
+      coef_.push_back(Interval::zero());
+      expo_.resize(k, 0);
+   }
+
+   // Horner program of this
+   std::vector<size_t> idx;
+   for (size_t j = 0; j < coef_.size(); ++j)
+      idx.push_back(j);
+
+   compile(idx, 0, idx.size(), 0, k, prog_);
+
+   // Horner programs of the univariate coefficients
+   uni_.resize(k);
+   for (size_t i = 0; i < k; ++i)
+   {
+      for (unsigned j = 0; j <= deg_[i]; ++j)
+      {
+         std::vector<size_t> sub;
+         for (size_t m = 0; m < coef_.size(); ++m)
+            if (exponent(m, i) == j)
+               sub.push_back(m);
+
+         if (!sub.empty())
+         {
+            Program prog;
+            compile(sub, 0, sub.size(), 0, i, prog);
+            uni_[i].push_back(std::make_pair(j, prog));
+         }
+      }
+   }
+
+   stack_.resize(coef_.size());
+
+   makeBernstein();
+}
+
+void Polynomial::makeBernstein()
+{
+   size_t k = var_.size();
+
+   // size of the tensor of coefficients and strides, the size being
+   // saturated if it overflows
+   const size_t smax = std::numeric_limits<size_t>::max();
+   bstride_.resize(k);
+   bsize_ = 1;
+   for (int i = (int)k - 1; i >= 0; --i)
+   {
+      bstride_[i] = bsize_;
+      bsize_ = (bsize_ > smax / (deg_[i] + 1)) ? smax : bsize_ * (deg_[i] + 1);
+   }
+
+   if (bsize_ == smax)
+      return;
+
+   // positions of the monomials in the tensor
+   for (size_t m = 0; m < coef_.size(); ++m)
+   {
+      size_t pos = 0;
+      for (size_t i = 0; i < k; ++i)
+         pos += exponent(m, i) * bstride_[i];
+
+      bpos_.push_back(pos);
+   }
+
+   // binomial coefficients up to the maximum degree
+   unsigned dmax = 0;
+   for (unsigned d : deg_)
+      dmax = std::max(dmax, d);
+
+   std::vector<std::vector<Interval>> binom(dmax + 1);
+   for (unsigned l = 0; l <= dmax; ++l)
+   {
+      binom[l].resize(l + 1, Interval::one());
+      for (unsigned j = 1; j < l; ++j)
+         binom[l][j] = binom[l - 1][j - 1] + binom[l - 1][j];
+   }
+
+   // bratio_[d] is the triangular table of the binomial coefficients followed
+   // by the one of the ratios binom(l, j) / binom(d, j) for j <= l <= d
+   bratio_.resize(dmax + 1);
+   for (unsigned i = 0; i < k; ++i)
+   {
+      unsigned d = deg_[i];
+      if (!bratio_[d].empty())
+         continue;
+
+      for (unsigned l = 0; l <= d; ++l)
+         for (unsigned j = 0; j <= l; ++j)
+            bratio_[d].push_back(binom[l][j]);
+
+      for (unsigned l = 0; l <= d; ++l)
+         for (unsigned j = 0; j <= l; ++j)
+            bratio_[d].push_back(binom[l][j] / binom[d][j]);
+   }
+}
+
+void Polynomial::compile(const std::vector<size_t> &idx, size_t a, size_t b, size_t i,
+                         size_t skip, Program &prog) const
+{
+   size_t k = var_.size();
+   if (i == skip)
+      ++i;
+
+   if (i >= k)
+   {
+      ASSERT(b == a + 1, "Bad compilation of a polynomial");
+      prog.push_back({Instr::Push, idx[a], 0});
+      return;
+   }
+
+   // groups of monomials having the same exponent in the i-th variable,
+   // sorted by increasing exponents
+   std::vector<size_t> first;
+   for (size_t m = a; m < b; ++m)
+      if (m == a || exponent(idx[m], i) != exponent(idx[m - 1], i))
+         first.push_back(m);
+   first.push_back(b);
+
+   // G1 + x^(e2-e1)*(G2 + x^(e3-e2)*(...)) multiplied by x^e1
+   size_t ng = first.size() - 1;
+   compile(idx, first[ng - 1], first[ng], i + 1, skip, prog);
+
+   for (size_t g = ng - 1; g > 0; --g)
+   {
+      unsigned e = exponent(idx[first[g]], i) - exponent(idx[first[g - 1]], i);
+      prog.push_back({Instr::MulPow, i, e});
+      compile(idx, first[g - 1], first[g], i + 1, skip, prog);
+      prog.push_back({Instr::Add, 0, 0});
+   }
+
+   unsigned e = exponent(idx[a], i);
+   if (e > 0)
+      prog.push_back({Instr::MulPow, i, e});
+}
+
+Interval Polynomial::exec(const Program &prog, const IntervalBox &B)
+{
+   size_t sp = 0;
+   for (const Instr &ins : prog)
+   {
+      switch (ins.op)
+      {
+      case Instr::Push:
+         stack_[sp++] = coef_[ins.arg];
+         break;
+
+      case Instr::MulPow:
+         if (ins.e == 1)
+            stack_[sp - 1] *= B.get(var_[ins.arg]);
+         else
+            stack_[sp - 1] *= pow(B.get(var_[ins.arg]), ins.e);
+         break;
+
+      case Instr::Add:
+         --sp;
+         stack_[sp - 1] += stack_[sp];
+         break;
+      }
+   }
+   return stack_[0];
+}
+
+Scope Polynomial::scope() const
+{
+   return scop_;
+}
+
+size_t Polynomial::nbVars() const
+{
+   return var_.size();
+}
+
+Variable Polynomial::var(size_t i) const
+{
+   ASSERT(i < var_.size(), "Bad access to a variable in a polynomial");
+   return var_[i];
+}
+
+size_t Polynomial::nbMonomials() const
+{
+   return coef_.size();
+}
+
+Interval Polynomial::coef(size_t k) const
+{
+   ASSERT(k < coef_.size(), "Bad access to a monomial in a polynomial");
+   return coef_[k];
+}
+
+unsigned Polynomial::exponent(size_t k, size_t i) const
+{
+   return expo_[k * var_.size() + i];
+}
+
+unsigned Polynomial::degree(size_t i) const
+{
+   ASSERT(i < var_.size(), "Bad access to a variable in a polynomial");
+   return deg_[i];
+}
+
+unsigned Polynomial::degree() const
+{
+   unsigned d = 0;
+   for (size_t k = 0; k < coef_.size(); ++k)
+   {
+      unsigned s = 0;
+      for (size_t i = 0; i < var_.size(); ++i)
+         s += exponent(k, i);
+      d = std::max(d, s);
+   }
+   return d;
+}
+
+Interval Polynomial::eval(const IntervalBox &B)
+{
+   return exec(prog_, B);
+}
+
+void Polynomial::coefficients(size_t i, const IntervalBox &B, std::vector<Interval> &Q)
+{
+   ASSERT(i < var_.size(), "Bad access to a variable in a polynomial");
+
+   Q.assign(deg_[i] + 1, Interval::zero());
+   for (const auto &p : uni_[i])
+      Q[p.first] = exec(p.second, B);
+}
+
+bool Polynomial::bernstein(const IntervalBox &B, size_t nmax, Interval &e)
+{
+   if (bsize_ > nmax)
+      return false;
+
+   size_t k = var_.size();
+   for (size_t i = 0; i < k; ++i)
+      if (B.get(var_[i]).isInf())
+         return false;
+
+   // coefficients in the power basis
+   size_t n = bsize_;
+   tensor_.assign(n, Interval::zero());
+   for (size_t m = 0; m < coef_.size(); ++m)
+      tensor_[bpos_[m]] = coef_[m];
+
+   for (size_t i = 0; i < k; ++i)
+   {
+      unsigned d = deg_[i];
+      size_t st = bstride_[i], blk = st * (d + 1);
+      Interval x = B.get(var_[i]), a(x.left()), w = Interval(x.right()) - a;
+
+      // binomial coefficients binom(l, j) at index l*(l+1)/2 + j and ratios
+      // binom(l, j) / binom(d, j) at the same index shifted by nt
+      const std::vector<Interval> &tab = bratio_[d];
+      size_t nt = tab.size() / 2;
+
+      aux_.resize(d + 1);
+
+      // every line of the tensor along the i-th dimension
+      for (size_t first = 0; first < n; first += blk)
+      {
+         for (size_t pos = first; pos < first + st; ++pos)
+         {
+            // the null lines are not modified, which exploits the sparsity
+            // of the polynomial in the first dimensions
+            bool zero = true;
+            for (unsigned l = 0; l <= d && zero; ++l)
+               zero = tensor_[pos + l * st].isZero();
+
+            if (zero)
+               continue;
+
+            // substitution x = a + w*t with t in [0, 1]
+            Interval wj = Interval::one();
+            for (unsigned j = 0; j <= d; ++j)
+            {
+               Interval s = Interval::zero();
+               for (unsigned l = d; l >= j && l <= d; --l)
+                  s = s * a + tab[l * (l + 1) / 2 + j] * tensor_[pos + l * st];
+
+               aux_[j] = s * wj;
+               wj *= w;
+            }
+
+            // conversion to the Bernstein basis
+            for (unsigned l = 0; l <= d; ++l)
+            {
+               Interval s = Interval::zero();
+               for (unsigned j = 0; j <= l; ++j)
+                  s += tab[nt + l * (l + 1) / 2 + j] * aux_[j];
+
+               tensor_[pos + l * st] = s;
+            }
+         }
+      }
+   }
+
+   e = Interval::emptyset();
+   for (const Interval &b : tensor_)
+      e |= b;
+
+   return true;
+}
+
+void Polynomial::print(std::ostream &os) const
+{
+   for (size_t m = 0; m < coef_.size(); ++m)
+   {
+      if (m > 0)
+         os << " + ";
+      os << coef_[m];
+
+      for (size_t i = 0; i < var_.size(); ++i)
+      {
+         unsigned e = exponent(m, i);
+         if (e == 1)
+            os << "*" << var_[i].getName();
+         else if (e > 1)
+            os << "*" << var_[i].getName() << "^" << e;
+      }
+   }
+}
+
+std::ostream &operator<<(std::ostream &os, const Polynomial &p)
+{
+   p.print(os);
+   return os;
+}
+
+/*----------------------------------------------------------------------------*/
+
+PolynomialCreator::PolynomialCreator(const Scope &scop)
+    : scop_(scop)
+    , pol_()
+{
+}
+
+const PolynomialCreator::Expansion &PolynomialCreator::expansion() const
+{
+   return pol_;
+}
+
+PolynomialCreator::Expansion PolynomialCreator::visit(const DagNode *d) const
+{
+   PolynomialCreator vis(scop_);
+   d->acceptVisitor(vis);
+   return vis.pol_;
+}
+
+PolynomialCreator::Expansion PolynomialCreator::constant(const Interval &x) const
+{
+   Expansion p;
+   if (!x.isZero())
+      p.insert(std::make_pair(std::vector<unsigned>(scop_.size(), 0), x));
+   return p;
+}
+
+void PolynomialCreator::add(Expansion &p, const Expansion &q, bool minus)
+{
+   for (const auto &m : q)
+   {
+      Interval c = minus ? -m.second : m.second;
+      auto it = p.find(m.first);
+
+      if (it == p.end())
+         p.insert(std::make_pair(m.first, c));
+
+      else
+      {
+         it->second += c;
+         if (it->second.isZero())
+            p.erase(it);
+      }
+   }
+}
+
+PolynomialCreator::Expansion PolynomialCreator::mul(const Expansion &p,
+                                                    const Expansion &q) const
+{
+   Expansion r;
+   for (const auto &mp : p)
+      for (const auto &mq : q)
+      {
+         std::vector<unsigned> e(mp.first);
+         for (size_t i = 0; i < e.size(); ++i)
+            e[i] += mq.first[i];
+
+         Interval c = mp.second * mq.second;
+         auto it = r.find(e);
+
+         if (it == r.end())
+            r.insert(std::make_pair(e, c));
+         else
+            it->second += c;
+      }
+
+   if (r.size() > Polynomial::MAX_MONOMIALS)
+      THROW("Too many monomials in the expansion of a polynomial");
+
+   return r;
+}
+
+void PolynomialCreator::apply(const DagConst *d)
+{
+   pol_ = constant(d->getConst());
+}
+
+void PolynomialCreator::apply(const DagVar *d)
+{
+   std::vector<unsigned> e(scop_.size(), 0);
+   e[scop_.index(d->getVar())] = 1;
+   pol_.clear();
+   pol_.insert(std::make_pair(e, Interval::one()));
+}
+
+void PolynomialCreator::apply(const DagAdd *d)
+{
+   pol_ = visit(d->left());
+   add(pol_, visit(d->right()), false);
+}
+
+void PolynomialCreator::apply(const DagSub *d)
+{
+   pol_ = visit(d->left());
+   add(pol_, visit(d->right()), true);
+}
+
+void PolynomialCreator::apply(const DagMul *d)
+{
+   pol_ = mul(visit(d->left()), visit(d->right()));
+}
+
+void PolynomialCreator::apply(const DagDiv *d)
+{
+   // division by a non-zero constant
+   Expansion q = visit(d->right());
+   std::vector<unsigned> zero(scop_.size(), 0);
+
+   if (q.size() != 1 || q.begin()->first != zero || q.begin()->second.containsZero())
+      THROW("Not a polynomial");
+
+   pol_ = mul(visit(d->left()), constant(Interval::one() / q.begin()->second));
+}
+
+void PolynomialCreator::apply(const DagUsb *d)
+{
+   pol_.clear();
+   add(pol_, visit(d->child()), true);
+}
+
+void PolynomialCreator::apply(const DagSqr *d)
+{
+   Expansion p = visit(d->child());
+   pol_ = mul(p, p);
+}
+
+void PolynomialCreator::apply(const DagPow *d)
+{
+   int n = d->exponent();
+   if (n < 0)
+      THROW("Not a polynomial");
+
+   // exponentiation by squaring
+   Expansion p = visit(d->child());
+   pol_ = constant(Interval::one());
+
+   while (n > 0)
+   {
+      if (n % 2 == 1)
+         pol_ = mul(pol_, p);
+
+      n /= 2;
+      if (n > 0)
+         p = mul(p, p);
+   }
+}
+
+void PolynomialCreator::apply(const DagLin *d)
+{
+   pol_ = constant(d->getCst());
+
+   for (size_t i = 0; i < d->nbTerms(); ++i)
+   {
+      std::vector<unsigned> e(scop_.size(), 0);
+      e[scop_.index(d->varNode(i)->getVar())] = 1;
+
+      Expansion p;
+      p.insert(std::make_pair(e, d->coef(i)));
+      add(pol_, p, false);
+   }
+}
+
+/*----------------------------------------------------------------------------*/
+
+void PolynomialUni::set(const std::vector<Interval> &Q, const Interval &img)
+{
+   q_ = Q;
+   img_ = img;
+}
+
+size_t PolynomialUni::degree() const
+{
+   return q_.size() - 1;
+}
+
+Interval PolynomialUni::eval(const Interval &x)
+{
+   Interval r = q_.back();
+   for (size_t j = q_.size() - 1; j > 0; --j)
+      r = r * x + q_[j - 1];
+
+   return r - img_;
+}
+
+Interval PolynomialUni::diff(const Interval &x)
+{
+   size_t d = q_.size() - 1;
+   if (d == 0)
+      return Interval::zero();
+
+   Interval r = Interval((double)d) * q_[d];
+   for (size_t j = d - 1; j > 0; --j)
+      r = r * x + Interval((double)j) * q_[j];
+
+   return r;
+}
+
+} // namespace realpaver
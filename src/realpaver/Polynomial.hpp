@@ -0,0 +1,237 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   Polynomial.hpp
+ * @brief  Sparse multivariate polynomials with Horner and Bernstein forms
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#ifndef REALPAVER_POLYNOMIAL_HPP
+#define REALPAVER_POLYNOMIAL_HPP
+
+#include "realpaver/Dag.hpp"
+#include "realpaver/IntervalFunctionUni.hpp"
+#include <map>
+#include <vector>
+
+namespace realpaver {
+
+/**
+ * @brief Sparse multivariate polynomial with interval coefficients.
+ *
+ * A polynomial is extracted from a function of a DAG by expanding the sums,
+ * differences, products, squares and powers with natural exponents. An
+ * exception is thrown if the function is not polynomial or if the expanded
+ * form has more than MAX_MONOMIALS monomials.
+ *
+ * The monomials are stored in a table sorted by the lexicographic ordering
+ * of the exponents, one row per monomial and one column per variable of the
+ * scope. The table is compiled in a program implementing the recursive
+ * Horner scheme in the variables from the first one to the last one, e.g.
+ * 2x^2y + xy^2 - 3x + y + 1 = x*(x*(2y) + (y*y - 3)) + (y + 1). This program
+ * is a flat array of instructions executed with a stack of intervals.
+ *
+ * The Bernstein form of the polynomial on a box is also available. The range
+ * of the polynomial is enclosed by the hull of its Bernstein coefficients.
+ * The number of coefficients is the product of (d_i + 1) where d_i is the
+ * degree of the i-th variable, hence this form is calculated only if this
+ * number is smaller than a given limit. The positions of the monomials in
+ * the tensor of coefficients and the binomial tables are computed once, and
+ * the null lines of the tensor are skipped by the change of basis.
+ */
+class Polynomial {
+public:
+   /// Maximum number of monomials of the expanded form
+   static const size_t MAX_MONOMIALS;
+
+   /// Creates the polynomial representing a function of a DAG
+   Polynomial(const DagFun *f);
+
+   /// Default copy constructor
+   Polynomial(const Polynomial &) = default;
+
+   /// No assignment
+   Polynomial &operator=(const Polynomial &) = delete;
+
+   /// Default destructor
+   ~Polynomial() = default;
+
+   /// Returns the scope of this
+   Scope scope() const;
+
+   /// Returns the number of variables
+   size_t nbVars() const;
+
+   /// Returns the i-th variable of the scope
+   Variable var(size_t i) const;
+
+   /// Returns the number of monomials
+   size_t nbMonomials() const;
+
+   /// Returns the coefficient of the k-th monomial
+   Interval coef(size_t k) const;
+
+   /// Returns the exponent of the i-th variable in the k-th monomial
+   unsigned exponent(size_t k, size_t i) const;
+
+   /// Returns the degree of the i-th variable
+   unsigned degree(size_t i) const;
+
+   /// Returns the total degree of this
+   unsigned degree() const;
+
+   /// Returns the interval evaluation of the Horner form of this on B
+   Interval eval(const IntervalBox &B);
+
+   /**
+    * @brief Calculates the Bernstein enclosure of the range of this on B.
+    *
+    * Returns false if the number of Bernstein coefficients is greater than
+    * nmax, otherwise assigns e to the hull of these coefficients.
+    */
+   bool bernstein(const IntervalBox &B, size_t nmax, Interval &e);
+
+   /**
+    * @brief Calculates the univariate coefficients of this.
+    *
+    * Given the i-th variable x of the scope, this is rewritten as the sum
+    * of the terms Q[j]*x^j for j = 0 .. degree(i) where Q[j] is the Horner
+    * evaluation on B of the polynomial in the other variables.
+    */
+   void coefficients(size_t i, const IntervalBox &B, std::vector<Interval> &Q);
+
+   /// Output on a stream
+   void print(std::ostream &os) const;
+
+private:
+   // instruction of a Horner program
+   struct Instr {
+      enum { Push, MulPow, Add } op; // operation
+      size_t arg;                    // coefficient index or variable index
+      unsigned e;                    // exponent
+   };
+   typedef std::vector<Instr> Program;
+
+   Scope scop_;                  // set of variables
+   std::vector<Variable> var_;   // variables in the order of the scope
+   std::vector<Interval> coef_;  // coefficients of the monomials
+   std::vector<unsigned> expo_;  // table of exponents, one row per monomial
+   std::vector<unsigned> deg_;   // degrees of the variables
+   Program prog_;                // Horner program of this
+   std::vector<std::vector<std::pair<unsigned, Program>>> uni_;
+   // Horner programs of the coefficients of the univariate polynomials,
+   // uni_[i] is the list of the pairs (j, program of Q[j])
+   std::vector<Interval> stack_; // stack used to execute the programs
+   size_t bsize_;                // number of Bernstein coefficients
+   std::vector<size_t> bstride_; // strides of the tensor of coefficients
+   std::vector<size_t> bpos_;    // positions of the monomials in the tensor
+   std::vector<std::vector<Interval>> bratio_;
+   // bratio_[d] = binomial coefficients and conversion ratios in degree d
+   std::vector<Interval> tensor_, aux_; // Bernstein coefficients
+
+   // compiles the monomials of indexes idx[a] .. idx[b-1] from the variable i
+   // skipping the variable skip
+   void compile(const std::vector<size_t> &idx, size_t a, size_t b, size_t i,
+                size_t skip, Program &prog) const;
+
+   // executes a program
+   Interval exec(const Program &prog, const IntervalBox &B);
+
+   // computes the data structures of the Bernstein form
+   void makeBernstein();
+
+   friend class PolynomialCreator;
+};
+
+/// Output on a stream
+std::ostream &operator<<(std::ostream &os, const Polynomial &p);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Visitor of DAG nodes that expands a polynomial.
+ *
+ * A polynomial is represented by a map from the exponents of the monomials
+ * to their coefficients.
+ */
+class PolynomialCreator : public DagVisitor {
+public:
+   /// Type of expanded polynomials
+   typedef std::map<std::vector<unsigned>, Interval> Expansion;
+
+   /// Constructor given the scope of the polynomial
+   PolynomialCreator(const Scope &scop);
+
+   /// Returns the expansion resulting from a visit
+   const Expansion &expansion() const;
+
+   /// @name Visit methods
+   ///@{
+   void apply(const DagConst *d) override;
+   void apply(const DagVar *d) override;
+   void apply(const DagAdd *d) override;
+   void apply(const DagSub *d) override;
+   void apply(const DagMul *d) override;
+   void apply(const DagDiv *d) override;
+   void apply(const DagUsb *d) override;
+   void apply(const DagSqr *d) override;
+   void apply(const DagPow *d) override;
+   void apply(const DagLin *d) override;
+   ///@}
+
+private:
+   Scope scop_;     // scope
+   Expansion pol_;  // result of a visit
+
+   // expansion of a sub-dag
+   Expansion visit(const DagNode *d) const;
+
+   // operations on expansions
+   static void add(Expansion &p, const Expansion &q, bool minus);
+   Expansion mul(const Expansion &p, const Expansion &q) const;
+   Expansion constant(const Interval &x) const;
+};
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Univariate interval polynomial minus an image.
+ *
+ * Given the coefficients Q[j] and an image I, it represents the function
+ * g(x) = sum_j Q[j]*x^j - I such that 0 belongs to g(x) if and only if
+ * the polynomial belongs to I for some values of the coefficients.
+ */
+class PolynomialUni : public IntervalFunctionUni {
+public:
+   /// Constructor
+   PolynomialUni() = default;
+
+   /// Assigns the coefficients and the image
+   void set(const std::vector<Interval> &Q, const Interval &img);
+
+   /// Returns the degree of this
+   size_t degree() const;
+
+   Interval eval(const Interval &x) override;
+   Interval diff(const Interval &x) override;
+
+private:
+   std::vector<Interval> q_; // coefficients
+   Interval img_;            // image
+};
+
+} // namespace realpaver
+
+#endif
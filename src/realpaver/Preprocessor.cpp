@@ -21,6 +21,7 @@
 #include "realpaver/Preprocessor.hpp"
 #include "realpaver/AssertDebug.hpp"
 #include "realpaver/Logger.hpp"
+#include "realpaver/Parallel.hpp"
 #include "realpaver/Param.hpp"
 #include "realpaver/ScopeBank.hpp"
 
@@ -32,7 +33,9 @@ Preprocessor::Preprocessor()
     , box_(nullptr)
     , inactive_()
     , active_()
+    , ascope_()
     , unfeasible_(false)
+    , nbt_(1)
     , timer_()
 {
 }
@@ -92,29 +95,100 @@ DomainBox Preprocessor::destRegion() const
 }
 
 void Preprocessor::apply(const Problem &src, Problem &dest)
+{
+   apply(src, DomainBox(src.scope()), dest);
+}
+
+void Preprocessor::apply(const Problem &src, const DomainBox &region, Problem &dest)
+{
+   ASSERT(!src.isEmpty(), "Preprocessing error");
+   ASSERT(dest.isEmpty(), "Preprocessing error");
+
+   init(src, region);
+
+   LOG_MAIN("Preprocessing");
+   LOG_INTER("Box: " << (*box_));
+
+   timer_.reset();
+   timer_.start();
+   applyImpl(src, dest);
+   timer_.stop();
+}
+
+void Preprocessor::restore(const Problem &src, const DomainBox &region,
+                           const Scope &fixed, Problem &dest)
 {
    ASSERT(!src.isEmpty(), "Preprocessing error");
    ASSERT(dest.isEmpty(), "Preprocessing error");
 
+   init(src, region);
+
+   LOG_MAIN("Restoration of " << fixed.size() << " fixed variables");
+
+   timer_.reset();
+   timer_.start();
+   restoreImpl(src, fixed, dest);
+   timer_.stop();
+}
+
+void Preprocessor::init(const Problem &src, const DomainBox &region)
+{
    // resets this
    vvm_.clear();
    vim_.clear();
    inactive_.clear();
    active_.clear();
+   ascope_ = Scope();
    unfeasible_ = false;
 
    // makes the interval box used for propagation
    if (box_ != nullptr)
       delete box_;
    box_ = new DomainBox(src.scope());
+   box_->setOnScope(region, src.scope() & region.scope());
+}
 
-   LOG_MAIN("Preprocessing");
-   LOG_INTER("Box: " << (*box_));
+void Preprocessor::restoreImpl(const Problem &src, const Scope &fixed, Problem &dest)
+{
+   for (size_t i = 0; i < src.nbVars(); ++i)
+   {
+      Variable v = src.varAt(i);
+      Domain *domain = box_->get(v);
 
-   timer_.reset();
-   timer_.start();
-   applyImpl(src, dest);
-   timer_.stop();
+      if (domain->isEmpty())
+      {
+         LOG_MAIN("Empty domain of variable: " << v.getName());
+         unfeasible_ = true;
+         return;
+      }
+
+      if (fixed.contains(v))
+      {
+         LOG_INTER("Restores " << v.getName() << " := " << (*domain));
+         vim_.insert(std::make_pair(v, domain->intervalHull()));
+      }
+      else
+      {
+         Variable w = dest.addClonedVar(v);
+         std::unique_ptr<Domain> wdom(domain->clone());
+         w.setDomain(std::move(wdom));
+         vvm_.insert(std::make_pair(v, w));
+      }
+   }
+
+   // the constraints are all active and they are only rewritten over the
+   // variables of the new problem
+   for (size_t i = 0; i < src.nbCtrs(); ++i)
+   {
+      Constraint c = src.ctrAt(i);
+      ASSERT(c.scope().disjoint(fixed), "Fixed variable in constraint " << c);
+
+      active_.push_back(c);
+      ascope_.insert(c.scope());
+   }
+
+   rewriteCtrs(dest);
+   rewriteObjective(src.getObjective(), dest);
 }
 
 void Preprocessor::applyImpl(const Problem &src, Problem &dest)
@@ -167,6 +241,7 @@ void Preprocessor::applyImpl(const Problem &src, Problem &dest)
       else
       {
          active_.push_back(c);
+         ascope_.insert(c.scope());
       }
    }
 
@@ -207,32 +282,51 @@ void Preprocessor::applyImpl(const Problem &src, Problem &dest)
 
    LOG_MAIN("Number of removed variables: " << vim_.size());
 
-   // rewrites the constraints
-   for (Constraint input : active_)
+   rewriteCtrs(dest);
+
+   // checks the range of the objective function
+   Interval dobj = obj.getTerm().eval(*box_)->intervalHull();
+   if (dobj.isEmpty())
+   {
+      LOG_MAIN("Empty range of the objective function");
+      unfeasible_ = true;
+      return;
+   }
+
+   rewriteObjective(obj, dest);
+}
+
+void Preprocessor::rewriteCtrs(Problem &dest)
+{
+   // rewrites the constraints; the rewritings are independent and they
+   // can be done in parallel, then the results are inserted in order
+   std::vector<Constraint> fixed(active_.size());
+
+   parallelFor(active_.size(), nbt_,
+               [&](size_t i)
+               {
+                  ConstraintFixer fixer(&vvm_, &vim_, *box_);
+                  active_[i].acceptVisitor(fixer);
+                  fixed[i] = fixer.getConstraint();
+               });
+
+   for (size_t i = 0; i < active_.size(); ++i)
    {
-      ConstraintFixer fixer(&vvm_, &vim_, *box_);
-      input.acceptVisitor(fixer);
-      Constraint c = fixer.getConstraint();
+      Constraint c = fixed[i];
 
       if (c.isConstant())
       {
          LOG_INTER("Constraint with no variable: " << c);
-         inactive_.push_back(input);
+         inactive_.push_back(active_[i]);
       }
 
       else
          dest.addCtr(c);
    }
+}
 
-   // checks the range of the objective function
-   Interval dobj = obj.getTerm().eval(*box_)->intervalHull();
-   if (dobj.isEmpty())
-   {
-      LOG_MAIN("Empty range of the objective function");
-      unfeasible_ = true;
-      return;
-   }
-
+void Preprocessor::rewriteObjective(const Objective &obj, Problem &dest)
+{
    // simplifies the objective function
    TermFixer fixer(&vvm_, &vim_);
    obj.getTerm().acceptVisitor(fixer);
@@ -251,6 +345,50 @@ void Preprocessor::applyImpl(const Problem &src, Problem &dest)
    }
 }
 
+bool Preprocessor::hasSameOutcome(const Preprocessor &other) const
+{
+   if (unfeasible_ || other.unfeasible_)
+      return false;
+
+   if (vvm_.size() != other.vvm_.size() || vim_.size() != other.vim_.size() ||
+       inactive_.size() != other.inactive_.size())
+      return false;
+
+   for (const auto &p : vvm_)
+      if (other.vvm_.find(p.first) == other.vvm_.end())
+         return false;
+
+   for (const auto &p : vim_)
+   {
+      auto it = other.vim_.find(p.first);
+      if (it == other.vim_.end() || p.second.isSetNeq(it->second))
+         return false;
+   }
+
+   for (size_t i = 0; i < inactive_.size(); ++i)
+      if (inactive_[i].rep() != other.inactive_[i].rep())
+         return false;
+
+   // the rewriting of these constraints depends on the domains
+   for (const auto &c : active_)
+   {
+      RelSymbol rel = c.relSymbol();
+      if (rel == RelSymbol::Table || rel == RelSymbol::Cond ||
+          rel == RelSymbol::Piecewise)
+         return false;
+   }
+
+   return true;
+}
+
+void Preprocessor::assignDestVars(const Preprocessor &other)
+{
+   ASSERT(hasSameOutcome(other), "Preprocessors having different outcomes");
+
+   for (auto &p : vvm_)
+      p.second = other.vvm_.at(p.first);
+}
+
 bool Preprocessor::propagate(const Problem &problem, DomainBox &box)
 {
    // AC1 propagation algorithm
@@ -281,11 +419,7 @@ bool Preprocessor::propagate(const Problem &problem, DomainBox &box)
 
 bool Preprocessor::occursInActiveConstraint(const Variable &v) const
 {
-   for (Constraint c : active_)
-      if (c.dependsOn(v))
-         return true;
-
-   return false;
+   return ascope_.contains(v);
 }
 
 Scope Preprocessor::fixedScope() const
@@ -364,6 +498,17 @@ bool Preprocessor::isSolved() const
    return unfeasible_ || allVarsFixed();
 }
 
+size_t Preprocessor::getNbThreads() const
+{
+   return nbt_;
+}
+
+void Preprocessor::setNbThreads(size_t n)
+{
+   ASSERT(n >= 1, "Bad number of threads in a preprocessor: " << n);
+   nbt_ = n;
+}
+
 double Preprocessor::elapsedTime() const
 {
    return timer_.elapsedTime();
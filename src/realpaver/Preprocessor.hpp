@@ -38,6 +38,10 @@ namespace realpaver {
  * problem to the corresponding variable in the new problem. The second one maps
  * a variable of the source problem to its value (it contains the fixed
  * variable).
+ *
+ * The rewriting of the active constraints, which includes the creation of
+ * their flat functions, can be distributed over several threads. The
+ * constraints of the new problem are always inserted in the same order.
  */
 class Preprocessor {
 public:
@@ -73,6 +77,58 @@ public:
     */
    void apply(const Problem &src, Problem &dest);
 
+   /**
+    * @brief Creates a simplified problem from a source problem and a region.
+    *
+    * @param src source problem
+    * @param region initial domains of some variables of the source problem
+    * @param dest simplified problem
+    *
+    * The domains of the variables of src that belong to the scope of region
+    * are replaced by the domains in region, the other variables keeping
+    * their own domains. The variables of src are not modified.
+    */
+   void apply(const Problem &src, const DomainBox &region, Problem &dest);
+
+   /**
+    * @brief Creates a problem from a source problem that has already been
+    * simplified.
+    *
+    * @param src source problem
+    * @param region initial domains of some variables of the source problem
+    * @param fixed variables of src whose domains are fixed
+    * @param dest new problem
+    *
+    * There is no propagation and no satisfaction test. The variables of fixed
+    * are removed with their domains, which are restored in the solutions. The
+    * constraints of src must not depend on them. They are all active and they
+    * are only rewritten over the variables of dest. It is typically used for
+    * a problem that was preprocessed before being stored in a binary model.
+    */
+   void restore(const Problem &src, const DomainBox &region, const Scope &fixed,
+                Problem &dest);
+
+   /**
+    * @brief Tests if this and another preprocessor simplify the same source
+    * problem in the same way except for the domains of the unfixed variables.
+    *
+    * It is the case if they have the same fixed variables with the same
+    * domains, the same unfixed variables and the same inactive constraints.
+    * It is conservatively false if an active constraint is rewritten with
+    * respect to the domains, e.g. a table constraint.
+    */
+   bool hasSameOutcome(const Preprocessor &other) const;
+
+   /**
+    * @brief Makes the unfixed variables of this map to the variables of the
+    * destination problem of another preprocessor.
+    *
+    * It requires hasSameOutcome(other). This makes it possible to reuse the
+    * problem simplified by other, whose variables must be assigned the
+    * domains of the variables of the problem simplified by this.
+    */
+   void assignDestVars(const Preprocessor &other);
+
    /// Returns true if the domain of v is fixed
    bool hasFixedDomain(Variable v) const;
 
@@ -141,6 +197,12 @@ public:
    /// Returns the elapsed time of the preprocessing stage in seconds
    double elapsedTime() const;
 
+   /// Returns the number of threads used to rewrite the constraints
+   size_t getNbThreads() const;
+
+   /// Assigns the number of threads used to rewrite the constraints (>= 1)
+   void setNbThreads(size_t n);
+
 private:
    VarVarMapType vvm_;      // map for non fixed variables
    VarIntervalMapType vim_; // map for fixed variables
@@ -149,13 +211,19 @@ private:
 
    std::vector<Constraint> inactive_; // constraints inactive
    std::vector<Constraint> active_;   // constraints not inactive
+   Scope ascope_;                     // variables of the active constraints
    bool unfeasible_;                  // true if problem unfeasible
+   size_t nbt_;                       // number of threads
 
    Timer timer_;
 
    bool occursInActiveConstraint(const Variable &v) const;
    bool propagate(const Problem &problem, DomainBox &box);
+   void init(const Problem &src, const DomainBox &region);
    void applyImpl(const Problem &src, Problem &dest);
+   void restoreImpl(const Problem &src, const Scope &fixed, Problem &dest);
+   void rewriteCtrs(Problem &dest);
+   void rewriteObjective(const Objective &obj, Problem &dest);
 };
 
 } // namespace realpaver
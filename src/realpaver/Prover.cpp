@@ -19,6 +19,7 @@
  */
 
 #include "realpaver/AssertDebug.hpp"
+#include "realpaver/ConstraintFixer.hpp"
 #include "realpaver/IntervalThickFunction.hpp"
 #include "realpaver/Logger.hpp"
 #include "realpaver/Param.hpp"
@@ -35,20 +36,53 @@ Prover::Prover(const Problem &p)
     , chi_(Params::GetDblParam("INFLATION_CHI"))
     , maxiter_(Params::GetIntParam("NEWTON_CERTIFY_ITER_LIMIT"))
 {
-   dag_ = std::make_shared<Dag>();
-
    for (size_t i = 0; i < p.nbCtrs(); ++i)
    {
       Constraint c = p.ctrAt(i);
-      bool eq = c.isEquation();
-
-      Item it = {c, eq, Proof::Maybe};
+      Item it = {c, c.isEquation(), Proof::Maybe};
       v_.push_back(it);
+   }
+
+   makeNewton();
+}
 
-      if (eq)
-         dag_->insert(c);
+Prover::Prover(const Prover &other)
+    : v_()
+    , dag_(nullptr)
+    , mnewton_(nullptr)
+    , unewton_(nullptr)
+    , delta_(other.delta_)
+    , chi_(other.chi_)
+    , maxiter_(other.maxiter_)
+{
+   // the constraints are cloned using a map from every variable to itself
+   ConstraintFixer::VarVarMapType vvm;
+   ConstraintFixer::VarIntervalMapType vim;
+
+   for (const auto &it : other.v_)
+      for (const auto &v : it.ctr.scope())
+         vvm.emplace(v, v);
+
+   for (const auto &it : other.v_)
+   {
+      ConstraintFixer fixer(&vvm, &vim, DomainBox(it.ctr.scope()));
+      it.ctr.acceptVisitor(fixer);
+
+      Item item = {fixer.getConstraint(), it.iseq, Proof::Maybe};
+      v_.push_back(item);
    }
 
+   makeNewton();
+}
+
+void Prover::makeNewton()
+{
+   dag_ = std::make_shared<Dag>();
+
+   for (const auto &it : v_)
+      if (it.iseq)
+         dag_->insert(it.ctr);
+
    if (dag_->nbFuns() > 0)
    {
       IntervalFunctionVector F(dag_);
@@ -137,6 +171,7 @@ Proof Prover::certify(IntervalBox &B)
       Variable v = dag_->fun(0)->scope().var(0);
       Interval x = B.get(v);
       IntervalThickFunction f(dag_, 0, v);
+      f.update(B);
       proof = unewton_->localSearch(f, x);
       B.set(v, x);
 
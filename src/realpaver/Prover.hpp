@@ -35,6 +35,11 @@ namespace realpaver {
  *
  * The epsilon-inflation algorithm has two parameters, delta and chi.
  *
+ * A prover is not thread-safe since the evaluation of the constraints and
+ * the Newton operators store values in their terms and DAGs. A copy of a
+ * prover clones the constraints, hence a prover and its copies can be used
+ * in different threads.
+ *
  * @see Inflator
  * @see IntervalNewton
  */
@@ -46,8 +51,8 @@ public:
    /// Destructor
    ~Prover();
 
-   /// No copy
-   Prover(const Prover &) = delete;
+   /// Copy constructor that clones the constraints
+   Prover(const Prover &other);
 
    /// No asignment
    Prover &operator=(const Prover &) = delete;
@@ -86,6 +91,9 @@ private:
    double delta_;               // parameter delta of inflation
    double chi_;                 // parameter chi of inflation
    size_t maxiter_;             // maximum number of iterations
+
+   // creates the DAG of equations and the Newton operators
+   void makeNewton();
 };
 
 } // namespace realpaver
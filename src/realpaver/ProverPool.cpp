@@ -0,0 +1,135 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   ProverPool.cpp
+ * @brief  Pool of threads certifying boxes
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#include "realpaver/AssertDebug.hpp"
+#include "realpaver/ProverPool.hpp"
+
+namespace realpaver {
+
+ProverPool::ProverPool(const Prover &prover, size_t nbt)
+    : prover_()
+    , threads_()
+    , tasks_()
+    , next_(0)
+    , done_(0)
+    , stop_(false)
+    , eptr_(nullptr)
+{
+   ASSERT(nbt >= 1, "Bad number of threads in a pool of provers: " << nbt);
+
+   // the provers are created by this thread since the copy of the
+   // constraints reads the shared terms
+   for (size_t k = 0; k < nbt; ++k)
+      prover_.push_back(std::make_unique<Prover>(prover));
+
+   for (size_t k = 0; k < nbt; ++k)
+      threads_.push_back(std::thread(&ProverPool::work, this, k));
+}
+
+ProverPool::~ProverPool()
+{
+   {
+      std::lock_guard<std::mutex> lock(mtx_);
+      stop_ = true;
+   }
+   cvtask_.notify_all();
+
+   for (auto &t : threads_)
+      t.join();
+}
+
+size_t ProverPool::nbThreads() const
+{
+   return threads_.size();
+}
+
+size_t ProverPool::submit(const IntervalBox &B)
+{
+   size_t i;
+   {
+      std::lock_guard<std::mutex> lock(mtx_);
+      i = tasks_.size();
+      tasks_.push_back(Task{B, Proof::Maybe});
+   }
+   cvtask_.notify_one();
+   return i;
+}
+
+size_t ProverPool::nbBoxes() const
+{
+   std::lock_guard<std::mutex> lock(mtx_);
+   return tasks_.size();
+}
+
+void ProverPool::wait()
+{
+   std::unique_lock<std::mutex> lock(mtx_);
+   cvdone_.wait(lock, [this]() { return done_ == tasks_.size(); });
+
+   if (eptr_ != nullptr)
+      std::rethrow_exception(eptr_);
+}
+
+const IntervalBox &ProverPool::getBox(size_t i) const
+{
+   ASSERT(i < tasks_.size(), "Bad access to a box in a pool of provers @ " << i);
+   return tasks_[i].box;
+}
+
+Proof ProverPool::getProof(size_t i) const
+{
+   ASSERT(i < tasks_.size(), "Bad access to a proof in a pool of provers @ " << i);
+   return tasks_[i].proof;
+}
+
+void ProverPool::work(size_t k)
+{
+   Prover &prover = *prover_[k];
+   std::unique_lock<std::mutex> lock(mtx_);
+
+   for (;;)
+   {
+      cvtask_.wait(lock, [this]() { return stop_ || next_ < tasks_.size(); });
+
+      if (next_ == tasks_.size())
+         return;
+
+      // the elements of a deque are not moved by an insertion at the end
+      Task &task = tasks_[next_++];
+      lock.unlock();
+
+      try
+      {
+         task.proof = prover.certify(task.box);
+      }
+      catch (...)
+      {
+         std::lock_guard<std::mutex> guard(mtx_);
+         if (eptr_ == nullptr)
+            eptr_ = std::current_exception();
+      }
+
+      lock.lock();
+      if (++done_ == tasks_.size())
+         cvdone_.notify_all();
+   }
+}
+
+} // namespace realpaver
@@ -0,0 +1,108 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   ProverPool.hpp
+ * @brief  Pool of threads certifying boxes
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#ifndef REALPAVER_PROVER_POOL_HPP
+#define REALPAVER_PROVER_POOL_HPP
+
+#include "realpaver/Prover.hpp"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace realpaver {
+
+/**
+ * @brief Pool of threads certifying boxes.
+ *
+ * Every thread owns a copy of a given prover. The boxes are submitted by
+ * the calling thread and certified by the threads of the pool in the
+ * background, which makes it possible to certify the solutions of a
+ * search while the search is running. The results are numbered in the
+ * order of submission, hence they do not depend on the scheduling of
+ * the threads.
+ *
+ * The provers must not log messages, which requires a log level lower
+ * than the inter level.
+ */
+class ProverPool {
+public:
+   /// Creates a pool of nbt >= 1 threads with copies of a prover
+   ProverPool(const Prover &prover, size_t nbt);
+
+   /// Destructor that waits for the termination of the threads
+   ~ProverPool();
+
+   /// No copy
+   ProverPool(const ProverPool &) = delete;
+
+   /// No assignment
+   ProverPool &operator=(const ProverPool &) = delete;
+
+   /// Returns the number of threads
+   size_t nbThreads() const;
+
+   /// Submits a box and returns its index
+   size_t submit(const IntervalBox &B);
+
+   /// Returns the number of submitted boxes
+   size_t nbBoxes() const;
+
+   /**
+    * @brief Waits for the certification of all the submitted boxes.
+    *
+    * If a certification throws an exception then it is rethrown by this
+    * method.
+    */
+   void wait();
+
+   /// Returns the i-th box after certification, only valid after wait()
+   const IntervalBox &getBox(size_t i) const;
+
+   /// Returns the proof of the i-th box, only valid after wait()
+   Proof getProof(size_t i) const;
+
+private:
+   struct Task {
+      IntervalBox box; // box certified in place
+      Proof proof;     // certificate
+   };
+
+   std::vector<std::unique_ptr<Prover>> prover_; // one prover per thread
+   std::vector<std::thread> threads_;            // threads
+   std::deque<Task> tasks_;                      // submitted boxes
+   size_t next_;                                 // index of the next task
+   size_t done_;                                 // number of tasks done
+   bool stop_;                                   // true if the threads stop
+   std::exception_ptr eptr_;                     // first exception thrown
+   mutable std::mutex mtx_;                      // protection of the tasks
+   std::condition_variable cvtask_;              // signals new tasks
+   std::condition_variable cvdone_;              // signals done tasks
+
+   // loop of the k-th thread
+   void work(size_t k);
+};
+
+} // namespace realpaver
+
+#endif
@@ -44,6 +44,8 @@ size_t ScopeBank::nbInsertions() const
 
 Scope ScopeBank::insertScope(Scope scop)
 {
+   std::lock_guard<std::mutex> lock(mtx_);
+
    ++nb_;
    auto it = bank_.find(scop);
 
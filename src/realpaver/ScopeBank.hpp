@@ -22,6 +22,7 @@
 #define REALPAVER_SCOPE_BANK_HPP
 
 #include "realpaver/Scope.hpp"
+#include <mutex>
 #include <unordered_set>
 
 namespace realpaver {
@@ -46,7 +47,7 @@ public:
     * @brief Inserts a scope in this.
     *
     * If there is a scope S in this that is equal to scop then S is eturned,
-    * scop is inserted and returned otherwise.
+    * scop is inserted and returned otherwise. This method is thread-safe.
     */
    Scope insertScope(Scope scop);
 
@@ -59,8 +60,9 @@ private:
    };
    typedef std::unordered_set<Scope, ScopeHasher> SetType;
 
-   SetType bank_; // the set of scopes
-   size_t nb_;    // the number of scopes that have been inserted in this
+   SetType bank_;   // the set of scopes
+   size_t nb_;      // the number of scopes that have been inserted in this
+   std::mutex mtx_; // insertions may be done by several threads
 
    static ScopeBank instance_;
 
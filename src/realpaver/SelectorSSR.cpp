@@ -58,6 +58,20 @@ Variable SelectorSSR::getMaxVar() const
    return ssr_[imax].var;
 }
 
+double SelectorSSR::getSmearShare(const Variable &v) const
+{
+   double sum = 0.0, val = 0.0;
+
+   for (const Item &itm : ssr_)
+   {
+      sum += itm.val;
+      if (itm.var.id() == v.id())
+         val = itm.val;
+   }
+
+   return (sum > 0.0) ? val / sum : 0.0;
+}
+
 void SelectorSSR::calculate(const IntervalBox &B)
 {
    IntervalMatrix jac(F_.nbFuns(), F_.nbVars());
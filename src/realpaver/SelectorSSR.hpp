@@ -111,6 +111,15 @@ public:
    /// Returns the variable having the maximum smear sum rel value
    Variable getMaxVar() const;
 
+   /**
+    * @brief Returns the share of v in the smear sum rel values.
+    *
+    * It is the smear sum rel value of v divided by the sum of all the smear
+    * sum rel values, hence a real in [0, 1]. It returns 0 if v is not in the
+    * scope of this or if all the values are null.
+    */
+   double getSmearShare(const Variable &v) const;
+
    /// Output on a stream
    void print(std::ostream &os) const;
 
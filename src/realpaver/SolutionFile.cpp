@@ -0,0 +1,287 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   SolutionFile.cpp
+ * @brief  Solution files in binary and CSV formats
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#include "realpaver/AssertDebug.hpp"
+#include "realpaver/Exception.hpp"
+#include "realpaver/SolutionFile.hpp"
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+namespace realpaver {
+
+// magic string of solution files
+static const char SOLUTION_FILE_MAGIC[4] = {'R', 'P', 'S', 'F'};
+
+const uint32_t SolutionFile::VERSION = 1;
+
+bool SolutionFile::hasExtension(const std::string &filename)
+{
+   size_t n = filename.size();
+   return n > 4 && filename.compare(n - 4, 4, ".rps") == 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+BinaryReporter::BinaryReporter(std::ostream &os)
+    : BoxReporter()
+    , os_(&os)
+    , started_(false)
+    , rec_()
+{
+}
+
+BinaryReporter::BinaryReporter(const Problem &p, std::ostream &os)
+    : BoxReporter(p)
+    , os_(&os)
+    , started_(false)
+    , rec_()
+{
+}
+
+void BinaryReporter::start()
+{
+   if (started_)
+      return;
+
+   os_->write(SOLUTION_FILE_MAGIC, 4);
+
+   uint32_t version = SolutionFile::VERSION;
+   os_->write(reinterpret_cast<const char *>(&version), sizeof(version));
+
+   uint64_t n = ents_.size();
+   os_->write(reinterpret_cast<const char *>(&n), sizeof(n));
+
+   for (size_t j = 0; j < ents_.size(); ++j)
+   {
+      std::string name = ents_.get(j)->name();
+      uint64_t len = name.size();
+      os_->write(reinterpret_cast<const char *>(&len), sizeof(len));
+      os_->write(name.data(), len);
+   }
+
+   rec_.resize(2 * ents_.size());
+   started_ = true;
+}
+
+void BinaryReporter::report(const DomainBox &box)
+{
+   report(box, Proof::Maybe);
+}
+
+void BinaryReporter::report(const DomainBox &box, Proof proof)
+{
+   start();
+
+   uint64_t tag = static_cast<uint64_t>(proof);
+   os_->write(reinterpret_cast<const char *>(&tag), sizeof(tag));
+
+   for (size_t j = 0; j < ents_.size(); ++j)
+   {
+      Interval x = ents_.get(j)->domain(box)->intervalHull();
+      rec_[2 * j] = x.left();
+      rec_[2 * j + 1] = x.right();
+   }
+
+   os_->write(reinterpret_cast<const char *>(rec_.data()), rec_.size() * sizeof(double));
+}
+
+/*----------------------------------------------------------------------------*/
+
+CsvReporter::CsvReporter(std::ostream &os)
+    : BoxReporter()
+    , os_(&os)
+    , started_(false)
+{
+}
+
+CsvReporter::CsvReporter(const Problem &p, std::ostream &os)
+    : BoxReporter(p)
+    , os_(&os)
+    , started_(false)
+{
+}
+
+void CsvReporter::start()
+{
+   if (started_)
+      return;
+
+   (*os_) << "proof";
+   for (size_t j = 0; j < ents_.size(); ++j)
+   {
+      std::string name = ents_.get(j)->name();
+      (*os_) << ',' << name << "_lo," << name << "_hi";
+   }
+   (*os_) << '\n';
+
+   started_ = true;
+}
+
+void CsvReporter::report(const DomainBox &box)
+{
+   report(box, Proof::Maybe);
+}
+
+void CsvReporter::report(const DomainBox &box, Proof proof)
+{
+   start();
+
+   std::streamsize prec = os_->precision(std::numeric_limits<double>::max_digits10);
+
+   (*os_) << proof;
+   for (size_t j = 0; j < ents_.size(); ++j)
+   {
+      Interval x = ents_.get(j)->domain(box)->intervalHull();
+      (*os_) << ',' << x.left() << ',' << x.right();
+   }
+   (*os_) << '\n';
+
+   os_->precision(prec);
+}
+
+/*----------------------------------------------------------------------------*/
+
+SolutionReader::SolutionReader()
+    : buf_()
+    , names_()
+    , first_(0)
+    , size_(0)
+    , nsol_(0)
+{
+}
+
+void SolutionReader::read(const std::string &filename)
+{
+   std::ifstream is(filename, std::ios::in | std::ios::binary | std::ios::ate);
+   THROW_IF(!is.is_open(), "Unable to open the solution file " << filename);
+
+   std::vector<char> buf(static_cast<size_t>(is.tellg()));
+   is.seekg(0);
+   is.read(buf.data(), buf.size());
+   THROW_IF(!is.good(), "Read error of the solution file " << filename);
+
+   decode(buf.data(), buf.size());
+}
+
+void SolutionReader::decode(const char *buf, size_t n)
+{
+   names_.clear();
+   nsol_ = 0;
+
+   size_t pos = 4 + sizeof(uint32_t) + sizeof(uint64_t);
+   THROW_IF(n < pos || std::memcmp(buf, SOLUTION_FILE_MAGIC, 4) != 0,
+            "Not a solution file");
+
+   uint32_t version;
+   uint64_t ncol;
+   std::memcpy(&version, buf + 4, sizeof(version));
+   std::memcpy(&ncol, buf + 4 + sizeof(version), sizeof(ncol));
+
+   THROW_IF(version != SolutionFile::VERSION,
+            "Bad version of solution file: " << version << " (expected "
+                                             << SolutionFile::VERSION << ")");
+
+   for (uint64_t j = 0; j < ncol; ++j)
+   {
+      uint64_t len;
+      THROW_IF(n - pos < sizeof(len), "Truncated solution file");
+      std::memcpy(&len, buf + pos, sizeof(len));
+      pos += sizeof(len);
+
+      THROW_IF(n - pos < len, "Truncated solution file");
+      names_.push_back(std::string(buf + pos, len));
+      pos += len;
+   }
+
+   buf_.assign(buf, buf + n);
+   first_ = pos;
+   size_ = sizeof(uint64_t) + 2 * ncol * sizeof(double);
+   nsol_ = (n - pos) / size_;
+
+   for (size_t i = 0; i < nsol_; ++i)
+   {
+      uint64_t tag;
+      std::memcpy(&tag, record(i), sizeof(tag));
+      THROW_IF(tag > static_cast<uint64_t>(Proof::Inner),
+               "Bad proof certificate in solution file: " << tag);
+   }
+}
+
+size_t SolutionReader::nbColumns() const
+{
+   return names_.size();
+}
+
+std::string SolutionReader::columnName(size_t j) const
+{
+   ASSERT(j < names_.size(), "Bad access to a column in a solution file @ " << j);
+
+   return names_[j];
+}
+
+size_t SolutionReader::columnIndex(const std::string &name) const
+{
+   for (size_t j = 0; j < names_.size(); ++j)
+      if (names_[j] == name)
+         return j;
+
+   THROW("No column " << name << " in the solution file");
+}
+
+size_t SolutionReader::nbSolutions() const
+{
+   return nsol_;
+}
+
+const char *SolutionReader::record(size_t i) const
+{
+   return buf_.data() + first_ + i * size_;
+}
+
+Proof SolutionReader::getProof(size_t i) const
+{
+   ASSERT(i < nsol_, "Bad access to a solution in a solution file @ " << i);
+
+   uint64_t tag;
+   std::memcpy(&tag, record(i), sizeof(tag));
+   return static_cast<Proof>(tag);
+}
+
+Interval SolutionReader::get(size_t i, size_t j) const
+{
+   ASSERT(i < nsol_, "Bad access to a solution in a solution file @ " << i);
+   ASSERT(j < names_.size(), "Bad access to a column in a solution file @ " << j);
+
+   double b[2];
+   std::memcpy(b, record(i) + sizeof(uint64_t) + 2 * j * sizeof(double), sizeof(b));
+   return Interval(b[0], b[1]);
+}
+
+IntervalVector SolutionReader::getSolution(size_t i) const
+{
+   IntervalVector X(names_.size());
+   for (size_t j = 0; j < names_.size(); ++j)
+      X.set(j, get(i, j));
+   return X;
+}
+
+} // namespace realpaver
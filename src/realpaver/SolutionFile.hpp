@@ -0,0 +1,197 @@
+/*------------------------------------------------------------------------------
+ * Realpaver -- Realpaver is a rigorous nonlinear constraint solver based on
+ *              interval computations.
+ *------------------------------------------------------------------------------
+ * Copyright (c) 2004-2016 Laboratoire d'Informatique de Nantes Atlantique,
+ *               France
+ * Copyright (c) 2017-2024 Laboratoire des Sciences du Numérique de Nantes,
+ *               France
+ *------------------------------------------------------------------------------
+ * Realpaver is a software distributed WITHOUT ANY WARRANTY. Read the COPYING
+ * file for information.
+ *----------------------------------------------------------------------------*/
+
+/**
+ * @file   SolutionFile.hpp
+ * @brief  Solution files in binary and CSV formats
+ * @author Laurent Granvilliers
+ * @date   2026-10-18
+ */
+
+#ifndef REALPAVER_SOLUTION_FILE_HPP
+#define REALPAVER_SOLUTION_FILE_HPP
+
+#include "realpaver/BoxReporter.hpp"
+#include "realpaver/IntervalVector.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace realpaver {
+
+/**
+ * @brief Binary format of solution files.
+ *
+ * A binary solution file is a header followed by a sequence of records.
+ * The header contains the magic string "RPSF", the version of the format,
+ * the number n of columns and the names of the columns, i.e. the reported
+ * variables and aliases. Each name is stored as its length followed by its
+ * characters. Numbers are stored in the byte order of the host.
+ *
+ * Every record has the same size. It contains the proof certificate of a
+ * solution stored in 8 bytes, followed by the n pairs of bounds (left, right)
+ * of the interval hulls of the domains of the columns in the solution. The
+ * records are appended as soon as the solutions are reported, and the
+ * number of solutions is derived from the size of the file.
+ */
+class SolutionFile {
+public:
+   /// Version of the format
+   static const uint32_t VERSION;
+
+   /// Returns true if filename has the extension of binary solution files (.rps)
+   static bool hasExtension(const std::string &filename);
+};
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Reporter of solutions in a binary solution file.
+ *
+ * The output stream must be opened in binary mode. The header is written by
+ * start() or before the first solution.
+ */
+class BinaryReporter : public BoxReporter {
+public:
+   /// Constructor of an empty reporter given an output stream
+   BinaryReporter(std::ostream &os);
+
+   /// Constructor of a reporter on a problem given an output stream
+   BinaryReporter(const Problem &p, std::ostream &os);
+
+   /// Default destructor
+   ~BinaryReporter() = default;
+
+   /// Default copy constructor
+   BinaryReporter(const BinaryReporter &) = default;
+
+   /// No assignment
+   BinaryReporter &operator=(const BinaryReporter &) = delete;
+
+   /// Writes the header, the list of entities must not be modified after
+   void start() override;
+
+   /// Writes a solution whose proof certificate is Proof::Maybe
+   void report(const DomainBox &box) override;
+
+   void report(const DomainBox &box, Proof proof) override;
+
+private:
+   std::ostream *os_;        // output stream
+   bool started_;            // true if the header has been written
+   std::vector<double> rec_; // bounds of the current record
+};
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Reporter of solutions in a CSV file.
+ *
+ * The first line contains the names of the columns: proof, and for each
+ * reported entity x the columns x_lo and x_hi. Then there is one line per
+ * solution. The bounds are written with enough digits to be read back
+ * exactly.
+ */
+class CsvReporter : public BoxReporter {
+public:
+   /// Constructor of an empty reporter given an output stream
+   CsvReporter(std::ostream &os);
+
+   /// Constructor of a reporter on a problem given an output stream
+   CsvReporter(const Problem &p, std::ostream &os);
+
+   /// Default destructor
+   ~CsvReporter() = default;
+
+   /// Default copy constructor
+   CsvReporter(const CsvReporter &) = default;
+
+   /// No assignment
+   CsvReporter &operator=(const CsvReporter &) = delete;
+
+   /// Writes the first line, the list of entities must not be modified after
+   void start() override;
+
+   /// Writes a solution whose proof certificate is Proof::Maybe
+   void report(const DomainBox &box) override;
+
+   void report(const DomainBox &box, Proof proof) override;
+
+private:
+   std::ostream *os_; // output stream
+   bool started_;     // true if the first line has been written
+};
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Reader of binary solution files.
+ *
+ * The content of a file is loaded in memory and the solutions are accessed
+ * without any parsing. A truncated record at the end of the file, e.g. if
+ * the writer has been interrupted, is ignored.
+ */
+class SolutionReader {
+public:
+   /// Constructor
+   SolutionReader();
+
+   /// Reads a file, throws an exception in case of failure
+   void read(const std::string &filename);
+
+   /**
+    * @brief Decodes a memory buffer.
+    *
+    * @param buf input buffer including the header
+    * @param n size of the buffer in bytes
+    *
+    * Throws an exception if the buffer is not a valid solution file.
+    */
+   void decode(const char *buf, size_t n);
+
+   /// Returns the number of columns
+   size_t nbColumns() const;
+
+   /// Returns the name of the j-th column
+   std::string columnName(size_t j) const;
+
+   /// Returns the index of a column given its name, throws an exception if it
+   /// does not exist
+   size_t columnIndex(const std::string &name) const;
+
+   /// Returns the number of solutions
+   size_t nbSolutions() const;
+
+   /// Returns the proof certificate of the i-th solution
+   Proof getProof(size_t i) const;
+
+   /// Returns the domain of the j-th column in the i-th solution
+   Interval get(size_t i, size_t j) const;
+
+   /// Returns the i-th solution
+   IntervalVector getSolution(size_t i) const;
+
+private:
+   std::vector<char> buf_;          // content of the file
+   std::vector<std::string> names_; // names of the columns
+   size_t first_;                   // position of the first record in buf_
+   size_t size_;                    // size of a record in bytes
+   size_t nsol_;                    // number of solutions
+
+   // returns the position of the i-th record in buf_
+   const char *record(size_t i) const;
+};
+
+} // namespace realpaver
+
+#endif
@@ -134,6 +134,26 @@ void TermQuadratic::addLin(const Interval &a, const Variable &v)
    }
 }
 
+Interval TermQuadratic::getConstant() const
+{
+   return cst_;
+}
+
+const TermQuadratic::SquareSet &TermQuadratic::squares() const
+{
+   return sq_;
+}
+
+const TermQuadratic::BilinSet &TermQuadratic::bilins() const
+{
+   return sb_;
+}
+
+const TermQuadratic::LinSet &TermQuadratic::lins() const
+{
+   return sl_;
+}
+
 Term TermQuadratic::toTerm() const
 {
    Term t(cst_);
@@ -413,7 +433,7 @@ void TermQuadraticCreator::apply(const TermMul *t)
    }
    else if (lmul != nullptr && rcst != nullptr)
    {
-      success_ = makeProd(rcst, rmul);
+      success_ = makeProd(rcst, lmul);
    }
    else if (lmul != nullptr && rvar != nullptr)
    {
@@ -496,6 +516,11 @@ void TermQuadraticCreator::apply(const TermMax *t)
 
 void TermQuadraticCreator::apply(const TermUsb *t)
 {
+   TermQuadraticCreator vis(qt_);
+   vis.plus_ = !plus_;
+   t->child()->acceptVisitor(vis);
+
+   success_ = vis.success_;
 }
 
 void TermQuadraticCreator::apply(const TermAbs *t)
@@ -30,6 +30,59 @@ namespace realpaver {
 /// Quadratic expression
 class TermQuadratic {
 public:
+   /// Square term coef*v^2
+   struct Square {
+      Interval coef;
+      Variable v;
+   };
+
+   /// Comparator of square terms
+   struct CompSquare {
+      bool operator()(const Square &s1, const Square &s2) const
+      {
+         return s1.v.id() < s2.v.id();
+      }
+   };
+
+   /// Linear term coef*v
+   struct Lin {
+      Interval coef;
+      Variable v;
+   };
+
+   /// Comparator of linear terms
+   struct CompLin {
+      bool operator()(const Lin &l1, const Lin &l2) const
+      {
+         return l1.v.id() < l2.v.id();
+      }
+   };
+
+   /// Bilinear term coef*v1*v2 such that v1.id() < v2.id()
+   struct Bilin {
+      Interval coef;
+      Variable v1;
+      Variable v2;
+   };
+
+   /// Comparator of bilinear terms
+   struct CompBilin {
+      bool operator()(const Bilin &b1, const Bilin &b2) const
+      {
+         return (b1.v1.id() < b2.v1.id()) ||
+                ((b1.v1.id() == b2.v1.id()) && (b1.v2.id() < b2.v2.id()));
+      }
+   };
+
+   /// Type of sets of square terms
+   using SquareSet = std::set<Square, CompSquare>;
+
+   /// Type of sets of bilinear terms
+   using BilinSet = std::set<Bilin, CompBilin>;
+
+   /// Type of sets of linear terms
+   using LinSet = std::set<Lin, CompLin>;
+
    /// Constructor of a 0 term
    TermQuadratic();
 
@@ -57,6 +110,18 @@ public:
    /// Adds a linear term of the form a*v in this
    void addLin(const Interval &a, const Variable &v);
 
+   /// Returns the constant term of this
+   Interval getConstant() const;
+
+   /// Returns the set of square terms of this
+   const SquareSet &squares() const;
+
+   /// Returns the set of bilinear terms of this
+   const BilinSet &bilins() const;
+
+   /// Returns the set of linear terms of this
+   const LinSet &lins() const;
+
    /// Returns the term represented by this
    Term toTerm() const;
 
@@ -76,54 +141,10 @@ public:
    Term factorize() const;
 
 private:
-   // square term
-   struct Square {
-      Interval coef;
-      Variable v;
-   };
-
-   // comparator of square terms
-   struct CompSquare {
-      bool operator()(const Square &s1, const Square &s2) const
-      {
-         return s1.v.id() < s2.v.id();
-      }
-   };
-
-   // linear term
-   struct Lin {
-      Interval coef;
-      Variable v;
-   };
-
-   // comparator of linear term
-   struct CompLin {
-      bool operator()(const Lin &l1, const Lin &l2) const
-      {
-         return l1.v.id() < l2.v.id();
-      }
-   };
-
-   // bilinear term
-   struct Bilin {
-      Interval coef;
-      Variable v1;
-      Variable v2;
-   };
-
-   // comparator of bilinear term
-   struct CompBilin {
-      bool operator()(const Bilin &b1, const Bilin &b2) const
-      {
-         return (b1.v1.id() < b2.v1.id()) ||
-                ((b1.v1.id() == b2.v1.id()) && (b1.v2.id() < b2.v2.id()));
-      }
-   };
-
-   Interval cst_;                    // constant
-   std::set<Square, CompSquare> sq_; // square terms
-   std::set<Bilin, CompBilin> sb_;   // bilinear terms
-   std::set<Lin, CompLin> sl_;       // linear terms
+   Interval cst_; // constant
+   SquareSet sq_; // square terms
+   BilinSet sb_;  // bilinear terms
+   LinSet sl_;    // linear terms
 
    friend std::ostream &operator<<(std::ostream &os, const TermQuadratic &t);
 
@@ -78,6 +78,70 @@ void test_subset()
    TEST_TRUE(g.equals(creator.fun(1)));
 }
 
+void test_incremental()
+{
+   B->set(x, Interval(-1, 3));
+   B->set(y, Interval(-2, 2));
+   B->set(z, Interval(1, 4));
+
+   SharedDag dag = std::make_shared<Dag>();
+   dag->insert(sqr(x) + sqr(y) == 2.0);
+   dag->insert(y - sqr(x) == 0.0);
+   dag->insert(sqr(z) - 2.0 * z == 1.0);
+
+   AffineCreator creator(dag);
+   creator.useIncremental();
+   creator.create(*B);
+   size_t n = creator.nbCreatedNodes();
+
+   // no modification
+   creator.create(*B);
+   TEST_TRUE(creator.nbCreatedNodes() == n);
+
+   // modification of z only
+   B->set(z, Interval(1, 2));
+   creator.create(*B);
+   size_t m = creator.nbCreatedNodes() - n;
+   TEST_TRUE(m > 0 && m < n);
+
+   AffineCreator other(dag);
+   other.create(*B);
+   for (size_t i = 0; i < dag->nbFuns(); ++i)
+      TEST_TRUE(creator.fun(i).equals(other.fun(i)));
+
+   // modification of x
+   B->set(x, Interval(0, 1));
+   creator.create(*B);
+   other.create(*B);
+   for (size_t i = 0; i < dag->nbFuns(); ++i)
+      TEST_TRUE(creator.fun(i).equals(other.fun(i)));
+}
+
+void test_sub_incremental()
+{
+   B->set(x, Interval(-1, 3));
+   B->set(y, Interval(-2, 2));
+   B->set(z, Interval(1, 4));
+
+   SharedDag dag = std::make_shared<Dag>();
+   dag->insert(sqr(x) + sqr(y) == 2.0);
+   dag->insert(y - sqr(x) == 0.0);
+   dag->insert(sqr(z) - 2.0 * z == 1.0);
+
+   // only the nodes of the last function are handled
+   AffineCreator creator(dag, size_t(2));
+   creator.useIncremental();
+   creator.create(*B);
+   TEST_TRUE(creator.nbCreatedNodes() == dag->fun(2)->nbNodes());
+
+   AffineCreator other(dag);
+   B->set(z, Interval(1, 2));
+   creator.create(*B);
+   other.create(*B);
+   TEST_TRUE(creator.fun(0).equals(other.fun(2)));
+   TEST_TRUE(creator.fun(z).equals(other.fun(z)));
+}
+
 int main()
 {
    INIT_TEST
@@ -85,6 +149,8 @@ int main()
    TEST(test_single_occ)
    TEST(test_lin)
    TEST(test_subset)
+   TEST(test_incremental)
+   TEST(test_sub_incremental)
 
    CLEAN_TEST
    END_TEST
@@ -0,0 +1,221 @@
+#include "realpaver/BinaryModel.hpp"
+#include "realpaver/CSPSolver.hpp"
+#include "test_config.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+Problem *src;
+Variable x, y, n, b;
+
+std::string str(const Constraint &c)
+{
+   std::ostringstream os;
+   os << c;
+   return os.str();
+}
+
+void init()
+{
+   src = new Problem();
+   src->setName("binary");
+   x = src->addRealVar(-10, 10, "x");
+   y = src->addRealVar(IntervalUnion({Interval(-3, -1), Interval(1, 3)}), "y");
+   n = src->addIntVar(RangeUnion({Range(0, 2), Range(5, 9)}), "n");
+   b = src->addBinaryVar("b");
+
+   x.setTolerance(Tolerance(1.0e-6, 1.0e-8));
+   src->reportVariable(b, false);
+
+   // shared sub-term
+   Term t = sqr(x) - 2 * x * y;
+
+   src->addCtr(t + pow(n, 3) == 0);
+   src->addCtr(in(t, Interval(-1, 1)));
+   src->addCtr(sin(x) + exp(y) <= cos(n));
+   src->addCtr(table({b, n}, {0.0, 1.0, 1.0, 5.0}));
+   src->addCtr(cond(x <= 0, y >= 2));
+   src->addObjective(MAX(x + y));
+}
+
+void clean()
+{
+   delete src;
+}
+
+void test_1()
+{
+   BinaryModelWriter writer;
+   std::vector<char> buf = writer.encode(*src);
+
+   Problem dest;
+   BinaryModelReader reader;
+   reader.decode(buf.data(), buf.size(), dest);
+
+   TEST_TRUE(dest.getName() == "binary");
+   TEST_TRUE(dest.nbVars() == src->nbVars());
+   TEST_TRUE(dest.nbCtrs() == src->nbCtrs());
+   TEST_TRUE(dest.hasObjective());
+   TEST_TRUE(dest.getObjective().isMaximization());
+
+   for (size_t i = 0; i < src->nbVars(); ++i)
+   {
+      Variable v = src->varAt(i), w = dest.varAt(i);
+      TEST_TRUE(v.getName() == w.getName());
+      TEST_TRUE(v.getDomain()->equals(*w.getDomain()));
+      TEST_TRUE(v.getTolerance().getRelTol() == w.getTolerance().getRelTol());
+      TEST_TRUE(v.getTolerance().getAbsTol() == w.getTolerance().getAbsTol());
+      TEST_TRUE(src->isVarReported(v) == dest.isVarReported(w));
+   }
+
+   for (size_t i = 0; i < src->nbCtrs(); ++i)
+      TEST_TRUE(str(src->ctrAt(i)) == str(dest.ctrAt(i)));
+}
+
+void test_2()
+{
+   BinaryModelWriter writer;
+   std::vector<char> buf = writer.encode(*src);
+
+   // corrupted payload
+   buf[buf.size() - 1] ^= 1;
+
+   Problem dest;
+   BinaryModelReader reader;
+   TEST_THROW(reader.decode(buf.data(), buf.size(), dest));
+}
+
+void test_3()
+{
+   BinaryModelWriter writer;
+   std::vector<char> buf = writer.encode(*src);
+
+   // truncated buffer
+   Problem dest;
+   BinaryModelReader reader;
+   TEST_THROW(reader.decode(buf.data(), buf.size() - 8, dest));
+}
+
+// appends a number to a buffer in the byte order of the host
+void append(std::vector<char> &buf, uint64_t n)
+{
+   const char *p = reinterpret_cast<const char *>(&n);
+   buf.insert(buf.end(), p, p + sizeof(n));
+}
+
+void test_5()
+{
+   Problem prob;
+   Variable u = prob.addRealVar(-1, 1, "u"), v = prob.addRealVar(-1, 1, "v");
+   prob.addCtr(u * v == 0);
+
+   BinaryModelWriter writer;
+   std::vector<char> buf = writer.encode(prob);
+
+   // node u*v: symbol, arity and indexes of the sub-terms u and v
+   std::vector<char> node;
+   node.push_back(static_cast<char>(TermSymbol::Mul));
+   append(node, 2);
+   append(node, 0);
+   append(node, 1);
+
+   auto it = std::search(buf.begin(), buf.end(), node.begin(), node.end());
+   TEST_TRUE(it != buf.end());
+
+   // arity of a unary operation with a consistent checksum, the header
+   // being made of the magic string, the version, the size and the checksum
+   *(it + 1) = 1;
+   size_t h = 4 + sizeof(uint32_t) + 2 * sizeof(uint64_t);
+   uint64_t sum = BinaryModel::checksum(buf.data() + h, buf.size() - h);
+   std::memcpy(buf.data() + h - sizeof(uint64_t), &sum, sizeof(sum));
+
+   Problem dest;
+   BinaryModelReader reader;
+   TEST_THROW(reader.decode(buf.data(), buf.size(), dest));
+}
+
+// solves a problem and returns its solutions, fixed being the variables
+// fixed in a preprocessed problem or null
+std::vector<IntervalBox> solve(const Problem &problem, const Scope *fixed,
+                               size_t &nbnodes)
+{
+   CSPSolver solver(problem);
+   solver.getEnv()->getParams()->setStrParam("TRACE", "NO");
+   if (fixed != nullptr)
+      solver.setPreprocessed(*fixed);
+
+   solver.solve();
+   nbnodes = solver.getTotalNodes();
+
+   std::vector<IntervalBox> res;
+   for (size_t i = 0; i < solver.nbSolutions(); ++i)
+      res.push_back(IntervalBox(solver.getSolution(i).first));
+
+   return res;
+}
+
+void test_4()
+{
+   Problem prob;
+   Variable u = prob.addRealVar(-10, 10, "u"), a = prob.addRealVar(2, 2, "a"),
+            v = prob.addRealVar(-10, 10, "v"), z = prob.addRealVar(-5, 5, "z");
+
+   // a is fixed and z occurs in no constraint
+   prob.addCtr(sqr(u) + sqr(v) == a);
+   prob.addCtr(u - v == 0);
+
+   // preprocessing and round trip
+   Preprocessor preproc;
+   Problem simple;
+   preproc.apply(prob, simple);
+   TEST_TRUE(preproc.nbFixedVars() == 2);
+
+   std::string filename = "binary_model_test.rpb";
+   BinaryModel::write(prob, preproc, simple, filename);
+
+   Problem dest;
+   Scope fixed;
+   BinaryModel::read(filename, dest, fixed);
+   std::remove(filename.c_str());
+
+   TEST_TRUE(dest.nbVars() == 4);
+   TEST_TRUE(dest.nbCtrs() == simple.nbCtrs());
+   TEST_TRUE(fixed.size() == 2);
+   TEST_TRUE(fixed.contains(dest.varAt(1)) && fixed.contains(dest.varAt(3)));
+
+   for (size_t i = 0; i < prob.nbVars(); ++i)
+      TEST_TRUE(prob.varAt(i).getName() == dest.varAt(i).getName());
+
+   // same solutions and same search for the text and binary models, the
+   // binary model being not preprocessed again
+   size_t n1, n2;
+   std::vector<IntervalBox> sol1 = solve(prob, nullptr, n1),
+                            sol2 = solve(dest, &fixed, n2);
+
+   TEST_TRUE(sol1.size() == 2);
+   TEST_TRUE(sol1.size() == sol2.size());
+   TEST_TRUE(n1 == n2);
+
+   for (size_t i = 0; i < sol1.size(); ++i)
+   {
+      TEST_TRUE(sol2[i].get(dest.varAt(3)).isSetEq(Interval(-5, 5)));
+
+      for (size_t j = 0; j < prob.nbVars(); ++j)
+         TEST_TRUE(sol1[i].get(prob.varAt(j)).isSetEq(sol2[i].get(dest.varAt(j))));
+   }
+}
+
+int main()
+{
+   INIT_TEST
+
+   TEST(test_1)
+   TEST(test_2)
+   TEST(test_3)
+   TEST(test_4)
+   TEST(test_5)
+
+   CLEAN_TEST
+   END_TEST
+}
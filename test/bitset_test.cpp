@@ -115,6 +115,74 @@ void test_not()
    TEST_TRUE(b2.nbOnes() == n - 2);
 }
 
+void test_find()
+{
+   size_t n = 200, i = 0, j = 63, k = 64, l = 199;
+   Bitset b(n);
+   TEST_TRUE(b.findFirst() == b.last() + 1);
+
+   b.setOne(i);
+   b.setOne(j);
+   b.setOne(k);
+   b.setOne(l);
+
+   TEST_TRUE(b.findFirst() == (int)i);
+   TEST_TRUE(b.findNext(i) == (int)j);
+   TEST_TRUE(b.findNext(j) == (int)k);
+   TEST_TRUE(b.findNext(k) == (int)l);
+   TEST_TRUE(b.findNext(l) == b.last() + 1);
+
+   size_t nb = 0;
+   for (int m = b.findFirst(); m <= b.last(); m = b.findNext(m))
+      ++nb;
+   TEST_TRUE(nb == b.nbOnes());
+}
+
+void test_and_not()
+{
+   size_t n = 130, i = 5, j = 70, k = 129;
+   Bitset b1(n), b2(n);
+   b1.setAllOne();
+   b2.setOne(i);
+   b2.setOne(j);
+   b2.setOne(k);
+   b1.andNot(b2);
+
+   TEST_TRUE(b1.get(i) == 0);
+   TEST_TRUE(b1.get(j) == 0);
+   TEST_TRUE(b1.get(k) == 0);
+   TEST_TRUE(b1.nbOnes() == n - 3);
+}
+
+void test_shifted()
+{
+   // bitsets with different ranges of indexes
+   Bitset b1(10, 150), b2(100, 300);
+   b1.setOne(20);
+   b1.setOne(120);
+   b2.setOne(121);
+   b2.setOne(250);
+
+   TEST_FALSE(b1.overlaps(b2));
+   b2.setOne(120);
+   TEST_TRUE(b1.overlaps(b2));
+   TEST_TRUE(b2.overlaps(b1));
+
+   Bitset b3(b1 | b2);
+   TEST_TRUE(b3.first() == 10 && b3.last() == 300);
+   TEST_TRUE(b3.nbOnes() == 4);
+   TEST_TRUE(b3.get(20) && b3.get(120) && b3.get(121) && b3.get(250));
+
+   Bitset b4(b1 & b2);
+   TEST_TRUE(b4.first() == 100 && b4.last() == 150);
+   TEST_TRUE(b4.nbOnes() == 1);
+   TEST_TRUE(b4.get(120) != 0);
+
+   b3.andNot(b1);
+   TEST_TRUE(b3.nbOnes() == 2);
+   TEST_TRUE(b3.get(121) && b3.get(250));
+}
+
 int main()
 {
    TEST(test_init_1)
@@ -126,6 +194,9 @@ int main()
    TEST(test_or)
    TEST(test_overlap)
    TEST(test_not)
+   TEST(test_find)
+   TEST(test_and_not)
+   TEST(test_shifted)
 
    END_TEST
 }
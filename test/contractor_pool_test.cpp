@@ -0,0 +1,135 @@
+#include "realpaver/ContractorHC4.hpp"
+#include "realpaver/ContractorHC4Revise.hpp"
+#include "realpaver/Problem.hpp"
+#include "test_config.hpp"
+
+Problem *prob;
+SharedDag dag;
+SharedContractorPool pool;
+Variable x, y, z, u, w;
+
+void init()
+{
+   prob = new Problem();
+   x = prob->addRealVar(-10, 10, "x");
+   y = prob->addRealVar(-10, 10, "y");
+   z = prob->addRealVar(-10, 10, "z");
+   u = prob->addRealVar(-10, 10, "u");
+   w = prob->addRealVar(-10, 10, "w");
+
+   // triangular system in x, y, z and 2x2 system in u, w
+   dag = std::make_shared<Dag>();
+   dag->insert(x - 1 == 0);
+   dag->insert(x + y - 3 == 0);
+   dag->insert(y * z - 4 == 0);
+   dag->insert(u + w - 2 == 0);
+   dag->insert(u - w == 0);
+
+   pool = std::make_shared<ContractorPool>();
+   for (size_t i = 0; i < dag->nbFuns(); ++i)
+      pool->push(std::make_shared<ContractorHC4Revise>(dag, i));
+}
+
+void clean()
+{
+   delete prob;
+}
+
+void test_components()
+{
+   std::vector<size_t> comp;
+   size_t nc = pool->makeComponents(comp);
+
+   TEST_TRUE(nc == 2);
+   TEST_TRUE(comp[0] == comp[1] && comp[1] == comp[2]);
+   TEST_TRUE(comp[3] == comp[4]);
+   TEST_TRUE(comp[0] != comp[3]);
+}
+
+void test_blocks()
+{
+   std::vector<size_t> block;
+   size_t nb = pool->makeBlocks(block);
+
+   TEST_TRUE(nb == 4);
+   TEST_TRUE(block[0] < block[1]);
+   TEST_TRUE(block[1] < block[2]);
+   TEST_TRUE(block[3] == block[4]);
+}
+
+void test_propagation()
+{
+   IntervalBox B(prob->scope());
+
+   IntervalPropagator fifo(pool);
+   fifo.contract(B);
+
+   IntervalPropagator blocks(pool);
+   blocks.setScheduling(PropagationScheduling::Blocks);
+   blocks.setNbThreads(2);
+   IntervalBox C(prob->scope());
+   blocks.contract(C);
+
+   TEST_TRUE(B.get(x).contains(1.0));
+   TEST_TRUE(B.get(y).contains(2.0));
+   TEST_TRUE(B.get(z).contains(2.0));
+
+   for (const auto &v : prob->scope())
+   {
+      TEST_TRUE(C.get(v).contains(B.get(v)) && B.get(v).contains(C.get(v)));
+   }
+}
+
+void test_threads()
+{
+   // two chains of 40 equations, i.e. enough contractors per thread
+   Problem pb;
+   SharedDag chains = std::make_shared<Dag>();
+   for (size_t c = 0; c < 2; ++c)
+   {
+      Variable prev = pb.addRealVar(-10, 10);
+      chains->insert(prev - 0.5 == 0);
+      for (size_t i = 1; i < 40; ++i)
+      {
+         Variable v = pb.addRealVar(-10, 10);
+         chains->insert(v - 0.5 * sqr(prev) == 0);
+         prev = v;
+      }
+   }
+
+   SharedContractorPool cp = std::make_shared<ContractorPool>();
+   for (size_t i = 0; i < chains->nbFuns(); ++i)
+      cp->push(std::make_shared<ContractorHC4Revise>(chains, i));
+
+   IntervalPropagator seq(cp), par(cp);
+   par.setNbThreads(2);
+
+   // the threads are reused from one propagation to the next one and they
+   // are not shared by a copy
+   for (size_t k = 0; k < 3; ++k)
+   {
+      IntervalBox B(pb.scope()), C(pb.scope());
+      seq.contract(B);
+      par.contract(C);
+      TEST_TRUE(B.equals(C));
+
+      IntervalPropagator copy(par);
+      IntervalBox D(pb.scope());
+      copy.contract(D);
+      TEST_TRUE(B.equals(D));
+   }
+   TEST_TRUE(seq.nbCalls() == par.nbCalls());
+}
+
+int main()
+{
+   INIT_TEST
+
+   TEST(test_components)
+   TEST(test_blocks)
+   TEST(test_propagation)
+   TEST(test_threads)
+
+   CLEAN_TEST
+   END_TEST
+}
@@ -0,0 +1,126 @@
+#include "realpaver/CSPSolver.hpp"
+#include "test_config.hpp"
+
+Problem *prob;
+Variable x, y, z;
+
+void init()
+{
+   prob = new Problem();
+   x = prob->addRealVar(-10, 10, "x");
+   y = prob->addRealVar(-10, 10, "y");
+   z = prob->addRealVar(0, 1, "z");
+
+   // two independent components with two solutions each, z being free
+   prob->addCtr(sqr(x) == 1);
+   prob->addCtr(sqr(y) - y == 2);
+}
+
+void clean()
+{
+   delete prob;
+}
+
+void test_components()
+{
+   CSPDecomposition decomp(*prob);
+
+   TEST_TRUE(decomp.nbComponents() == 2);
+   TEST_TRUE(decomp.getSubProblem(0).nbVars() == 1);
+   TEST_TRUE(decomp.getSubProblem(1).nbVars() == 1);
+}
+
+void test_product()
+{
+   CSPSolver solver(*prob);
+   solver.getEnv()->getParams()->setStrParam("BP_DECOMPOSITION", "PRODUCT");
+   solver.solve();
+
+   TEST_TRUE(solver.getDecomposition() != nullptr);
+   TEST_TRUE(solver.nbSolutions() == 4);
+   TEST_TRUE(solver.nbPendingNodes() == 0);
+
+   size_t nx = 0, ny = 0;
+   for (size_t i = 0; i < solver.nbSolutions(); ++i)
+   {
+      std::pair<DomainBox, Proof> sol = solver.getSolution(i);
+      IntervalBox B(sol.first);
+
+      if (B.get(x).contains(1.0))
+         ++nx;
+      if (B.get(y).contains(2.0))
+         ++ny;
+
+      TEST_TRUE(B.get(x).contains(1.0) || B.get(x).contains(-1.0));
+      TEST_TRUE(B.get(y).contains(2.0) || B.get(y).contains(-1.0));
+      TEST_TRUE(B.get(z).isSetEq(Interval(0.0, 1.0)));
+   }
+
+   TEST_TRUE(nx == 2 && ny == 2);
+}
+
+void test_component()
+{
+   Problem pb;
+   Variable u = pb.addRealVar(-10, 10, "u"), a = pb.addRealVar(2, 2, "a"),
+            v = pb.addRealVar(-10, 10, "v");
+   pb.addCtr(sqr(u) == a);
+   pb.addCtr(sqr(v) == 1);
+
+   CSPSolver solver(pb);
+   solver.getEnv()->getParams()->setStrParam("BP_DECOMPOSITION", "PRODUCT");
+   solver.solve();
+
+   TEST_TRUE(solver.getDecomposition() != nullptr);
+   TEST_TRUE(solver.getDecomposition()->nbComponents() == 2);
+
+   // a is fixed at preprocessing time and restored in the solutions
+   for (size_t k = 0; k < 2; ++k)
+   {
+      Scope scop = solver.getComponentScope(k);
+      TEST_TRUE(scop.size() == 1);
+      TEST_FALSE(scop.contains(a));
+
+      for (size_t i = 0; i < solver.getDecomposition()->nbComponentSolutions(k); ++i)
+      {
+         std::pair<DomainBox, Proof> sol = solver.getComponentSolution(k, i);
+         IntervalBox B(sol.first);
+
+         TEST_TRUE(B.get(a).isSetEq(Interval(2.0)));
+         Variable other = scop.contains(u) ? v : u;
+         TEST_TRUE(B.get(other).isSetEq(Interval(-10, 10)));
+      }
+   }
+}
+
+void test_limits()
+{
+   Problem pb;
+   Variable u = pb.addRealVar(-100, 100, "u"), v = pb.addRealVar(-100, 100, "v");
+   pb.addCtr(sin(u) == 0);
+   pb.addCtr(sin(v) == 0);
+
+   CSPSolver solver(pb);
+   solver.getEnv()->getParams()->setStrParam("BP_DECOMPOSITION", "PRODUCT");
+   solver.getEnv()->getParams()->setIntParam("NODE_LIMIT", 40);
+   solver.solve();
+
+   // the node limit is shared by the components, every solver stopping
+   // when the number of nodes exceeds its limit
+   TEST_TRUE(solver.getDecomposition() != nullptr);
+   TEST_TRUE(solver.getTotalNodes() <= 40 + 2);
+   TEST_TRUE(solver.getEnv()->usedNodeLimit());
+}
+
+int main()
+{
+   INIT_TEST
+
+   TEST(test_components)
+   TEST(test_product)
+   TEST(test_component)
+   TEST(test_limits)
+
+   CLEAN_TEST
+   END_TEST
+}
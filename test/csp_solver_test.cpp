@@ -0,0 +1,213 @@
+#include "realpaver/CSPSolver.hpp"
+#include "test_config.hpp"
+
+Problem *prob;
+Variable x, y, p;
+
+void init()
+{
+   prob = new Problem();
+   x = prob->addRealVar(-10, 10, "x");
+   y = prob->addRealVar(-10, 10, "y");
+   p = prob->addRealVar(-1, 1, "p");
+
+   // intersection of a circle and a line parameterized by p
+   prob->addCtr(sqr(x) + sqr(y) == 4);
+   prob->addCtr(x - y == p);
+}
+
+void clean()
+{
+   delete prob;
+}
+
+// checks that every solution of the solver encloses one of the two
+// intersection points of the circle and the line for the given value of p
+bool checkSolutions(const CSPSolver &solver, double a)
+{
+   double d = sqrt(Interval(8.0 - a * a)).midpoint();
+   Interval x1((a + d) / 2.0), x2((a - d) / 2.0);
+   size_t n1 = 0, n2 = 0;
+
+   for (size_t i = 0; i < solver.nbSolutions(); ++i)
+   {
+      IntervalBox B(solver.getSolution(i).first);
+
+      if (B.get(x).distance(x1) <= 1.0e-6)
+         ++n1;
+
+      else if (B.get(x).distance(x2) <= 1.0e-6)
+         ++n2;
+
+      else
+         return false;
+
+      if (!B.get(p).isSetEq(Interval(a)))
+         return false;
+   }
+
+   return n1 > 0 && n2 > 0;
+}
+
+void test_sweep()
+{
+   CSPSolver solver(*prob);
+   solver.getEnv()->getParams()->setStrParam("PREPROCESSING", "NO");
+
+   for (double a : {0.0, 0.5, 1.0})
+   {
+      DomainBox region(Scope({p}));
+      region.set(p, std::make_unique<IntervalDomain>(Interval(a)));
+
+      solver.solve(region);
+
+      TEST_TRUE(solver.hasReusedModel() == (a > 0.0));
+      TEST_TRUE(checkSolutions(solver, a));
+
+      // the startup times are those of the last solving
+      TEST_TRUE(!solver.hasReusedModel() || solver.getModelTime() == 0.0);
+
+      // same solving by a new solver
+      CSPSolver fresh(*prob);
+      fresh.getEnv()->getParams()->setStrParam("PREPROCESSING", "NO");
+      fresh.solve(region);
+
+      TEST_TRUE(solver.nbSolutions() == fresh.nbSolutions());
+      TEST_TRUE(solver.getTotalNodes() == fresh.getTotalNodes());
+   }
+
+   // the variables of the input problem are not modified
+   TEST_TRUE(p.getDomain()->intervalHull().isSetEq(Interval(-1, 1)));
+}
+
+void test_region()
+{
+   Problem pb;
+   Variable u = pb.addRealVar(-10, 10, "u"), v = pb.addRealVar(-10, 10, "v");
+   pb.addCtr(sqr(u) + sqr(v) == 4);
+   pb.addCtr(u - v == 0);
+
+   CSPSolver solver(pb);
+
+   DomainBox region(Scope({u}));
+   region.set(u, std::make_unique<IntervalDomain>(Interval(0, 10)));
+   solver.solve(region);
+
+   TEST_FALSE(solver.hasReusedModel());
+   TEST_TRUE(solver.nbSolutions() == 1);
+
+   // same simplified problem with new domains
+   region.set(u, std::make_unique<IntervalDomain>(Interval(-10, 10)));
+   solver.solve(region);
+
+   TEST_TRUE(solver.hasReusedModel());
+   TEST_TRUE(solver.nbSolutions() == 2);
+
+   for (size_t i = 0; i < solver.nbSolutions(); ++i)
+   {
+      IntervalBox B(solver.getSolution(i).first);
+      TEST_TRUE(B.get(u).distance(Interval(sqrt(2.0))) <= 1.0e-6 ||
+                B.get(u).distance(Interval(-sqrt(2.0))) <= 1.0e-6);
+   }
+}
+
+void test_fixed()
+{
+   CSPSolver solver(*prob);
+
+   for (double a : {0.0, 1.0})
+   {
+      DomainBox region(Scope({p}));
+      region.set(p, std::make_unique<IntervalDomain>(Interval(a)));
+
+      // p is replaced by its value in the simplified problem
+      solver.solve(region);
+
+      TEST_FALSE(solver.hasReusedModel());
+      TEST_TRUE(solver.getPreprocessor()->hasFixedDomain(p));
+      TEST_TRUE(checkSolutions(solver, a));
+   }
+}
+
+void test_eager()
+{
+   Problem pb;
+   Variable u = pb.addRealVar(-20, 20, "u"), v = pb.addRealVar(-20, 20, "v");
+   pb.addCtr(sin(u) + 0.001 * v == 0);
+   pb.addCtr(v - cos(u) == 0);
+
+   // certification after the search and during the search with solution
+   // nodes copied by the space due to the domain trail
+   CSPSolver lazy(pb), eager(pb);
+   for (CSPSolver *solver : {&lazy, &eager})
+   {
+      Params *prm = solver->getEnv()->getParams();
+      prm->setStrParam("BP_DOMAIN_TRAIL", "YES");
+      prm->setDblParam("SOLUTION_CLUSTER_GAP", -1.0);
+      prm->setIntParam("NB_THREADS", 2);
+   }
+   lazy.getEnv()->getParams()->setStrParam("CERTIFICATION", "YES");
+   eager.getEnv()->getParams()->setStrParam("CERTIFICATION", "EAGER");
+
+   lazy.solve();
+   eager.solve();
+
+   TEST_TRUE(lazy.nbSolutions() > 1);
+   TEST_TRUE(lazy.nbSolutions() == eager.nbSolutions());
+
+   for (size_t i = 0; i < lazy.nbSolutions(); ++i)
+   {
+      std::pair<DomainBox, Proof> s = lazy.getSolution(i), t = eager.getSolution(i);
+      TEST_TRUE(s.second == t.second);
+      TEST_TRUE(IntervalBox(s.first).equals(IntervalBox(t.first)));
+   }
+}
+
+void test_stream()
+{
+   CSPSolver solver(*prob);
+   Params *prm = solver.getEnv()->getParams();
+   prm->setStrParam("CERTIFICATION", "NO");
+   prm->setDblParam("SOLUTION_CLUSTER_GAP", -1.0);
+
+   std::vector<IntervalBox> boxes;
+   solver.setSolutionCallback([&](const DomainBox &box, Proof proof)
+                              { boxes.push_back(IntervalBox(box)); });
+
+   // solutions of the input problem written during the search
+   DomainBox region(Scope({p}));
+   region.set(p, std::make_unique<IntervalDomain>(Interval(0.5)));
+   solver.solve(region);
+
+   TEST_TRUE(solver.hasStreamedSolutions());
+   TEST_TRUE(checkSolutions(solver, 0.5));
+   TEST_TRUE(boxes.size() == solver.nbSolutions());
+
+   for (const IntervalBox &B : boxes)
+   {
+      TEST_TRUE(B.scope().contains(p));
+      TEST_TRUE(B.get(p).isSetEq(Interval(0.5)));
+   }
+
+   // no streaming if the solutions are certified after the search
+   boxes.clear();
+   prm->setStrParam("CERTIFICATION", "YES");
+   solver.solve(region);
+
+   TEST_FALSE(solver.hasStreamedSolutions());
+   TEST_TRUE(boxes.empty());
+}
+
+int main()
+{
+   INIT_TEST
+
+   TEST(test_sweep)
+   TEST(test_region)
+   TEST(test_fixed)
+   TEST(test_eager)
+   TEST(test_stream)
+
+   CLEAN_TEST
+   END_TEST
+}
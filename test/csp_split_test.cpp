@@ -0,0 +1,135 @@
+#include "realpaver/CSPSplit.hpp"
+#include "realpaver/DomainSlicerFactory.hpp"
+#include "realpaver/Problem.hpp"
+#include "test_config.hpp"
+
+Problem *prob;
+Variable x, y;
+
+void init()
+{
+   prob = new Problem();
+   x = prob->addRealVar(-1, 1, "x");
+   y = prob->addRealVar(-1, 1, "y");
+}
+
+void clean()
+{
+   delete prob;
+}
+
+// applies a slicer to a domain and returns the slices
+std::vector<Interval> slices(DomainSlicer &slicer, Domain *dom)
+{
+   std::vector<Interval> res;
+   slicer.apply(dom);
+
+   auto it = slicer.begin();
+   while (it != slicer.end())
+      res.push_back(slicer.next(it)->intervalHull());
+
+   return res;
+}
+
+// returns true if the slices are consecutive and cover x
+bool covers(const std::vector<Interval> &v, const Interval &x)
+{
+   if (v.empty() || v.front().left() != x.left() || v.back().right() != x.right())
+      return false;
+
+   for (size_t i = 1; i < v.size(); ++i)
+      if (v[i - 1].right() != v[i].left())
+         return false;
+
+   return true;
+}
+
+void test_interval()
+{
+   IntervalDomain dom(Interval(0.0, 8.0));
+
+   IntervalDomainPartitioner kway(4, 0.5);
+   std::vector<Interval> v = slices(kway, &dom);
+   TEST_TRUE(v.size() == 4);
+   TEST_TRUE(covers(v, Interval(0.0, 8.0)));
+
+   // bisection at the splitting point
+   IntervalDomainPartitioner bi(2, 0.25);
+   v = slices(bi, &dom);
+   TEST_TRUE(v.size() == 2);
+   TEST_TRUE(v[0].distance(Interval(0.0, 2.0)) <= 1.0e-12);
+   TEST_TRUE(covers(v, Interval(0.0, 8.0)));
+
+   // bisection of an unbounded interval
+   IntervalDomain inf(Interval::moreThan(0.0));
+   v = slices(kway, &inf);
+   TEST_TRUE(v.size() == 2);
+   TEST_TRUE(covers(v, Interval::moreThan(0.0)));
+}
+
+void test_union()
+{
+   IntervalUnionDomain dom(
+       {Interval(0.0, 1.0), Interval(2.0, 3.0), Interval(4.0, 5.0), Interval(6.0, 7.0)});
+
+   // split along the holes, the first parts having one more element
+   IntervalUnionDomainPartitioner three(3, 0.5);
+   three.apply(&dom);
+
+   std::vector<size_t> sizes;
+   auto it = three.begin();
+   while (it != three.end())
+   {
+      std::unique_ptr<Domain> d = three.next(it);
+      sizes.push_back(static_cast<IntervalUnionDomain *>(d.get())->getVal().size());
+   }
+   TEST_TRUE(sizes == std::vector<size_t>({2, 1, 1}));
+
+   // at most one part per element
+   IntervalUnionDomainPartitioner many(6, 0.5);
+   std::vector<Interval> v = slices(many, &dom);
+   TEST_TRUE(v.size() == 4);
+   TEST_TRUE(v[3].isSetEq(Interval(6.0, 7.0)));
+
+   // one element divided as an interval
+   IntervalUnionDomain one({Interval(0.0, 3.0)});
+   v = slices(three, &one);
+   TEST_TRUE(v.size() == 3);
+   TEST_TRUE(covers(v, Interval(0.0, 3.0)));
+}
+
+// number of sub-nodes generated by a SSR split with an adaptive arity
+size_t nbSubNodes(Term t, size_t kmax)
+{
+   CSPSplitSSR split(prob->scope(), DomainSlicerFactory::makeKWayStrategy(kmax, 0.5),
+                     IntervalFunctionVector({t}));
+   split.setMaxArity(kmax);
+
+   SharedCSPNode node = SharedCSPNode::make(prob->scope());
+   CSPContext context;
+   split.apply(node, context);
+
+   return split.getNbNodes();
+}
+
+void test_arity()
+{
+   // x concentrates the smear, hence the maximum arity
+   TEST_TRUE(nbSubNodes(x + 1.0e-4 * y, 4) == 4);
+
+   // same share for x and y
+   TEST_TRUE(nbSubNodes(x + y, 4) == 3);
+   TEST_TRUE(nbSubNodes(x + y, 2) == 2);
+}
+
+int main()
+{
+   INIT_TEST
+
+   TEST(test_interval)
+   TEST(test_union)
+   TEST(test_arity)
+
+   CLEAN_TEST
+   END_TEST
+}
@@ -0,0 +1,178 @@
+#include "realpaver/CSPSolver.hpp"
+#include "realpaver/CSPTrace.hpp"
+#include "test_config.hpp"
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+
+std::string path;
+
+void init()
+{
+   path = "csp_trace_test.rpt";
+}
+
+void clean()
+{
+   std::remove(path.c_str());
+}
+
+void test_write_read()
+{
+   // more rows than one chunk
+   const int n = CSPTrace::CHUNK_SIZE + 10;
+
+   Problem p;
+   Variable x = p.addRealVar(0, 1, "x");
+   CSPNode node(p.scope());
+
+   {
+      CSPTrace trace(path);
+      trace.defineVar(x.id(), "x");
+      trace.defineStage("HC4");
+      trace.defineStage("Newton");
+
+      for (int i = 0; i < n; ++i)
+      {
+         node.setIndex(i);
+         node.setParent(i == 0 ? -1 : (i - 1) / 2);
+         node.setDepth(i == 0 ? 0 : 1);
+
+         trace.beginNode(node);
+         trace.setStage(0, 2.0, 1.0, 0.5, Proof::Maybe);
+         if (i % 2 == 0)
+            trace.setStage(1, 1.0, 0.0, 0.25, Proof::Empty);
+         trace.setProof(i % 2 == 0 ? Proof::Empty : Proof::Maybe);
+         trace.endNode(i % 2 == 0 ? CSPTraceStatus::Empty : CSPTraceStatus::Split,
+                       i % 2 == 0 ? -1 : x.id());
+      }
+      TEST_TRUE(trace.nbNodes() == n);
+   }
+
+   CSPTraceReader reader;
+   reader.read(path);
+   TEST_TRUE(reader.nbNodes() == n);
+   TEST_TRUE(reader.nbStages() == 2);
+   TEST_TRUE(reader.stageName(1) == "Newton");
+   TEST_TRUE(reader.varName(x.id()) == "x");
+
+   bool ok = true;
+   for (int i = 0; i < n; ++i)
+   {
+      bool even = (i % 2 == 0);
+      if (reader.index(i) != i || reader.parent(i) != (i == 0 ? -1 : (i - 1) / 2) ||
+          reader.status(i) != (even ? CSPTraceStatus::Empty : CSPTraceStatus::Split) ||
+          reader.splitVar(i) != (even ? -1 : (int)x.id()) ||
+          reader.stageBefore(0, i) != 2.0 || reader.stageAfter(0, i) != 1.0 ||
+          reader.stageApplied(1, i) != even || reader.time(i) < 0.0)
+         ok = false;
+   }
+   TEST_TRUE(ok);
+
+   // binary tree of n nodes
+   std::vector<size_t> sz = reader.subtreeSizes();
+   TEST_TRUE(sz[0] == n);
+   TEST_TRUE(sz[n - 1] == 1);
+   TEST_TRUE(sz[1] + sz[2] + 1 == n);
+
+   std::ostringstream os;
+   reader.summarize(os, 1, 2);
+   TEST_TRUE(os.str().find("Hot subtrees at depth 1") != std::string::npos);
+   TEST_TRUE(os.str().find("Newton") != std::string::npos);
+}
+
+void test_solver()
+{
+   Problem p;
+   Variable x = p.addRealVar(-10, 10, "x"), y = p.addRealVar(-10, 10, "y");
+   p.addCtr(sqr(x) + sqr(y) == 1);
+   p.addCtr(y - sqr(x) == 0);
+
+   CSPSolver solver(p);
+   solver.getEnv()->getParams()->setStrParam("TRACE", "NO");
+   solver.getEnv()->getParams()->setDblParam("SOLUTION_CLUSTER_GAP", -1.0);
+   solver.getEnv()->getParams()->setStrParam("PROPAGATION_WITH_ACID", "NO");
+   solver.getEnv()->getParams()->setStrParam("PROPAGATION_WITH_POLYTOPE_HULL", "NO");
+   solver.getEnv()->getParams()->setStrParam("PROPAGATION_WITH_NEWTON", "YES");
+   solver.setSearchTrace(path);
+   solver.solve();
+
+   CSPTraceReader reader;
+   reader.read(path);
+   TEST_TRUE(reader.nbNodes() > 1);
+   TEST_TRUE(reader.nbStages() == 2);
+   TEST_TRUE(reader.stageName(0) == "HC4");
+   TEST_TRUE(reader.stageName(1) == "Newton");
+   TEST_TRUE(reader.index(0) == 0 && reader.depth(0) == 0);
+
+   size_t nbsol = 0, nbsplit = 0;
+   for (size_t i = 0; i < reader.nbNodes(); ++i)
+   {
+      if (reader.status(i) == CSPTraceStatus::Solution)
+         ++nbsol;
+      if (reader.status(i) == CSPTraceStatus::Split)
+      {
+         ++nbsplit;
+         TEST_TRUE(reader.splitVar(i) == (int)x.id() || reader.splitVar(i) == (int)y.id());
+      }
+   }
+   TEST_TRUE(nbsol == solver.nbSolutions());
+   TEST_TRUE(nbsplit > 0);
+   TEST_TRUE(reader.subtreeSizes()[0] == reader.nbNodes());
+}
+
+void test_unbounded()
+{
+   Problem p;
+   Variable x = p.addRealVar(-10, 10, "x"), y = p.addRealVar(Interval::universe(), "y");
+   p.addCtr(sqr(x) + sqr(y) == 1);
+   p.addCtr(y - x == 0);
+
+   CSPSolver solver(p);
+   solver.getEnv()->getParams()->setStrParam("PREPROCESSING", "NO");
+   solver.getEnv()->getParams()->setStrParam("PROPAGATION_WITH_ACID", "NO");
+   solver.getEnv()->getParams()->setStrParam("PROPAGATION_WITH_POLYTOPE_HULL", "NO");
+   solver.setSearchTrace(path);
+   solver.solve();
+
+   CSPTraceReader reader;
+   reader.read(path);
+
+   // y is unbounded before the first stage at the root node, hence only
+   // the width of x is taken into account
+   TEST_TRUE(reader.stageBefore(0, 0) < 21.0);
+
+   bool ok = true;
+   for (size_t i = 0; i < reader.nbNodes(); ++i)
+      for (size_t s = 0; s < reader.nbStages(); ++s)
+         if (reader.stageApplied(s, i))
+         {
+            double before = reader.stageBefore(s, i), after = reader.stageAfter(s, i);
+            if (!std::isfinite(before) || !std::isfinite(after) || after > before)
+               ok = false;
+         }
+   TEST_TRUE(ok);
+}
+
+void test_bad_file()
+{
+   FILE *f = std::fopen(path.c_str(), "w");
+   std::fputs("RPEL", f);
+   std::fclose(f);
+
+   CSPTraceReader reader;
+   TEST_THROW(reader.read(path));
+}
+
+int main()
+{
+   INIT_TEST
+
+   TEST(test_write_read)
+   TEST(test_solver)
+   TEST(test_unbounded)
+   TEST(test_bad_file)
+
+   CLEAN_TEST
+   END_TEST
+}
@@ -160,6 +160,82 @@ void brown_5_infeasible()
    TEST_TRUE(proof == Proof::Empty);
 }
 
+void brown_5_parallel()
+{
+   Problem prob;
+   Variable x1 = prob.addRealVar(0, 0, "x1"), x2 = prob.addRealVar(0, 0, "x2"),
+            x3 = prob.addRealVar(0, 0, "x3"), x4 = prob.addRealVar(0, 0, "x4"),
+            x5 = prob.addRealVar(0, 0, "x5");
+
+   std::shared_ptr<Dag> dag = std::make_shared<Dag>();
+   dag->insert(2 * x1 + x2 + x3 + x4 + x5 - 6 == 0);
+   dag->insert(x1 + 2 * x2 + x3 + x4 + x5 - 6 == 0);
+   dag->insert(x1 + x2 + 2 * x3 + x4 + x5 - 6 == 0);
+   dag->insert(x1 + x2 + x3 + 2 * x4 + x5 - 6 == 0);
+   dag->insert(x1 * x2 * x3 * x4 * x5 - 1 == 0);
+
+   std::unique_ptr<LinearizerTaylor> lzr = std::make_unique<LinearizerTaylor>(dag);
+
+   Bitset corner({0, 1, 0, 1, 0});
+   lzr->fixCorner(corner, true);
+   ContractorPolytope ctc(std::move(lzr));
+   ctc.setNbThreads(3);
+
+   IntervalBox B(prob.scope());
+   B.set(x1, Interval(-10, 10));
+   B.set(x2, Interval(-10, 10));
+   B.set(x3, Interval(-10, 10));
+   B.set(x4, Interval(-10, 10));
+   B.set(x5, Interval(-10, 10));
+
+   Proof proof = ctc.contract(B);
+   TEST_TRUE(proof != Proof::Empty);
+
+   Interval I("-0.8", "3.2");
+   TEST_TRUE(I.distance(B.get(x1)) < 1.0e-8);
+   TEST_TRUE(B.get(x1).contains(I));
+   TEST_TRUE(I.distance(B.get(x4)) < 1.0e-8);
+   TEST_TRUE(B.get(x4).contains(I));
+   TEST_TRUE(B.get(x5).isSetEq(Interval(-10, 10)));
+
+   // at most two LPs per variable
+   TEST_TRUE(ctc.nbSolvedLPs() + ctc.nbSkippedLPs() <= 10);
+}
+
+void quadratic()
+{
+   Problem prob;
+   Variable x = prob.addRealVar(0, 0, "x"), y = prob.addRealVar(0, 0, "y");
+
+   std::shared_ptr<Dag> dag = std::make_shared<Dag>();
+   dag->insert(y - sqr(x) >= 0);
+   dag->insert(y + sqr(x) - 2 <= 0);
+
+   std::vector<Term> terms = {y - sqr(x), y + sqr(x) - 2};
+   std::unique_ptr<LinearizerQuadratic> lzr =
+       std::make_unique<LinearizerQuadratic>(dag, terms);
+
+   TEST_TRUE(lzr->quadraticFuns().size() == 2);
+   TEST_TRUE(lzr->otherFuns().empty());
+   TEST_TRUE(lzr->nbProducts() == 1);
+
+   ContractorPolytope ctc(std::move(lzr));
+
+   IntervalBox B(prob.scope());
+   B.set(x, Interval(-2, 1));
+   B.set(y, Interval(-1, 2));
+
+   Proof proof = ctc.contract(B);
+   TEST_TRUE(proof != Proof::Empty);
+
+   Interval resx(-1.25, 1), resy(0, 2);
+
+   TEST_TRUE(B.get(x).contains(resx));
+   TEST_TRUE(resx.distance(B.get(x)) < 1.0e-8);
+   TEST_TRUE(B.get(y).contains(resy));
+   TEST_TRUE(resy.distance(B.get(y)) < 1.0e-8);
+}
+
 int main()
 {
    INIT_TEST
@@ -168,6 +244,8 @@ int main()
    TEST(test_2)
    TEST(brown_5_feasible)
    TEST(brown_5_infeasible)
+   TEST(brown_5_parallel)
+   TEST(quadratic)
 
    CLEAN_TEST
    END_TEST
@@ -36,12 +36,72 @@ void test_2()
    TEST_TRUE(dag->varNode(2)->parArity() == 1);
 }
 
+void test_3()
+{
+   Scope scop = dag->scope();
+   IntervalBox B(scop);
+   B.set(scop.var(0), Interval(1, 2));
+   B.set(scop.var(1), Interval(-1, 3));
+   B.set(scop.var(2), Interval(0, 1));
+
+   IntervalMatrix J(3, 3);
+   dag->iDiff(B, J);
+
+   IntervalMatrix K({{Interval(-4, -2), Interval(1.0), Interval(0.0)},
+                     {Interval(2, 4), Interval(-2, 6), Interval(0.0)},
+                     {Interval(2, 4), Interval(-2, 6), Interval(-1.0)}});
+
+   for (size_t i = 0; i < 3; ++i)
+      for (size_t j = 0; j < 3; ++j)
+         TEST_TRUE(J.get(i, j).isSetEq(K.get(i, j)));
+}
+
+void test_4()
+{
+   Scope scop = dag->scope();
+   IntervalBox B(scop);
+   B.set(scop.var(0), Interval(1, 2));
+   B.set(scop.var(1), Interval(-1, 3));
+   B.set(scop.var(2), Interval(0, 1));
+
+   RealPoint c(scop);
+   c.set(scop.var(0), 1.5);
+   c.set(scop.var(1), 0.0);
+   c.set(scop.var(2), 0.5);
+
+   IntervalMatrix H(3, 3);
+   dag->iDiffHansen(B, c, H);
+
+   // compares with the Hansen derivatives of each function
+   for (size_t i = 0; i < 3; ++i)
+   {
+      DagFun *f = dag->fun(i);
+      IntervalVector G(f->nbVars());
+      f->iDiffHansen(B, c, G);
+
+      for (size_t j = 0; j < 3; ++j)
+      {
+         Variable v = scop.var(j);
+         if (f->dependsOn(v))
+         {
+            TEST_TRUE(H.get(i, j).isSetEq(G[f->scope().index(v)]));
+         }
+         else
+         {
+            TEST_TRUE(H.get(i, j).isZero());
+         }
+      }
+   }
+}
+
 int main()
 {
    INIT_TEST
 
    TEST(test_1)
    TEST(test_2)
+   TEST(test_3)
+   TEST(test_4)
 
    CLEAN_TEST
    END_TEST
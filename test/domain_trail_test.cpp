@@ -0,0 +1,87 @@
+#include "realpaver/DomainTrail.hpp"
+#include "realpaver/Problem.hpp"
+#include "test_config.hpp"
+
+Problem *prob;
+Variable x, y, z;
+
+void init()
+{
+   prob = new Problem();
+   x = prob->addRealVar(-10, 10, "x");
+   y = prob->addRealVar(IntervalUnion({Interval(-3, -1), Interval(1, 3)}), "y");
+   z = prob->addIntVar(0, 9, "z");
+}
+
+void clean()
+{
+   delete prob;
+}
+
+void test_undo()
+{
+   DomainBox box(prob->scope());
+   DomainTrail trail;
+   trail.attach(&box);
+
+   size_t m0 = trail.mark();
+   trail.assign(x, std::make_unique<IntervalDomain>(Interval(0, 5)));
+   trail.save(z);
+   box.get(z)->contract(Interval(2, 4));
+
+   size_t m1 = trail.mark();
+   trail.assign(x, std::make_unique<IntervalDomain>(Interval(1, 2)));
+   trail.save(y);
+   box.get(y)->contract(Interval(0, 5));
+
+   TEST_TRUE(trail.mark() == 4);
+   TEST_TRUE(box.get(x)->intervalHull().isSetEq(Interval(1, 2)));
+   TEST_TRUE(box.get(y)->intervalHull().isSetEq(Interval(1, 3)));
+
+   trail.undo(m1);
+   TEST_TRUE(trail.mark() == m1);
+   TEST_TRUE(box.get(x)->intervalHull().isSetEq(Interval(0, 5)));
+   TEST_TRUE(box.get(y)->intervalHull().isSetEq(Interval(-3, 3)));
+   TEST_TRUE(box.get(z)->intervalHull().isSetEq(Interval(2, 4)));
+
+   trail.undo(m0);
+   TEST_TRUE(trail.mark() == 0);
+   TEST_TRUE(trail.maxSize() == 4);
+
+   DomainBox init(prob->scope());
+   TEST_TRUE(box.equals(init));
+}
+
+void test_restore()
+{
+   DomainBox box(prob->scope());
+   DomainTrail trail;
+   trail.attach(&box);
+
+   trail.assign(x, std::make_unique<IntervalDomain>(Interval(0, 5)));
+   size_t m = trail.mark();
+   trail.assign(x, std::make_unique<IntervalDomain>(Interval(1, 2)));
+   trail.save(z);
+   box.get(z)->contract(Interval(7, 8));
+
+   std::unique_ptr<DomainBox> copy(box.clone());
+   trail.restore(*copy, m);
+
+   // the box and the trail are not modified
+   TEST_TRUE(trail.mark() == 3);
+   TEST_TRUE(box.get(x)->intervalHull().isSetEq(Interval(1, 2)));
+
+   trail.undo(m);
+   TEST_TRUE(copy->equals(box));
+}
+
+int main()
+{
+   INIT_TEST
+
+   TEST(test_undo)
+   TEST(test_restore)
+
+   CLEAN_TEST
+   END_TEST
+}
@@ -0,0 +1,139 @@
+#include "realpaver/EventLog.hpp"
+#include "realpaver/Interval.hpp"
+#include "test_config.hpp"
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+std::string path;
+
+void init()
+{
+   path = "event_log_test.rpl";
+}
+
+void clean()
+{
+   std::remove(path.c_str());
+}
+
+void test_threads()
+{
+   const int n = 50000;
+
+   EventLog::open(LogLevel::inter, path);
+   EventLog::getInstance()->defineVar(7, "x");
+
+   auto work = [&](int k)
+   {
+      for (int i = 0; i < n; ++i)
+         LOG_EVENT(LogEvent::Extract, k * n + i, i % 10);
+   };
+
+   std::thread t(work, 1);
+   work(0);
+   t.join();
+
+   // not recorded at this level
+   LOG_EVENT(LogEvent::Domain, 0, 7, 1.0, 2.0);
+
+   EventLog::close();
+   TEST_TRUE(EventLog::getInstance()->nbRecords() == 2 * n);
+
+   EventLogReader reader;
+   reader.read(path);
+   TEST_TRUE(reader.nbRecords() == 2 * n);
+   TEST_TRUE(reader.varName(7) == "x");
+
+   // the records of one thread are ordered
+   int64_t last[2] = {-1, n - 1};
+   bool ordered = true;
+   for (size_t i = 0; i < reader.nbRecords(); ++i)
+   {
+      const LogRecord &rec = reader.record(i);
+      int k = (rec.node < n) ? 0 : 1;
+      if (rec.node != last[k] + 1 || rec.aux != (rec.node % n) % 10)
+         ordered = false;
+      last[k] = rec.node;
+   }
+   TEST_TRUE(ordered);
+}
+
+void test_render()
+{
+   EventLog::open(LogLevel::low, path);
+   EventLog::getInstance()->defineVar(3, "y");
+   EventLog::getInstance()->defineVar(4, "z");
+
+   LOG_EVENT(LogEvent::Extract, 12, 2);
+   LOG_EVENT(LogEvent::Domain, 12, 3, 1.0, 2.0);
+   LOG_EVENT(LogEvent::Domain, 12, 4, -1.0, 0.5);
+   LOG_EVENT(LogEvent::Contract, 12, static_cast<uint32_t>(Proof::Maybe));
+   LOG_EVENT(LogEvent::Split, 12, 2);
+   EventLog::close();
+
+   EventLogReader reader;
+   reader.read(path);
+   TEST_TRUE(reader.nbRecords() == 5);
+
+   std::ostringstream os;
+   reader.render(os);
+
+   std::ostringstream expected, box;
+   box << "(y = " << Interval(1.0, 2.0) << ", z = " << Interval(-1.0, 0.5) << ")";
+   expected << "\nINTER. Extracts node 12 (depth 2)\n"
+            << "LOW.   Node: " << box.str() << "\n"
+            << "INTER. Contraction -> " << Proof::Maybe << "\n"
+            << "INTER. Node 12 is split into 2 sub-nodes\n";
+
+   TEST_TRUE(os.str() == expected.str());
+}
+
+void test_close()
+{
+   // closing and reopening the log while another thread records events
+   std::atomic<bool> done(false);
+   std::thread t(
+       [&]()
+       {
+          for (int64_t i = 0; !done; ++i)
+             LOG_EVENT(LogEvent::Extract, i, 0);
+       });
+
+   for (int k = 0; k < 20; ++k)
+   {
+      EventLog::open(LogLevel::inter, path);
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      EventLog::close();
+
+      EventLogReader reader;
+      reader.read(path);
+      TEST_TRUE(reader.nbRecords() == EventLog::getInstance()->nbRecords());
+   }
+
+   done = true;
+   t.join();
+}
+
+void test_bad_file()
+{
+   std::ofstream f(path, std::ios::out | std::ios::binary);
+   f << "RPXX";
+   f.close();
+
+   EventLogReader reader;
+   TEST_THROW(reader.read(path));
+}
+
+int main()
+{
+   INIT_TEST
+
+   TEST(test_threads)
+   TEST(test_render)
+   TEST(test_close)
+   TEST(test_bad_file)
+
+   CLEAN_TEST
+   END_TEST
+}
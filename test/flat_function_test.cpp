@@ -1,4 +1,5 @@
 #include "realpaver/FlatFunction.hpp"
+#include "realpaver/IntervalThickFunction.hpp"
 #include "realpaver/Problem.hpp"
 #include "test_config.hpp"
 
@@ -86,6 +87,162 @@ void test_diff_2()
    TEST_TRUE(G[1].isSetEq(Interval(-4, -0.25)));
 }
 
+void test_thick_1()
+{
+   SharedDag dag = std::make_shared<Dag>();
+   dag->insert(sqr(x) * (y + z) + exp(y + z) - 2 * x + 3 * y - z == 0);
+
+   IntervalBox B(P->scope());
+   B.set(x, Interval(-1, 2));
+   B.set(y, Interval(0, 1));
+   B.set(z, Interval(-2, 0.5));
+
+   // compiled in B and then updated in C
+   IntervalThickFunction f(dag, 0, x);
+   f.update(B);
+
+   IntervalBox C(B);
+   C.set(y, Interval(1, 3));
+   C.set(z, Interval(-0.5, 0));
+   f.update(C);
+
+   // compiled in C
+   IntervalThickFunction g(dag, 0, x);
+   g.update(C);
+
+   Interval X = C.get(x);
+   TEST_TRUE(f.eval(X).isSetEq(g.eval(X)));
+   TEST_TRUE(f.diff(X).isSetEq(g.diff(X)));
+}
+
+void test_fast_1()
+{
+   Term t(sqr(x) + x * y - MAX(y, z) + 1);
+   FlatFunction f(t, Interval::negative()), g(t, Interval::negative());
+   f.setFastEval(true);
+
+   // clearly outside
+   IntervalBox B(P->scope());
+   B.set(x, Interval(2, 3));
+   B.set(y, Interval(1, 2));
+   B.set(z, Interval(0, 1));
+   TEST_TRUE(f.hc4Revise(B) == Proof::Empty);
+
+   // clearly inside
+   B.set(x, Interval(-0.5, 0.5));
+   B.set(y, Interval(0, 1));
+   B.set(z, Interval(2, 3));
+   TEST_TRUE(f.hc4Revise(B) == Proof::Inner);
+
+   // inconclusive, hence the same contraction as the interval evaluation
+   B.set(x, Interval(-1, 1));
+   B.set(y, Interval(0, 1));
+   B.set(z, Interval(0, 2));
+   IntervalBox C(B);
+   Proof p = f.hc4Revise(B), q = g.hc4Revise(C);
+   TEST_TRUE(p == q);
+   TEST_TRUE(B.equals(C));
+
+   TEST_TRUE(f.nbFastEvals() == 3);
+   TEST_TRUE(f.nbFastProofs() == 2);
+   TEST_TRUE(g.nbFastEvals() == 0);
+}
+
+void test_fast_2()
+{
+   // the fast path must not contradict the interval evaluation on boxes
+   // that are close to the boundary of the constraint
+   Term t(x * y - exp(z) / 3 + sqr(x - 0.1));
+   FlatFunction f(t, Interval(1, 2)), g(t, Interval(1, 2));
+   f.setFastEval(true);
+
+   for (int i = 0; i < 200; ++i)
+   {
+      double a = -1.0 + i * 0.01;
+      IntervalBox B(P->scope());
+      B.set(x, Interval(a, a + 1.0e-12));
+      B.set(y, Interval(1.3, 1.3 + 1.0e-13));
+      B.set(z, Interval(0.2));
+      IntervalBox C(B);
+
+      Proof p = f.hc4Revise(B), q = g.hc4Revise(C);
+      if (p == Proof::Empty || p == Proof::Inner)
+         TEST_TRUE(p == q);
+   }
+}
+
+void test_mono_1()
+{
+   // x*y - x = x*(y-1) lies in [1, 4] whereas its natural extension is [0, 5]
+   Term t(x * y - x);
+   FlatFunction f(t, Interval(0.5, 4.5)), g(t, Interval(0.5, 4.5));
+   f.setMonotonicEval(true);
+
+   IntervalBox B(P->scope());
+   B.set(x, Interval(1, 2));
+   B.set(y, Interval(2, 3));
+   IntervalBox C(B);
+
+   TEST_TRUE(f.hc4Revise(B) == Proof::Inner);
+   TEST_TRUE(g.hc4Revise(C) == Proof::Maybe);
+}
+
+void test_mono_2()
+{
+   // x*(y-1) = 1 with y in [2, 3] implies x in [0.5, 1]
+   Term t(x * y - x);
+   FlatFunction f(t, Interval(1));
+   f.setMonotonicEval(true);
+
+   IntervalBox B(P->scope());
+   B.set(x, Interval(0, 10));
+   B.set(y, Interval(2, 3));
+
+   TEST_TRUE(f.hc4Revise(B) == Proof::Maybe);
+   TEST_TRUE(B.get(x).contains(Interval(0.5, 1)));
+   TEST_TRUE(B.get(x).left() > 0.45 && B.get(x).right() < 1.05);
+
+   // the signs are calculated again since the domain of x has been halved,
+   // then they are reused in the same box
+   f.hc4Revise(B);
+   f.hc4Revise(B);
+   TEST_TRUE(f.nbMonotonicEvals() == 3);
+   TEST_TRUE(f.nbMonotonicSigns() == 2);
+}
+
+void test_mono_3()
+{
+   // no solution may be lost
+   Term t(x * y - x - sqr(y) + x * z * y);
+   FlatFunction f(t, Interval(0.5, 1));
+   f.setMonotonicEval(true);
+
+   for (int i = 0; i < 20; ++i)
+   {
+      double a = -2.0 + i * 0.2;
+      IntervalBox B(P->scope());
+      B.set(x, Interval(a, a + 0.7));
+      B.set(y, Interval(-1.5, 2));
+      B.set(z, Interval(0.1, 0.4));
+      IntervalBox C(B);
+
+      Proof p = f.hc4Revise(B);
+
+      for (int j = 0; j <= 10; ++j)
+         for (int k = 0; k <= 10; ++k)
+         {
+            double u = a + 0.069 * j, v = -1.5 + 0.349 * k, w = 0.25;
+            double e = u * v - u - v * v + u * w * v;
+
+            if (e >= 0.5 + 1.0e-8 && e <= 1.0 - 1.0e-8)
+            {
+               TEST_TRUE(p != Proof::Empty);
+               TEST_TRUE(B.get(x).contains(u) && B.get(y).contains(v));
+            }
+         }
+   }
+}
+
 int main()
 {
    INIT_TEST
@@ -97,6 +254,15 @@ int main()
    TEST(test_diff_1)
    TEST(test_diff_2)
 
+   TEST(test_thick_1)
+
+   TEST(test_fast_1)
+   TEST(test_fast_2)
+
+   TEST(test_mono_1)
+   TEST(test_mono_2)
+   TEST(test_mono_3)
+
    CLEAN_TEST
    END_TEST
 }
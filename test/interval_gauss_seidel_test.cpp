@@ -0,0 +1,97 @@
+#include "realpaver/IntervalGaussSeidel.hpp"
+#include "test_config.hpp"
+
+IntervalMatrix *A;
+IntervalVector *b;
+
+void init()
+{
+   // sparse system whose solution is (1, 2, 3)
+   A = new IntervalMatrix({{Interval(3.9, 4.1), Interval(1.0), Interval(0.0)},
+                           {Interval(0.0), Interval(2.9, 3.1), Interval(-1.0)},
+                           {Interval(1.0), Interval(0.0), Interval(5.0)}});
+
+   b = new IntervalVector({Interval(5.8, 6.2), Interval(2.7, 3.3), Interval(16.0)});
+}
+
+void clean()
+{
+   delete b;
+   delete A;
+}
+
+void test_1()
+{
+   IntervalGaussSeidel gs;
+   IntervalVector x(3, Interval(-10, 10));
+
+   TEST_TRUE(gs.contractPrecond(*A, x, *b) == Proof::Maybe);
+   TEST_TRUE(x.get(0).contains(1.0));
+   TEST_TRUE(x.get(1).contains(2.0));
+   TEST_TRUE(x.get(2).contains(3.0));
+   TEST_TRUE(x.width() < 2.0);
+}
+
+void test_2()
+{
+   IntervalGaussSeidel gs;
+   IntervalVector x(3, Interval(-10, 10));
+
+   // reference: explicit preconditioning
+   RealMatrix M = A->midpoint(), P(3, 3);
+   TEST_TRUE(M.inverse(P));
+
+   IntervalGaussSeidel ref;
+   IntervalVector y(x);
+   ref.contract(P * (*A), y, P * (*b));
+
+   gs.contractPrecond(*A, x, *b);
+
+   for (size_t i = 0; i < 3; ++i)
+      TEST_TRUE(x.get(i).isSetEq(y.get(i)));
+}
+
+void test_3()
+{
+   IntervalGaussSeidel gs;
+   IntervalVector x(3, Interval(-10, 10)), y(x);
+
+   gs.contractPrecond(*A, x, *b);
+   TEST_TRUE(gs.nbInversions() == 1);
+
+   // same midpoint matrix
+   gs.contractPrecond(*A, y, *b);
+   TEST_TRUE(gs.nbInversions() == 1);
+   TEST_TRUE(x.equals(y));
+
+   // new midpoint matrix
+   IntervalMatrix B(*A);
+   B.set(0, 0, Interval(4.1, 4.3));
+   y = IntervalVector(3, Interval(-10, 10));
+   gs.contractPrecond(B, y, *b);
+   TEST_TRUE(gs.nbInversions() == 2);
+}
+
+void test_4()
+{
+   IntervalGaussSeidel gs;
+   IntervalMatrix S(2, 2, Interval(1.0));
+   IntervalVector x(2, Interval(-1, 1)), c(2, Interval(1.0));
+
+   // singular midpoint matrix
+   TEST_TRUE(gs.contractPrecond(S, x, c) == Proof::Maybe);
+   TEST_TRUE(x.equals(IntervalVector(2, Interval(-1, 1))));
+}
+
+int main()
+{
+   INIT_TEST
+
+   TEST(test_1)
+   TEST(test_2)
+   TEST(test_3)
+   TEST(test_4)
+
+   CLEAN_TEST
+   END_TEST
+}
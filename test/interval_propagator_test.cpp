@@ -0,0 +1,90 @@
+#include "realpaver/ContractorHC4Revise.hpp"
+#include "realpaver/IntervalPropagator.hpp"
+#include "realpaver/Problem.hpp"
+#include "test_config.hpp"
+
+Problem *prob;
+SharedDag dag;
+SharedContractorPool pool;
+Variable x, y, u, v;
+
+void init()
+{
+   prob = new Problem();
+   x = prob->addRealVar(0, 1, "x");
+   y = prob->addRealVar(-10, 10, "y");
+   u = prob->addRealVar(-10, 10, "u");
+   v = prob->addRealVar(-10, 10, "v");
+
+   dag = std::make_shared<Dag>();
+   // triangular system reduced to a point, except the first constraint
+   // that never reduces the box
+   dag->insert(y - x <= 100.0);
+   dag->insert(x - 0.5 == 0);
+   dag->insert(y - 2.0 * x == 0);
+   dag->insert(u + y == 3.0);
+   dag->insert(v * u == 4.0);
+
+   pool = std::make_shared<ContractorPool>();
+   for (size_t i = 0; i < dag->nbFuns(); ++i)
+      pool->push(std::make_shared<ContractorHC4Revise>(dag, i));
+}
+
+void clean()
+{
+   delete prob;
+}
+
+void test_fixpoint()
+{
+   IntervalPropagator fifo(pool), adaptive(pool);
+   adaptive.setScheduling(PropagationScheduling::Adaptive);
+
+   // same fixed-point without skipping, even when the statistics of the
+   // contractors are learned over many calls
+   for (size_t k = 0; k < 200; ++k)
+   {
+      IntervalBox B(prob->scope()), C(prob->scope());
+      Proof p = fifo.contract(B), q = adaptive.contract(C);
+
+      TEST_TRUE((p == Proof::Empty) == (q == Proof::Empty));
+      TEST_TRUE(B.equals(C));
+   }
+   TEST_TRUE(adaptive.nbSkipped() == 0);
+}
+
+void test_skip()
+{
+   IntervalPropagator fifo(pool), skip(pool);
+   skip.setScheduling(PropagationScheduling::AdaptiveSkip);
+
+   const size_t n = 1000;
+   for (size_t k = 0; k < n; ++k)
+   {
+      IntervalBox B(prob->scope()), C(prob->scope());
+      fifo.contract(B);
+      skip.contract(C);
+
+      // the contractors skipped in this problem are activated as soon as
+      // a domain is reduced, hence the fixed-point is reached
+      TEST_TRUE(B.equals(C));
+   }
+
+   // the first contractor is idle, it is skipped at the beginning of the
+   // propagation but it is re-enabled when x is reduced by the second one
+   TEST_TRUE(skip.nbSkipped() > 0);
+   TEST_TRUE(skip.nbCallsAt(0) >= n);
+   TEST_TRUE(skip.nbReductionsAt(0) == 0);
+   TEST_TRUE(skip.nbCallsAt(1) == n);
+}
+
+int main()
+{
+   INIT_TEST
+
+   TEST(test_fixpoint)
+   TEST(test_skip)
+
+   CLEAN_TEST
+   END_TEST
+}
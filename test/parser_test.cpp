@@ -0,0 +1,64 @@
+#include "realpaver/Parser.hpp"
+#include "test_config.hpp"
+#include <cstdio>
+#include <fstream>
+
+std::string path;
+
+void init()
+{
+   path = "parser_test.rp";
+}
+
+void clean()
+{
+   std::remove(path.c_str());
+}
+
+// writes a model of n bytes, the model being preceded by a comment
+void writeModel(size_t n)
+{
+   std::string model = "Variables x in [-1, 1], y in [0, 2];\n"
+                       "Constraints x + y == 1, x - y <= 0;\n";
+
+   std::ofstream f(path, std::ios::out | std::ios::binary);
+   f << "#" << std::string(n - model.size() - 2, '-') << "\n" << model;
+}
+
+void test_file()
+{
+   // sizes around the multiples of the usual page sizes, in particular the
+   // sizes for which the file cannot be scanned in place
+   for (size_t p : {4096, 16384, 65536})
+   {
+      for (size_t n : {p - 2, p - 1, p, p + 1, 2 * p})
+      {
+         writeModel(n);
+
+         Parser parser;
+         Problem problem;
+         TEST_TRUE(parser.parseFile(path, problem));
+         TEST_TRUE(parser.getInputSize() == n);
+         TEST_TRUE(problem.nbVars() == 2);
+         TEST_TRUE(problem.nbCtrs() == 2);
+      }
+   }
+}
+
+void test_missing_file()
+{
+   Parser parser;
+   Problem problem;
+   TEST_FALSE(parser.parseFile("parser_test_missing.rp", problem));
+}
+
+int main()
+{
+   INIT_TEST
+
+   TEST(test_file)
+   TEST(test_missing_file)
+
+   CLEAN_TEST
+   END_TEST
+}
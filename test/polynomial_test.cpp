@@ -0,0 +1,190 @@
+#include "realpaver/ContractorPolynomial.hpp"
+#include "realpaver/Dag.hpp"
+#include "realpaver/Problem.hpp"
+#include "test_config.hpp"
+
+Problem *prob;
+SharedDag dag;
+IntervalBox *B;
+Variable x, y, z;
+
+void init()
+{
+   prob = new Problem();
+   x = prob->addRealVar(0, 0, "x");
+   y = prob->addRealVar(0, 0, "y");
+   z = prob->addRealVar(0, 0, "z");
+
+   dag = std::make_shared<Dag>();
+   dag->insert(sqr(x + y) - 2 * x * y - 1 == 0);
+   dag->insert(x * y * z + pow(x, 3) - z / 2 <= 0);
+   dag->insert(sqr(x) - x == 0);
+   dag->insert(exp(x) + y == 0);
+
+   B = new IntervalBox(prob->scope());
+}
+
+void clean()
+{
+   delete B;
+   delete prob;
+}
+
+void test_expand()
+{
+   Polynomial p(dag->fun(0));
+
+   TEST_TRUE(p.nbVars() == 2);
+   TEST_TRUE(p.degree() == 2);
+   TEST_TRUE(p.degree(0) == 2);
+   TEST_TRUE(p.degree(1) == 2);
+
+   // x^2 + y^2 - 1 without the monomial x*y
+   for (size_t k = 0; k < p.nbMonomials(); ++k)
+   {
+      if (p.exponent(k, 0) == 1 && p.exponent(k, 1) == 1)
+         TEST_TRUE(p.coef(k).isZero());
+   }
+
+   Polynomial q(dag->fun(1));
+   TEST_TRUE(q.nbVars() == 3);
+   TEST_TRUE(q.degree() == 3);
+}
+
+void test_eval()
+{
+   B->set(x, Interval(-1, 2));
+   B->set(y, Interval(-2, 0.5));
+   B->set(z, Interval(0.5, 3));
+
+   Polynomial p(dag->fun(1));
+   Interval e = p.eval(*B);
+
+   // soundness on a grid
+   for (int i = 0; i <= 10; ++i)
+      for (int j = 0; j <= 10; ++j)
+         for (int k = 0; k <= 10; ++k)
+         {
+            double a = -1 + 0.3 * i, b = -2 + 0.25 * j, c = 0.5 + 0.25 * k;
+            double v = a * b * c + a * a * a - c / 2;
+            TEST_TRUE(e.contains(v));
+         }
+
+   // enclosure on a point
+   IntervalBox P(*B);
+   P.set(x, Interval(1));
+   P.set(y, Interval(-1));
+   P.set(z, Interval(2));
+   TEST_TRUE(p.eval(P).contains(-2.0));
+   TEST_TRUE(p.eval(P).width() <= 1.0e-12);
+}
+
+void test_bernstein()
+{
+   B->set(x, Interval(0, 1));
+
+   Polynomial p(dag->fun(2));
+   Interval e, h = p.eval(*B);
+
+   TEST_TRUE(p.bernstein(*B, 100, e));
+   TEST_TRUE(e.contains(Interval(-0.25, 0)));
+   TEST_TRUE(h.contains(e));
+   TEST_TRUE(e.left() >= -0.5 - 1.0e-12);
+
+   // too many coefficients
+   TEST_TRUE(!p.bernstein(*B, 2, e));
+
+   // soundness on a grid of a sparse polynomial with 4*2*2 coefficients
+   B->set(x, Interval(-1, 2));
+   B->set(y, Interval(-2, 0.5));
+   B->set(z, Interval(0.5, 3));
+
+   Polynomial q(dag->fun(1));
+   TEST_TRUE(q.bernstein(*B, 16, e));
+   TEST_FALSE(q.bernstein(*B, 15, e));
+
+   for (int i = 0; i <= 10; ++i)
+      for (int j = 0; j <= 10; ++j)
+         for (int k = 0; k <= 10; ++k)
+         {
+            double a = -1 + 0.3 * i, b = -2 + 0.25 * j, c = 0.5 + 0.25 * k;
+            double v = a * b * c + a * a * a - c / 2;
+            TEST_TRUE(e.contains(v));
+         }
+}
+
+void test_coefficients()
+{
+   B->set(x, Interval(1, 2));
+   B->set(y, Interval(3, 4));
+
+   Polynomial p(dag->fun(0));
+   std::vector<Interval> Q;
+
+   // x^2 + (y^2 - 1) as a polynomial in x
+   p.coefficients(0, *B, Q);
+   TEST_TRUE(Q.size() == 3);
+   TEST_TRUE(Q[0].contains(Interval(8, 15)));
+   TEST_TRUE(Q[1].containsZero());
+   TEST_TRUE(Q[2].contains(1.0));
+}
+
+void test_contract_1()
+{
+   B->set(x, Interval(0.5, 2));
+   B->set(y, Interval(-2, 2));
+
+   ContractorPolynomial ctc(dag, 0);
+   Proof proof = ctc.contract(*B);
+
+   TEST_TRUE(proof == Proof::Maybe);
+
+   Interval rx(0.5, 1), ry(-sqrt(Interval(0.75)).right(), sqrt(Interval(0.75)).right());
+
+   TEST_TRUE(B->get(x).contains(rx));
+   TEST_TRUE(B->get(y).contains(ry));
+   // the bounds are shrunk up to the tolerance of the univariate Newton operator
+   TEST_TRUE(B->get(x).distance(rx) <= 1.0e-3);
+   TEST_TRUE(B->get(y).distance(ry) <= 1.0e-3);
+}
+
+void test_contract_2()
+{
+   B->set(x, Interval(2, 3));
+   B->set(y, Interval(-2, 2));
+
+   ContractorPolynomial ctc(dag, 0);
+   TEST_TRUE(ctc.contract(*B) == Proof::Empty);
+}
+
+void test_contract_3()
+{
+   B->set(x, Interval(0.2, 0.8));
+
+   // no solution of x^2 - x = 0 in B
+   ContractorPolynomial ctc(dag, 2);
+   ctc.setBernsteinLimit(100);
+   TEST_TRUE(ctc.contract(*B) == Proof::Empty);
+}
+
+void test_not_polynomial()
+{
+   TEST_THROW(ContractorPolynomial(dag, 3));
+}
+
+int main()
+{
+   INIT_TEST
+
+   TEST(test_expand)
+   TEST(test_eval)
+   TEST(test_bernstein)
+   TEST(test_coefficients)
+   TEST(test_contract_1)
+   TEST(test_contract_2)
+   TEST(test_contract_3)
+   TEST(test_not_polynomial)
+
+   CLEAN_TEST
+   END_TEST
+}
@@ -110,6 +110,43 @@ void test_7()
    TEST_TRUE(box.scope().contains(v));
 }
 
+void test_8()
+{
+   Preprocessor proc1, proc2;
+   Problem dest1, dest2;
+
+   DomainBox region(Scope({z}));
+   region.set(z, std::make_unique<IntervalDomain>(Interval(0, 10)));
+
+   proc1.apply(*src, dest1);
+   proc2.apply(*src, region, dest2);
+
+   // z is not modified in the source problem
+   TEST_TRUE(z.getDomain()->intervalHull().isSetEq(Interval(-10, 10)));
+   TEST_TRUE(proc2.destRegion().get(proc2.srcToDestVar(z))->intervalHull().left() >= 0.0);
+
+   TEST_TRUE(proc1.hasSameOutcome(proc2));
+
+   proc2.assignDestVars(proc1);
+   TEST_TRUE(proc2.srcToDestVar(z).id() == proc1.srcToDestVar(z).id());
+}
+
+void test_9()
+{
+   Preprocessor proc1, proc2;
+   Problem dest1, dest2;
+
+   // z is fixed and the problem is solved
+   DomainBox region(Scope({z}));
+   region.set(z, std::make_unique<IntervalDomain>(Interval(1)));
+
+   proc1.apply(*src, dest1);
+   proc2.apply(*src, region, dest2);
+
+   TEST_TRUE(proc2.isSolved());
+   TEST_FALSE(proc1.hasSameOutcome(proc2));
+}
+
 int main()
 {
    INIT_TEST
@@ -121,6 +158,8 @@ int main()
    TEST(test_5)
    TEST(test_6)
    TEST(test_7)
+   TEST(test_8)
+   TEST(test_9)
 
    CLEAN_TEST
    END_TEST
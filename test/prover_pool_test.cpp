@@ -0,0 +1,81 @@
+#include "realpaver/ProverPool.hpp"
+#include "test_config.hpp"
+
+Problem *P;
+Variable x, y;
+
+void init()
+{
+   P = new Problem();
+   x = P->addRealVar(-10, 10, "x");
+   y = P->addRealVar(-10, 10, "y");
+
+   P->addCtr(sqr(x) + sqr(y) == 2);
+   P->addCtr(x - y == 0);
+}
+
+void clean()
+{
+   delete P;
+}
+
+void test_copy()
+{
+   Prover prover(*P);
+   Prover other(prover);
+
+   IntervalBox B(P->scope()), C(P->scope());
+   B.set(x, Interval(0.99, 1.01));
+   B.set(y, Interval(0.99, 1.01));
+   C = B;
+
+   TEST_TRUE(prover.certify(B) == Proof::Feasible);
+   TEST_TRUE(other.certify(C) == Proof::Feasible);
+   TEST_TRUE(B.equals(C));
+}
+
+void test_pool()
+{
+   Prover prover(*P);
+   ProverPool pool(prover, 2);
+
+   std::vector<IntervalBox> vB;
+   for (int i = 0; i < 20; ++i)
+   {
+      IntervalBox B(P->scope());
+      double a = (i % 2 == 0) ? 1.0 : -1.0, e = 0.001 * (1 + i);
+      B.set(x, Interval(a - e, a + e));
+      B.set(y, Interval(a - e, a + e));
+      vB.push_back(B);
+      TEST_TRUE(pool.submit(B) == (size_t)i);
+   }
+
+   // one box with no solution
+   IntervalBox D(P->scope());
+   D.set(x, Interval(4, 5));
+   D.set(y, Interval(4, 5));
+   vB.push_back(D);
+   pool.submit(D);
+
+   pool.wait();
+   TEST_TRUE(pool.nbBoxes() == vB.size());
+
+   for (size_t i = 0; i < vB.size(); ++i)
+   {
+      Proof proof = prover.certify(vB[i]);
+      TEST_TRUE(pool.getProof(i) == proof);
+      TEST_TRUE(pool.getBox(i).equals(vB[i]));
+   }
+   TEST_TRUE(pool.getProof(vB.size() - 1) == Proof::Empty);
+}
+
+int main()
+{
+   INIT_TEST
+
+   TEST(test_copy)
+   TEST(test_pool)
+
+   CLEAN_TEST
+   END_TEST
+}
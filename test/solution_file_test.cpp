@@ -0,0 +1,120 @@
+#include "realpaver/Problem.hpp"
+#include "realpaver/SolutionFile.hpp"
+#include "test_config.hpp"
+#include <sstream>
+
+Problem *prob;
+Variable x, y, n;
+
+void init()
+{
+   prob = new Problem();
+   x = prob->addRealVar(-10, 10, "x");
+   y = prob->addRealVar(-10, 10, "y");
+   n = prob->addIntVar(0, 9, "n");
+}
+
+void clean()
+{
+   delete prob;
+}
+
+DomainBox box(double a, double b, int k)
+{
+   DomainBox B(prob->scope());
+   B.set(x, std::make_unique<IntervalDomain>(Interval(a, a + 0.1)));
+   B.set(y, std::make_unique<IntervalDomain>(Interval(b, b + 0.2)));
+   B.set(n, std::make_unique<RangeDomain>(Range(k, k + 1)));
+   return B;
+}
+
+void test_binary_1()
+{
+   std::ostringstream os;
+   BinaryReporter reporter(*prob, os);
+   reporter.remove("y");
+   reporter.start();
+
+   reporter.report(box(1.0 / 3.0, 2, 4), Proof::Inner);
+   reporter.report(box(-5, 0, 7), Proof::Maybe);
+   reporter.report(box(0.25, 1, 1), Proof::Feasible);
+
+   std::string buf = os.str();
+   SolutionReader reader;
+   reader.decode(buf.data(), buf.size());
+
+   TEST_TRUE(reader.nbColumns() == 2);
+   TEST_TRUE(reader.columnName(0) == "x");
+   TEST_TRUE(reader.columnName(1) == "n");
+   TEST_TRUE(reader.columnIndex("n") == 1);
+   TEST_THROW(reader.columnIndex("y"));
+
+   TEST_TRUE(reader.nbSolutions() == 3);
+   TEST_TRUE(reader.getProof(0) == Proof::Inner);
+   TEST_TRUE(reader.getProof(1) == Proof::Maybe);
+   TEST_TRUE(reader.getProof(2) == Proof::Feasible);
+
+   TEST_TRUE(reader.get(0, 0).isSetEq(Interval(1.0 / 3.0, 1.0 / 3.0 + 0.1)));
+   TEST_TRUE(reader.get(1, 1).isSetEq(Interval(7, 8)));
+
+   IntervalVector X = reader.getSolution(2);
+   TEST_TRUE(X.size() == 2);
+   TEST_TRUE(X[0].isSetEq(Interval(0.25, 0.25 + 0.1)));
+   TEST_TRUE(X[1].isSetEq(Interval(1, 2)));
+}
+
+void test_binary_2()
+{
+   std::ostringstream os;
+   BinaryReporter reporter(*prob, os);
+   reporter.start();
+   reporter.report(box(1, 2, 3), Proof::Inner);
+   reporter.report(box(4, 5, 6), Proof::Inner);
+
+   // the truncated record is ignored
+   std::string buf = os.str();
+   SolutionReader reader;
+   reader.decode(buf.data(), buf.size() - 8);
+   TEST_TRUE(reader.nbSolutions() == 1);
+
+   // no solution
+   std::ostringstream os2;
+   BinaryReporter empty(*prob, os2);
+   empty.start();
+   buf = os2.str();
+   reader.decode(buf.data(), buf.size());
+   TEST_TRUE(reader.nbColumns() == 3);
+   TEST_TRUE(reader.nbSolutions() == 0);
+
+   // not a solution file
+   buf[0] = 'X';
+   TEST_THROW(reader.decode(buf.data(), buf.size()));
+}
+
+void test_csv()
+{
+   std::ostringstream os;
+   CsvReporter reporter(*prob, os);
+   reporter.remove("n");
+   reporter.report(box(0.5, -1, 0), Proof::Inner);
+
+   std::istringstream is(os.str());
+   std::string header, line;
+   std::getline(is, header);
+   std::getline(is, line);
+
+   TEST_TRUE(header == "proof,x_lo,x_hi,y_lo,y_hi");
+   TEST_TRUE(line.substr(0, 6) == "inner,");
+}
+
+int main()
+{
+   INIT_TEST
+
+   TEST(test_binary_1)
+   TEST(test_binary_2)
+   TEST(test_csv)
+
+   CLEAN_TEST
+   END_TEST
+}